@@ -0,0 +1,4 @@
+include(${CMAKE_CURRENT_LIST_DIR}/linux.cmake)
+
+set(THREADX_ARCH "linux_single")
+set(THREADX_TOOLCHAIN "gnu")
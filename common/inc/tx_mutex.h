@@ -92,6 +92,10 @@ VOID        _tx_mutex_initialize(VOID);
 VOID        _tx_mutex_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
 VOID        _tx_mutex_thread_release(TX_THREAD *thread_ptr);
 VOID        _tx_mutex_priority_change(TX_THREAD *thread_ptr, UINT new_priority);
+#ifdef TX_MUTEX_ENABLE_FAST_PATH
+UINT        _tx_mutex_fast_get(TX_MUTEX *mutex_ptr);
+UINT        _tx_mutex_fast_put(TX_MUTEX *mutex_ptr);
+#endif
 
 
 /* Mutex management component data declarations follow.  */
@@ -152,6 +156,13 @@ MUTEX_DECLARE  ULONG        _tx_mutex_performance__priority_inheritance_count;
 #endif
 
 
+/* Define the macro to pickup the priority ceiling of a mutex.  A mutex not created with the
+   priority ceiling protocol, including a statically initialized control block, has no ceiling.  */
+
+#define TX_MUTEX_CEILING_PRIORITY(m)            (((m) -> tx_mutex_inherit == TX_CEILING_PROTOCOL) ? \
+                                                 (m) -> tx_mutex_ceiling_priority : ((UINT) TX_MAX_PRIORITIES))
+
+
 /* Define default post mutex delete macro to whitespace, if it hasn't been defined previously (typically in tx_port.h).  */
 
 #ifndef TX_MUTEX_DELETE_PORT_COMPLETION
@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_rwlock.h                                         PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX reader-writer lock management         */
+/*    component, including all data types and external references.  It   */
+/*    is assumed that tx_api.h and tx_port.h have already been included.  */
+/*                                                                        */
+/*    Any number of threads may hold the lock for reading at the same     */
+/*    time, while a writer has exclusive ownership.  Writers are given    */
+/*    preference: once a writer is waiting, new readers are suspended     */
+/*    until all pending writers have been serviced.  When created with    */
+/*    TX_INHERIT, the current writer inherits the priority of the highest */
+/*    priority thread waiting on the lock.  Readers are not tracked       */
+/*    individually and therefore never inherit priority.  For the same    */
+/*    reason, a put from a thread that holds no read lock releases the    */
+/*    read hold of another thread, and read holds are not released when   */
+/*    their thread completes or is terminated.  The write ownership is    */
+/*    released in both cases.                                             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_RWLOCK_H
+#define TX_RWLOCK_H
+
+
+/* Define reader-writer lock control specific data definitions.  */
+
+#define TX_RWLOCK_ID                            ((ULONG) 0x52574C4B)
+
+
+/* Define the suspension option values used to remember what type of access a
+   suspended thread has requested.  */
+
+#define TX_RWLOCK_READ                          ((UINT) 0)
+#define TX_RWLOCK_WRITE                         ((UINT) 1)
+
+
+/* Determine if in-line component initialization is supported by the
+   caller.  */
+
+#ifdef TX_INVOKE_INLINE_INITIALIZATION
+
+/* Yes, in-line initialization is supported, remap the reader-writer lock
+   initialization function.  */
+
+#ifndef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+#define _tx_rwlock_initialize() \
+                    _tx_rwlock_created_ptr =                            TX_NULL;      \
+                    _tx_rwlock_created_count =                          TX_EMPTY
+#else
+#define _tx_rwlock_initialize() \
+                    _tx_rwlock_created_ptr =                            TX_NULL;      \
+                    _tx_rwlock_created_count =                          TX_EMPTY;     \
+                    _tx_rwlock_performance_read_get_count =             ((ULONG) 0);  \
+                    _tx_rwlock_performance_write_get_count =            ((ULONG) 0);  \
+                    _tx_rwlock_performance_put_count =                  ((ULONG) 0);  \
+                    _tx_rwlock_performance_suspension_count =           ((ULONG) 0);  \
+                    _tx_rwlock_performance_timeout_count =              ((ULONG) 0);  \
+                    _tx_rwlock_performance_priority_inheritance_count = ((ULONG) 0)
+#endif
+#define TX_RWLOCK_INIT
+#else
+
+/* No in-line initialization is supported, use standard function call.  */
+VOID        _tx_rwlock_initialize(VOID);
+#endif
+
+
+/* Define internal reader-writer lock management function prototypes.  */
+
+VOID        _tx_rwlock_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_rwlock_thread_release(TX_THREAD *thread_ptr);
+TX_THREAD   *_tx_rwlock_waiters_grant(TX_RWLOCK *rwlock_ptr);
+
+
+/* Reader-writer lock management component data declarations follow.  */
+
+/* Determine if the initialization function of this component is including
+   this file.  If so, make the data definitions really happen.  Otherwise,
+   make them extern so other functions in the component can access them.  */
+
+#ifdef TX_RWLOCK_INIT
+#define RWLOCK_DECLARE
+#else
+#define RWLOCK_DECLARE extern
+#endif
+
+
+/* Define the head pointer of the created reader-writer lock list.  */
+
+RWLOCK_DECLARE  TX_RWLOCK *  _tx_rwlock_created_ptr;
+
+
+/* Define the variable that holds the number of created reader-writer locks. */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_created_count;
+
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+/* Define the total number of reader-writer lock read gets.  */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_performance_read_get_count;
+
+
+/* Define the total number of reader-writer lock write gets.  */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_performance_write_get_count;
+
+
+/* Define the total number of reader-writer lock puts.  */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_performance_put_count;
+
+
+/* Define the total number of reader-writer lock suspensions.  */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_performance_suspension_count;
+
+
+/* Define the total number of reader-writer lock timeouts.  */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_performance_timeout_count;
+
+
+/* Define the total number of writer priority inheritance conditions.  */
+
+RWLOCK_DECLARE  ULONG        _tx_rwlock_performance_priority_inheritance_count;
+
+
+#endif
+
+
+/* Define default reader-writer lock create and delete extensions to whitespace, if they haven't
+   been defined previously (typically in tx_port.h).  */
+
+#ifndef TX_RWLOCK_CREATE_EXTENSION
+#define TX_RWLOCK_CREATE_EXTENSION(r)
+#endif
+
+#ifndef TX_RWLOCK_DELETE_EXTENSION
+#define TX_RWLOCK_DELETE_EXTENSION(r)
+#endif
+
+
+#endif
@@ -273,8 +273,65 @@
 #endif
 
 
+/* Define the priority of the earliest-deadline-first scheduling band.  Ready threads of this
+   priority that have a deadline are ordered by their absolute deadline instead of the order
+   they became ready in.  Threads of this priority without a deadline are placed after them.
+   The priority may be changed by defining it in tx_port.h or on the command line.  */
+
+#ifdef TX_THREAD_ENABLE_EDF
+#ifndef TX_THREAD_EDF_PRIORITY
+#define TX_THREAD_EDF_PRIORITY                  16
+#endif
+#if TX_THREAD_EDF_PRIORITY >= TX_MAX_PRIORITIES
+#error "TX_THREAD_EDF_PRIORITY must be less than TX_MAX_PRIORITIES."
+#endif
+#ifdef TX_NO_TIMER
+#error "TX_THREAD_ENABLE_EDF can not be used with TX_NO_TIMER."
+#endif
+#endif
+
+
+/* Define the CPU budget states.  An exhausted or replenished thread waits on the pending
+   list for the budget thread to demote or suspend it, or to restore it.  An enforced thread
+   waits on the enforced list for the replenishment of its budget.  */
+
+#define TX_THREAD_BUDGET_AVAILABLE              ((UINT) 0)
+#define TX_THREAD_BUDGET_EXHAUSTED              ((UINT) 1)
+#define TX_THREAD_BUDGET_ENFORCED               ((UINT) 2)
+#define TX_THREAD_BUDGET_REPLENISHED            ((UINT) 3)
+
+
+/* Define the stack size and the priority of the budget thread.  By default they are the
+   same as those of the system timer thread.  The budget thread must have a higher priority
+   than all threads with a CPU budget.  The budget is charged by the timer interrupt of the
+   port, which must define TX_PORT_THREAD_BUDGET in tx_port.h.  */
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+#ifndef TX_THREAD_BUDGET_THREAD_STACK_SIZE
+#define TX_THREAD_BUDGET_THREAD_STACK_SIZE      TX_TIMER_THREAD_STACK_SIZE
+#endif
+#ifndef TX_THREAD_BUDGET_THREAD_PRIORITY
+#define TX_THREAD_BUDGET_THREAD_PRIORITY        TX_TIMER_THREAD_PRIORITY
+#endif
+#ifndef TX_PORT_THREAD_BUDGET
+#error "TX_THREAD_ENABLE_BUDGET is not supported by the timer interrupt of this port."
+#endif
+#ifdef TX_NO_TIMER
+#error "TX_THREAD_ENABLE_BUDGET can not be used with TX_NO_TIMER."
+#endif
+#endif
+
+
 /* Define internal thread control function prototypes.  */
 
+#ifdef TX_THREAD_ENABLE_BUDGET
+VOID        _tx_thread_budget_charge(VOID);
+VOID        _tx_thread_budget_remove(TX_THREAD *thread_ptr);
+VOID        _tx_thread_budget_thread_entry(ULONG budget_thread_input);
+#endif
+#ifdef TX_THREAD_ENABLE_EDF
+VOID        _tx_thread_edf_ready_insert(TX_THREAD *thread_ptr);
+#endif
 VOID        _tx_thread_initialize(VOID);
 VOID        _tx_thread_schedule(VOID);
 VOID        _tx_thread_shell_entry(VOID);
@@ -405,6 +462,13 @@ THREAD_DECLARE  volatile UINT   _tx_thread_preempt_disable;
 THREAD_DECLARE  VOID            (*_tx_thread_mutex_release)(TX_THREAD *thread_ptr);
 
 
+/* Define the global function pointer for reader-writer lock cleanup on thread
+   completion or termination. This pointer is setup during reader-writer lock
+   creation.  */
+
+THREAD_DECLARE  VOID            (*_tx_thread_rwlock_release)(TX_THREAD *thread_ptr);
+
+
 /* Define the global build options variable.  This contains a bit map representing
    how the ThreadX library was built. The following are the bit field definitions:
 
@@ -530,5 +594,40 @@ THREAD_DECLARE  TX_THREAD *     _tx_thread_performance_execute_log[TX_THREAD_EXE
 
 #endif
 
+#ifdef TX_THREAD_ENABLE_EDF
+
+/* Define the total number of deadline misses of earliest-deadline-first threads.  Each time
+   a thread completes a job after its absolute deadline this variable is incremented.  */
+
+THREAD_DECLARE  ULONG           _tx_thread_edf_miss_count;
+
+#endif
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+/* Define the budget thread, which demotes or suspends threads that exhausted their CPU
+   budget and restores them when the budget is replenished.  */
+
+THREAD_DECLARE  TX_THREAD       _tx_thread_budget_thread;
+
+
+/* Define the stack of the budget thread.  */
+
+THREAD_DECLARE  ULONG           _tx_thread_budget_thread_stack_area[(((UINT) TX_THREAD_BUDGET_THREAD_STACK_SIZE)+((sizeof(ULONG)) - ((UINT) 1)))/sizeof(ULONG)];
+
+
+/* Define the list of threads waiting for the budget thread and the list of threads
+   waiting for the replenishment of their budget.  */
+
+THREAD_DECLARE  TX_THREAD *     _tx_thread_budget_pending_list;
+THREAD_DECLARE  TX_THREAD *     _tx_thread_budget_enforced_list;
+
+
+/* Define the total number of times a CPU budget was exhausted.  */
+
+THREAD_DECLARE  ULONG           _tx_thread_budget_exhaustion_count;
+
+#endif
+
 #endif
 
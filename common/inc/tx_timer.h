@@ -54,9 +54,69 @@
 /* Define timer management specific data definitions.  */
 
 #define TX_TIMER_ID                             ((ULONG) 0x4154494D)
+#define TX_TIMER_SERVICE_ID                     ((ULONG) 0x54535256)
 #define TX_TIMER_ENTRIES                        ((ULONG) 32)
 
 
+/* Define the cascade list constants.  Each cascade level covers TX_TIMER_ENTRIES
+   times the span of the level below it, so the shift value must match the
+   number of timer entries.  */
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+#ifndef TX_TIMER_CASCADE_LEVELS
+#define TX_TIMER_CASCADE_LEVELS                 3
+#endif
+#if (TX_TIMER_CASCADE_LEVELS < 1) || (TX_TIMER_CASCADE_LEVELS > 5)
+#error "TX_TIMER_CASCADE_LEVELS must be between 1 and 5."
+#endif
+#define TX_TIMER_CASCADE_SHIFT                  ((UINT) 5)
+#endif
+
+
+/* Define the check for the 64-bit system clock.  The timer interrupt of the port must
+   carry into the upper 32 bits, which the port indicates by defining
+   TX_PORT_TIMER_64BIT_CLOCK in tx_port.h.  */
+
+#if defined(TX_TIMER_ENABLE_64BIT_CLOCK) && !defined(TX_PORT_TIMER_64BIT_CLOCK)
+#error "TX_TIMER_ENABLE_64BIT_CLOCK is not supported by this port."
+#endif
+
+
+/* Define the macro that marks an entry of the timer list as in use.  The map is
+   only updated when a timer is placed on an empty entry.  Entries that become
+   empty again are cleared when the map is searched.  */
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+#ifdef TX_TIMER_ENABLE_CASCADE
+#define TX_TIMER_LIST_MAP_SET(l)                                                                                             \
+    if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(l) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_start)) && \
+        (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(l) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end)))      \
+    {                                                                                                                        \
+        _tx_timer_list_map =  _tx_timer_list_map | (((ULONG) 1) << TX_TIMER_POINTER_DIF((l), _tx_timer_list_start));         \
+    }
+#else
+#define TX_TIMER_LIST_MAP_SET(l)    _tx_timer_list_map =  _tx_timer_list_map | (((ULONG) 1) << TX_TIMER_POINTER_DIF((l), _tx_timer_list_start));
+#endif
+#else
+#define TX_TIMER_LIST_MAP_SET(l)
+#endif
+
+
+/* Define the high-resolution timer services of the port.  The port returns the current
+   high-resolution time in nanoseconds with TX_TIMER_HIGH_RESOLUTION_TIME_GET and programs
+   its one-shot timer for an absolute expiration time with TX_TIMER_HIGH_RESOLUTION_SET.  An
+   expiration time of zero stops the one-shot timer.  When the one-shot timer expires, the
+   port calls _tx_timer_high_resolution_expiration_process from interrupt context.  The
+   length of a timer tick in nanoseconds is used to report high-resolution timers in ticks.  */
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+#if !defined(TX_TIMER_HIGH_RESOLUTION_TIME_GET) || !defined(TX_TIMER_HIGH_RESOLUTION_SET)
+#error "TX_TIMER_ENABLE_HIGH_RESOLUTION is not supported by this port."
+#endif
+#define TX_TIMER_HIGH_RESOLUTION_TICK_NANOSECONDS   (((ULONG64) 1000000000) / ((ULONG64) TX_TIMER_TICKS_PER_SECOND))
+#endif
+
+
 /* Define internal timer management function prototypes.  */
 
 VOID        _tx_timer_expiration_process(VOID);
@@ -64,6 +124,26 @@ VOID        _tx_timer_initialize(VOID);
 VOID        _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_system_deactivate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
+#ifdef TX_TIMER_ENABLE_CASCADE
+TX_TIMER_INTERNAL **_tx_timer_cascade_list_get(TX_TIMER_INTERNAL *timer_ptr);
+VOID        _tx_timer_cascade_process(ULONG timeout_input);
+ULONG       _tx_timer_cascade_remaining_get(TX_TIMER_INTERNAL *timer_ptr);
+#endif
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+ULONG       _tx_timer_list_map_search(ULONG *list_map_ptr, TX_TIMER_INTERNAL **list_start, ULONG base, ULONG offset);
+#endif
+#ifdef TX_TIMER_ENABLE_SLACK
+VOID        _tx_timer_slack_apply(TX_TIMER_INTERNAL *timer_ptr);
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+VOID        _tx_timer_high_resolution_expiration_process(VOID);
+VOID        _tx_timer_high_resolution_system_activate(TX_TIMER_INTERNAL *timer_ptr);
+#endif
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+VOID        _tx_timer_service_cancel(TX_TIMER *timer_ptr);
+VOID        _tx_timer_service_dispatch(ULONG timeout_input);
+VOID        _tx_timer_service_thread_entry(ULONG service_thread_input);
+#endif
 
 
 /* Timer management component data declarations follow.  */
@@ -85,6 +165,16 @@ VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
 TIMER_DECLARE volatile ULONG    _tx_timer_system_clock;
 
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+/* Define the upper 32 bits of the 64-bit system clock.  The timer interrupt
+   processing of the port increments it whenever the system clock wraps
+   around.  */
+
+TIMER_DECLARE ULONG             _tx_timer_system_clock_upper;
+#endif
+
+
 /* Define the current time slice value.  If non-zero, a time-slice is active.
    Otherwise, the time_slice is not active.  */
 
@@ -116,6 +206,25 @@ TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_list_end;
 TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_current_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the map of timer list entries in use.  Bit n is set when a timer is
+   placed on entry n of the timer list.  Bits of entries that have become empty
+   since are cleared when the map is searched.  */
+
+TIMER_DECLARE ULONG             _tx_timer_list_map;
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define the high-resolution timer list.  It holds all active high-resolution
+   timers, sorted by expiration time, the first one to expire at the head.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_high_resolution_list;
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer
    has expired.  */
 
@@ -132,11 +241,78 @@ TIMER_DECLARE TX_TIMER          *_tx_timer_created_ptr;
 TIMER_DECLARE ULONG             _tx_timer_created_count;
 
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+/* Define the created timer service list head pointer.  */
+
+TIMER_DECLARE TX_TIMER_SERVICE  *_tx_timer_service_created_ptr;
+
+
+/* Define the created timer service count.  */
+
+TIMER_DECLARE ULONG             _tx_timer_service_created_count;
+#endif
+
+
 /* Define the pointer to the timer that has expired and is being processed.  */
 
 TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_expired_timer_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+/* Define the cascade lists for timers that expire beyond the timer list.  The
+   first level holds one entry per pass through the timer list, and each higher
+   level holds one entry per full pass of the level below it.  A timer on a
+   cascade list keeps its expiration time, on the cascade clock, in its
+   remaining ticks.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_cascade_list[TX_TIMER_CASCADE_LEVELS][TX_TIMER_ENTRIES];
+
+
+/* Define the boundary pointers to the cascade lists.  These are used to identify
+   timers that are on a cascade list.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_cascade_list_start;
+TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_cascade_list_end;
+
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the maps of cascade list entries in use, one for each level.  They are
+   maintained in the same way as the map of the timer list.  */
+
+TIMER_DECLARE ULONG             _tx_timer_cascade_map[TX_TIMER_CASCADE_LEVELS];
+#endif
+
+
+/* Define the cascade clock value at which the next pass through the timer list
+   starts.  The cascade lists are processed relative to this time.  */
+
+TIMER_DECLARE ULONG             _tx_timer_cascade_time;
+
+
+/* Define the flag that indicates the cascade timer is in use.  */
+
+TIMER_DECLARE UINT              _tx_timer_cascade_active;
+
+
+/* Define the offset of the system clock from the clock used by the cascade
+   lists.  It is adjusted when the system clock is set, so the expiration
+   times of the cascaded timers remain valid.  */
+
+TIMER_DECLARE ULONG             _tx_timer_cascade_offset;
+
+
+/* Define the internal timer that moves timers from the cascade lists into the
+   timer list at the start of each pass.  It is only active while any timer is
+   on a cascade list.  */
+
+TIMER_DECLARE TX_TIMER          _tx_timer_cascade_timer;
+
+#endif
+
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
 /* Define the timer thread's control block.  */
@@ -172,6 +348,20 @@ TIMER_DECLARE UINT              _tx_timer_processing_active;
 
 #endif
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+/* Define the total number of expirations moved within the slack of a timer.  */
+
+TIMER_DECLARE  ULONG            _tx_timer_slack_deferral_count;
+
+
+/* Define the total number of expirations placed on a timer list entry that
+   already holds a timer, which saves a timer wakeup.  */
+
+TIMER_DECLARE  ULONG            _tx_timer_slack_coalesce_count;
+
+#endif
+
 #ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of timer activations.  */
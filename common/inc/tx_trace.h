@@ -193,6 +193,8 @@ typedef struct TX_TRACE_HEADER_STRUCT
 #define TX_TRACE_OBJECT_TYPE_EVENT_FLAGS                    ((UCHAR) 6)     /* none                                              */
 #define TX_TRACE_OBJECT_TYPE_BLOCK_POOL                     ((UCHAR) 7)     /* P1 = total blocks, P2 = block size                */
 #define TX_TRACE_OBJECT_TYPE_BYTE_POOL                      ((UCHAR) 8)     /* P1 = total bytes                                  */
+#define TX_TRACE_OBJECT_TYPE_RWLOCK                         ((UCHAR) 9)     /* P1 = priority inheritance flag                    */
+#define TX_TRACE_OBJECT_TYPE_BARRIER                        ((UCHAR) 10)    /* P1 = thread count                                 */
 
 
 typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
@@ -349,6 +351,20 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_TIMER_INFO_GET                             127         /* I1 = timer ptr, I2 = stack ptr                                           */
 #define TX_TRACE_TIMER_PERFORMANCE_INFO_GET                 128         /* I1 = timer ptr                                                           */
 #define TX_TRACE_TIMER_PERFORMANCE_SYSTEM_INFO_GET          129         /* None                                                                     */
+#define TX_TRACE_RWLOCK_CREATE                              130         /* I1 = rwlock ptr, I2 = inheritance, I3 = stack ptr                        */
+#define TX_TRACE_RWLOCK_DELETE                              131         /* I1 = rwlock ptr, I2 = stack ptr                                          */
+#define TX_TRACE_RWLOCK_INFO_GET                            132         /* I1 = rwlock ptr                                                          */
+#define TX_TRACE_RWLOCK_PERFORMANCE_INFO_GET                133         /* I1 = rwlock ptr                                                          */
+#define TX_TRACE_RWLOCK_PERFORMANCE_SYSTEM_INFO_GET         134         /* None                                                                     */
+#define TX_TRACE_RWLOCK_PUT                                 135         /* I1 = rwlock ptr, I2 = writer thread, I3 = reader count, I4 = stack ptr   */
+#define TX_TRACE_RWLOCK_READ_GET                            136         /* I1 = rwlock ptr, I2 = wait option, I3 = writer thread, I4 = reader count */
+#define TX_TRACE_RWLOCK_WRITE_GET                           137         /* I1 = rwlock ptr, I2 = wait option, I3 = writer thread, I4 = reader count */
+#define TX_TRACE_BARRIER_CREATE                             138         /* I1 = barrier ptr, I2 = thread count, I3 = stack ptr                      */
+#define TX_TRACE_BARRIER_DELETE                             139         /* I1 = barrier ptr, I2 = stack ptr                                         */
+#define TX_TRACE_BARRIER_INFO_GET                           140         /* I1 = barrier ptr                                                         */
+#define TX_TRACE_BARRIER_PERFORMANCE_INFO_GET               141         /* I1 = barrier ptr                                                         */
+#define TX_TRACE_BARRIER_PERFORMANCE_SYSTEM_INFO_GET        142         /* None                                                                     */
+#define TX_TRACE_BARRIER_WAIT                               143         /* I1 = barrier ptr, I2 = wait option, I3 = suspended count, I4 = thread cnt*/
 
 
 /* Define the an Trace Buffer Entry.  */
@@ -152,6 +152,89 @@
 #define TX_REACTIVATE_INLINE
 */
 
+/* Determine if cascading timer lists are used for timers that expire beyond the timer list.
+   By default, such timers are placed at the end of the timer list and reinserted on every pass
+   through it. When the following is defined, they are placed on TX_TIMER_CASCADE_LEVELS levels
+   of cascade lists (3 by default, at most 5) and are only moved once per level, which reduces
+   the timer processing for large numbers of long timeouts.  */
+
+/*
+#define TX_TIMER_ENABLE_CASCADE
+#define TX_TIMER_CASCADE_LEVELS                 3
+*/
+
+/* Determine if the timer list entries in use are tracked. When the following is defined, ThreadX
+   keeps a map of the timer list entries that hold timers, which allows tx_timer_get_next and
+   tx_time_increment of the low power utility to find the next expiration without examining
+   every entry and every active timer.  */
+
+/*
+#define TX_TIMER_ENABLE_LIST_MAP
+*/
+
+/* Determine if timer coalescing is enabled. When the following is defined, tx_timer_slack_set sets
+   the number of ticks each expiration of an application timer may be delayed. ThreadX then moves the
+   expiration within this slack onto a tick that is shared with other timers, which reduces the number
+   of timer wakeups. Note that the period of a periodic timer with a slack is stretched by up to the
+   slack. The deferred and coalesced expirations are reported by tx_timer_slack_system_info_get.  */
+
+/*
+#define TX_TIMER_ENABLE_SLACK
+*/
+
+/* Determine if high-resolution timers are enabled. When the following is defined, the
+   tx_timer_high_resolution_activate and tx_thread_sleep_ns services are available. They take
+   expiration times in nanoseconds, which are driven by a one-shot timer of the port instead
+   of the periodic timer tick, so short deadlines do not require a higher tick rate. The
+   expiration functions of high-resolution timers are called from interrupt context. This
+   option requires ULONG64 and the high-resolution timer services of the port.  */
+
+/*
+#define TX_TIMER_ENABLE_HIGH_RESOLUTION
+*/
+
+/* Determine if the 64-bit system clock is enabled. When the following is defined, the timer
+   interrupt carries into the upper 32 bits of the system clock whenever tx_time_get wraps
+   around, and tx_time_get64 returns the full 64-bit tick count. This option requires ULONG64
+   and a port whose timer interrupt supports it.  */
+
+/*
+#define TX_TIMER_ENABLE_64BIT_CLOCK
+*/
+
+/* Determine if timer service threads are enabled. When the following is defined, the application
+   can create additional timer threads at their own priorities with tx_timer_service_create, and
+   bind application timers to them with tx_timer_service_bind. The expiration functions of bound
+   timers are called by their timer service thread instead of the system timer thread, so a slow
+   expiration function only delays the timers of its own timer service. The expiration lag of each
+   timer service is reported by tx_timer_service_info_get.  */
+
+/*
+#define TX_TIMER_ENABLE_SERVICE_THREADS
+*/
+
+/* Determine if the earliest-deadline-first scheduling band is enabled. When the following is
+   defined, ready threads of priority TX_THREAD_EDF_PRIORITY (16 by default) that have a deadline
+   set by tx_thread_edf_set are ordered by their absolute deadline, and tx_thread_edf_period_wait
+   counts the jobs that completed after their deadline. This option is not available for SMP.  */
+
+/*
+#define TX_THREAD_ENABLE_EDF
+#define TX_THREAD_EDF_PRIORITY                  16
+*/
+
+/* Determine if CPU budgets are enabled. When the following is defined, tx_thread_budget_set limits
+   the number of ticks a thread may execute in each budget period. A thread that exhausts its budget
+   is demoted or suspended by the budget thread until its budget is replenished. The budget thread
+   has the stack size and priority of the timer thread, unless they are defined below. This option
+   requires a port whose timer interrupt supports it and is not available for SMP.  */
+
+/*
+#define TX_THREAD_ENABLE_BUDGET
+#define TX_THREAD_BUDGET_THREAD_STACK_SIZE      ????
+#define TX_THREAD_BUDGET_THREAD_PRIORITY        ????
+*/
+
 /* Determine is stack filling is enabled. By default, ThreadX stack filling is enabled,
    which places an 0xEF pattern in each byte of each thread's stack.  This is used by
    debuggers with ThreadX-awareness and by the ThreadX run-time stack checking feature.  */
@@ -262,6 +345,29 @@
 #define TX_MUTEX_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if the uncontended mutex fast path is enabled. When the following is defined, a thread
+   that gets a free mutex, or puts a mutex nobody is waiting for, only disables preemption instead of
+   interrupts. Such gets and puts are not traced and are not counted by the mutex performance
+   information. This option is not available for SMP.  */
+
+/*
+#define TX_MUTEX_ENABLE_FAST_PATH
+*/
+
+/* Determine if reader-writer lock performance gathering is required by the application. When the
+   following is defined, ThreadX gathers various reader-writer lock performance information. */
+
+/*
+#define TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+*/
+
+/* Determine if barrier performance gathering is required by the application. When the following is
+   defined, ThreadX gathers various barrier performance information. */
+
+/*
+#define TX_BARRIER_ENABLE_PERFORMANCE_INFO
+*/
+
 /* Determine if queue performance gathering is required by the application. When the following is
    defined, ThreadX gathers various queue performance information. */
 
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_barrier.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_barrier_create                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a barrier that releases its waiting threads   */
+/*    once the specified number of threads have arrived.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    barrier_ptr                           Pointer to barrier control    */
+/*                                            block                       */
+/*    name_ptr                              Pointer to barrier name       */
+/*    thread_count                          Number of threads to release  */
+/*                                            the barrier                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_barrier_create(TX_BARRIER *barrier_ptr, CHAR *name_ptr, UINT thread_count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BARRIER      *next_barrier;
+TX_BARRIER      *previous_barrier;
+
+
+    /* Initialize barrier control block to all zeros.  */
+    TX_MEMSET(barrier_ptr, 0, (sizeof(TX_BARRIER)));
+
+    /* Setup the basic barrier fields.  */
+    barrier_ptr -> tx_barrier_name =            name_ptr;
+    barrier_ptr -> tx_barrier_thread_count =    thread_count;
+
+    /* Disable interrupts to place the barrier on the created list.  */
+    TX_DISABLE
+
+    /* Setup the barrier ID to make it valid.  */
+    barrier_ptr -> tx_barrier_id =  TX_BARRIER_ID;
+
+    /* Place the barrier on the list of created barriers.  First,
+       check for an empty list.  */
+    if (_tx_barrier_created_count == TX_EMPTY)
+    {
+
+        /* The created barrier list is empty.  Add barrier to empty list.  */
+        _tx_barrier_created_ptr =                       barrier_ptr;
+        barrier_ptr -> tx_barrier_created_next =        barrier_ptr;
+        barrier_ptr -> tx_barrier_created_previous =    barrier_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_barrier =      _tx_barrier_created_ptr;
+        previous_barrier =  next_barrier -> tx_barrier_created_previous;
+
+        /* Place the new barrier in the list.  */
+        next_barrier -> tx_barrier_created_previous =  barrier_ptr;
+        previous_barrier -> tx_barrier_created_next =  barrier_ptr;
+
+        /* Setup this barrier's next and previous created links.  */
+        barrier_ptr -> tx_barrier_created_previous =  previous_barrier;
+        barrier_ptr -> tx_barrier_created_next =      next_barrier;
+    }
+
+    /* Increment the created count.  */
+    _tx_barrier_created_count++;
+
+    /* Optional barrier create extended processing.  */
+    TX_BARRIER_CREATE_EXTENSION(barrier_ptr)
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_BARRIER, barrier_ptr, name_ptr, thread_count, 0)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BARRIER_CREATE, barrier_ptr, thread_count, TX_POINTER_TO_ULONG_CONVERT(&next_barrier), 0, TX_TRACE_BARRIER_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BARRIER_CREATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_barrier.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_barrier_info_get                                PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified barrier.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    barrier_ptr                       Pointer to barrier control block  */
+/*    name                              Destination for the barrier name  */
+/*    thread_count                      Destination for the number of     */
+/*                                        threads that release barrier    */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on barrier     */
+/*    suspended_count                   Destination for number of threads */
+/*                                        suspended on barrier            */
+/*    next_barrier                      Destination for pointer to next   */
+/*                                        barrier on the created list     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_barrier_info_get(TX_BARRIER *barrier_ptr, CHAR **name, ULONG *thread_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BARRIER **next_barrier)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BARRIER_INFO_GET, barrier_ptr, 0, 0, 0, TX_TRACE_BARRIER_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BARRIER_INFO_GET_INSERT
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the barrier.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  barrier_ptr -> tx_barrier_name;
+    }
+
+    /* Retrieve the number of threads that release the barrier.  */
+    if (thread_count != TX_NULL)
+    {
+
+        *thread_count =  (ULONG) barrier_ptr -> tx_barrier_thread_count;
+    }
+
+    /* Retrieve the first thread suspended on this barrier.  */
+    if (first_suspended != TX_NULL)
+    {
+
+        *first_suspended =  barrier_ptr -> tx_barrier_suspension_list;
+    }
+
+    /* Retrieve the number of threads suspended on this barrier.  */
+    if (suspended_count != TX_NULL)
+    {
+
+        *suspended_count =  (ULONG) barrier_ptr -> tx_barrier_suspended_count;
+    }
+
+    /* Retrieve the pointer to the next barrier created.  */
+    if (next_barrier != TX_NULL)
+    {
+
+        *next_barrier =  barrier_ptr -> tx_barrier_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_barrier.h"
+
+
+#ifndef TX_INLINE_INITIALIZATION
+
+/* Locate barrier component data in this file.  */
+
+/* Define the head pointer of the created barrier list.  */
+
+TX_BARRIER *  _tx_barrier_created_ptr;
+
+
+/* Define the variable that holds the number of created barriers. */
+
+ULONG         _tx_barrier_created_count;
+
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+/* Define the total number of barrier waits.  */
+
+ULONG         _tx_barrier_performance_wait_count;
+
+
+/* Define the total number of barrier releases.  */
+
+ULONG         _tx_barrier_performance_release_count;
+
+
+/* Define the total number of barrier suspensions.  */
+
+ULONG         _tx_barrier_performance_suspension_count;
+
+
+/* Define the total number of barrier timeouts.  */
+
+ULONG         _tx_barrier_performance_timeout_count;
+
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_barrier_initialize                              PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the various control data structures for   */
+/*    the barrier component.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_high_level         High level initialization         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_barrier_initialize(VOID)
+{
+
+#ifndef TX_DISABLE_REDUNDANT_CLEARING
+
+    /* Initialize the head pointer of the created barriers list and the
+       number of barriers created.  */
+    _tx_barrier_created_ptr =       TX_NULL;
+    _tx_barrier_created_count =     TX_EMPTY;
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+    /* Initialize the barrier performance counters.  */
+    _tx_barrier_performance_wait_count =        ((ULONG) 0);
+    _tx_barrier_performance_release_count =     ((ULONG) 0);
+    _tx_barrier_performance_suspension_count =  ((ULONG) 0);
+    _tx_barrier_performance_timeout_count =     ((ULONG) 0);
+#endif
+#endif
+}
+#endif
+
@@ -0,0 +1,185 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Mutex                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_fast_get                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function attempts to get the specified mutex without locking   */
+/*    out interrupts.  Only threads manipulate mutex ownership, so on a   */
+/*    single processor it is sufficient to disable preemption while the   */
+/*    mutex is claimed.  If the mutex is owned by another thread, the     */
+/*    caller must be raised to the mutex's priority ceiling, or the       */
+/*    caller is not a thread, TX_NOT_DONE is returned and the caller      */
+/*    must use the regular processing in _tx_mutex_get.  Gets satisfied   */
+/*    here are not traced or counted by the performance information.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Mutex obtained                    */
+/*    TX_NOT_DONE                       Regular processing required       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_get                     Get mutex                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_mutex_fast_get(TX_MUTEX *mutex_ptr)
+{
+
+TX_THREAD       *thread_ptr;
+TX_MUTEX        *next_mutex;
+TX_MUTEX        *previous_mutex;
+UINT            status;
+
+
+    /* Default the status to indicate regular processing is required.  */
+    status =  TX_NOT_DONE;
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Only threads may use the fast path.  */
+    if ((thread_ptr != TX_NULL) && (TX_THREAD_GET_SYSTEM_STATE() == ((ULONG) 0)))
+    {
+
+        /* Disable preemption so no other thread can examine or change the
+           mutex while it is claimed.  Interrupts remain enabled, any
+           changes an ISR makes to the preemption flag are balanced.  */
+        _tx_thread_preempt_disable++;
+
+        /* Determine if this mutex is available and does not require a change
+           to the priority of the owner.  */
+        if ((mutex_ptr -> tx_mutex_ownership_count == ((UINT) 0)) &&
+            (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) >= thread_ptr -> tx_thread_inherit_priority))
+        {
+
+            /* Set the ownership count to 1.  */
+            mutex_ptr -> tx_mutex_ownership_count =  ((UINT) 1);
+
+            /* Remember that the calling thread owns the mutex.  */
+            mutex_ptr -> tx_mutex_owner =  thread_ptr;
+
+            /* Determine if priority inheritance is required.  */
+            if (mutex_ptr -> tx_mutex_inherit == TX_TRUE)
+            {
+
+                /* Remember the current priority of thread.  */
+                mutex_ptr -> tx_mutex_original_priority =   thread_ptr -> tx_thread_priority;
+
+                /* Setup the highest priority waiting thread.  */
+                mutex_ptr -> tx_mutex_highest_priority_waiting =  ((UINT) TX_MAX_PRIORITIES);
+            }
+
+            /* Pickup next mutex pointer, which is the head of the list.  */
+            next_mutex =  thread_ptr -> tx_thread_owned_mutex_list;
+
+            /* Determine if this thread owns any other mutexes.  */
+            if (next_mutex != TX_NULL)
+            {
+
+                /* Non-empty list. Link up the mutex.  */
+
+                /* Pickup the next and previous mutex pointer.  */
+                previous_mutex =  next_mutex -> tx_mutex_owned_previous;
+
+                /* Place the owned mutex in the list.  */
+                next_mutex -> tx_mutex_owned_previous =  mutex_ptr;
+                previous_mutex -> tx_mutex_owned_next =  mutex_ptr;
+
+                /* Setup this mutex's next and previous created links.  */
+                mutex_ptr -> tx_mutex_owned_previous =  previous_mutex;
+                mutex_ptr -> tx_mutex_owned_next =      next_mutex;
+            }
+            else
+            {
+
+                /* The owned mutex list is empty.  Add mutex to empty list.  */
+                thread_ptr -> tx_thread_owned_mutex_list =     mutex_ptr;
+                mutex_ptr -> tx_mutex_owned_next =             mutex_ptr;
+                mutex_ptr -> tx_mutex_owned_previous =         mutex_ptr;
+            }
+
+            /* Increment the number of mutexes owned counter.  */
+            thread_ptr -> tx_thread_owned_mutex_count++;
+
+            /* Return success.  */
+            status =  TX_SUCCESS;
+        }
+
+        /* Otherwise, see if the owning thread is trying to obtain the same mutex.  */
+        else if (mutex_ptr -> tx_mutex_owner == thread_ptr)
+        {
+
+            /* The owning thread is requesting the mutex again, just
+               increment the ownership count.  */
+            mutex_ptr -> tx_mutex_ownership_count++;
+
+            /* Return success.  */
+            status =  TX_SUCCESS;
+        }
+
+        /* Release the preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Check for preemption, an ISR may have readied a higher priority
+           thread in the meantime.  */
+        _tx_thread_system_preempt_check();
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,172 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Mutex                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_fast_put                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function attempts to release the specified mutex without       */
+/*    locking out interrupts.  Only nested releases and the release of a  */
+/*    mutex without priority inheritance, without a priority ceiling,     */
+/*    and without waiting threads are handled here.  In all other cases   */
+/*    TX_NOT_DONE is returned and the caller must use the regular         */
+/*    processing in _tx_mutex_put.  Puts completed here are not traced    */
+/*    or counted by the performance information.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Mutex released                    */
+/*    TX_NOT_DONE                       Regular processing required       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_put                     Put mutex                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_mutex_fast_put(TX_MUTEX *mutex_ptr)
+{
+
+TX_THREAD       *thread_ptr;
+TX_MUTEX        *next_mutex;
+TX_MUTEX        *previous_mutex;
+UINT            status;
+
+
+    /* Default the status to indicate regular processing is required.  */
+    status =  TX_NOT_DONE;
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Only threads may use the fast path.  */
+    if ((thread_ptr != TX_NULL) && (TX_THREAD_GET_SYSTEM_STATE() == ((ULONG) 0)))
+    {
+
+        /* Disable preemption so no other thread can examine or change the
+           mutex while it is released.  */
+        _tx_thread_preempt_disable++;
+
+        /* Determine if the calling thread owns this mutex.  */
+        if ((mutex_ptr -> tx_mutex_ownership_count != ((UINT) 0)) && (mutex_ptr -> tx_mutex_owner == thread_ptr))
+        {
+
+            /* Determine if this is a nested release.  */
+            if (mutex_ptr -> tx_mutex_ownership_count != ((UINT) 1))
+            {
+
+                /* Decrement the mutex ownership count.  */
+                mutex_ptr -> tx_mutex_ownership_count--;
+
+                /* Mutex is still owned, return successful status.  */
+                status =  TX_SUCCESS;
+            }
+
+            /* Determine if the simple, non-suspension, non-priority inheritance, non-ceiling case is present.  */
+            else if ((mutex_ptr -> tx_mutex_suspension_list == TX_NULL) && (mutex_ptr -> tx_mutex_inherit == TX_FALSE))
+            {
+
+                /* Clear the mutex ownership count.  */
+                mutex_ptr -> tx_mutex_ownership_count =  ((UINT) 0);
+
+                /* Decrement the ownership count.  */
+                thread_ptr -> tx_thread_owned_mutex_count--;
+
+                /* Determine if this mutex was the only one on the list.  */
+                if (thread_ptr -> tx_thread_owned_mutex_count == ((UINT) 0))
+                {
+
+                    /* Yes, the list is empty.  Simply set the head pointer to NULL.  */
+                    thread_ptr -> tx_thread_owned_mutex_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* No, there are more mutexes on the list.  */
+
+                    /* Link-up the neighbors.  */
+                    next_mutex =                             mutex_ptr -> tx_mutex_owned_next;
+                    previous_mutex =                         mutex_ptr -> tx_mutex_owned_previous;
+                    next_mutex -> tx_mutex_owned_previous =  previous_mutex;
+                    previous_mutex -> tx_mutex_owned_next =  next_mutex;
+
+                    /* See if we have to update the created list head pointer.  */
+                    if (thread_ptr -> tx_thread_owned_mutex_list == mutex_ptr)
+                    {
+
+                        /* Yes, move the head pointer to the next link. */
+                        thread_ptr -> tx_thread_owned_mutex_list =  next_mutex;
+                    }
+                }
+
+                /* Set the mutex owner to NULL.   */
+                mutex_ptr -> tx_mutex_owner =  TX_NULL;
+
+                /* Mutex is now available, return successful status.  */
+                status =  TX_SUCCESS;
+            }
+        }
+
+        /* Release the preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Check for preemption, an ISR may have readied a higher priority
+           thread in the meantime.  */
+        _tx_thread_system_preempt_check();
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -45,6 +45,8 @@
 /*                                                                        */
 /*    This function gets the specified mutex.  If the calling thread      */
 /*    already owns the mutex, an ownership count is simply increased.     */
+/*    The owner of a priority ceiling mutex is raised to the ceiling      */
+/*    priority when the mutex is obtained.                                */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -57,9 +59,11 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_suspend         Suspend thread service            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
-/*    _tx_mutex_priority_change         Inherit thread priority           */
+/*    _tx_mutex_priority_change         Inherit or ceiling priority       */
+/*    _tx_mutex_fast_get                Uncontended mutex get             */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -88,6 +92,20 @@ TX_THREAD       *previous_thread;
 UINT            status;
 
 
+#ifdef TX_MUTEX_ENABLE_FAST_PATH
+
+    /* Try to obtain the mutex without locking out interrupts first.  */
+    status =  _tx_mutex_fast_get(mutex_ptr);
+
+    /* Determine if the mutex was obtained.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Yes, return success.  */
+        return(status);
+    }
+#endif
+
     /* Disable interrupts to get an instance from the mutex.  */
     TX_DISABLE
 
@@ -165,6 +183,53 @@ UINT            status;
 
             /* Increment the number of mutexes owned counter.  */
             thread_ptr -> tx_thread_owned_mutex_count++;
+
+            /* Determine if the ceiling must be kept while the mutex is owned.  */
+            if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_inherit_priority)
+            {
+
+                /* Yes, remember the ceiling so priority changes cannot drop below it.  */
+                thread_ptr -> tx_thread_inherit_priority =  TX_MUTEX_CEILING_PRIORITY(mutex_ptr);
+            }
+
+            /* Determine if the owner must be raised to the ceiling priority.  */
+            if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_priority)
+            {
+
+                /* Remember the current priority of thread.  */
+                mutex_ptr -> tx_mutex_original_priority =   thread_ptr -> tx_thread_priority;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Raise the owner to the ceiling priority.  */
+                _tx_mutex_priority_change(thread_ptr, TX_MUTEX_CEILING_PRIORITY(mutex_ptr));
+#else
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Raise the owner to the ceiling priority.  */
+                _tx_mutex_priority_change(thread_ptr, TX_MUTEX_CEILING_PRIORITY(mutex_ptr));
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Release the temporary preemption disable.  */
+                _tx_thread_preempt_disable--;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Check for preemption.  */
+                _tx_thread_system_preempt_check();
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+            }
         }
 
         /* Restore interrupts.  */
@@ -59,6 +59,7 @@
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_mutex_priority_change         Restore previous thread priority  */
+/*    _tx_mutex_fast_put                Uncontended mutex put             */
 /*    _tx_mutex_prioritize              Prioritize the mutex suspension   */
 /*    _tx_mutex_thread_release          Release all thread's mutexes      */
 /*    _tx_mutex_delete                  Release ownership upon mutex      */
@@ -97,6 +98,20 @@ TX_THREAD       *suspended_thread;
 UINT            inheritance_priority;
 
 
+#ifdef TX_MUTEX_ENABLE_FAST_PATH
+
+    /* Try to release the mutex without locking out interrupts first.  */
+    status =  _tx_mutex_fast_put(mutex_ptr);
+
+    /* Determine if the mutex was released.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Yes, return success.  */
+        return(status);
+    }
+#endif
+
     /* Setup status to indicate the processing is not complete.  */
     status =  TX_NOT_DONE;
 
@@ -219,7 +234,7 @@ UINT            inheritance_priority;
                     if (mutex_ptr -> tx_mutex_suspension_list == TX_NULL)
                     {
 
-                        /* Is this a priority inheritance mutex?  */
+                        /* Is this a mutex without priority inheritance or a priority ceiling?  */
                         if (mutex_ptr -> tx_mutex_inherit == TX_FALSE)
                         {
 
@@ -242,8 +257,8 @@ UINT            inheritance_priority;
                         old_owner =      TX_NULL;
                         old_priority =   thread_ptr -> tx_thread_user_priority;
 
-                        /* Does this mutex support priority inheritance?  */
-                        if (mutex_ptr -> tx_mutex_inherit == TX_TRUE)
+                        /* Does this mutex support priority inheritance or a priority ceiling?  */
+                        if ((mutex_ptr -> tx_mutex_inherit == TX_TRUE) || (mutex_ptr -> tx_mutex_inherit == TX_CEILING_PROTOCOL))
                         {
 
 #ifndef TX_NOT_INTERRUPTABLE
@@ -278,6 +293,14 @@ UINT            inheritance_priority;
                                     }
                                 }
 
+                                /* Determine if the ceiling of the mutex is higher than the priority to restore.  */
+                                if (TX_MUTEX_CEILING_PRIORITY(next_mutex) < inheritance_priority)
+                                {
+
+                                    /* Use this priority to return releasing thread to.  */
+                                    inheritance_priority =   TX_MUTEX_CEILING_PRIORITY(next_mutex);
+                                }
+
                                 /* Move mutex pointer to the next mutex in the list.  */
                                 next_mutex =  next_mutex -> tx_mutex_owned_next;
 
@@ -417,14 +440,14 @@ UINT            inheritance_priority;
                             /* Pickup the thread at the front of the suspension list.  */
                             thread_ptr =  mutex_ptr -> tx_mutex_suspension_list;
 
+                            /* Remember the old mutex owner.  */
+                            old_owner =  mutex_ptr -> tx_mutex_owner;
+
                             /* Save the previous ownership information, if inheritance is
                                in effect.  */
                             if (mutex_ptr -> tx_mutex_inherit == TX_TRUE)
                             {
 
-                                /* Remember the old mutex owner.  */
-                                old_owner =  mutex_ptr -> tx_mutex_owner;
-
                                 /* Setup owner thread priority information.  */
                                 mutex_ptr -> tx_mutex_original_priority =   thread_ptr -> tx_thread_priority;
 
@@ -469,6 +492,22 @@ UINT            inheritance_priority;
                             mutex_ptr -> tx_mutex_ownership_count =  (UINT) 1;
                             mutex_ptr -> tx_mutex_owner =            thread_ptr;
 
+                            /* Determine if the ceiling must be kept while the mutex is owned.  */
+                            if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_inherit_priority)
+                            {
+
+                                /* Yes, remember the ceiling so priority changes cannot drop below it.  */
+                                thread_ptr -> tx_thread_inherit_priority =  TX_MUTEX_CEILING_PRIORITY(mutex_ptr);
+                            }
+
+                            /* Determine if the new owner must be raised to the ceiling priority.  */
+                            if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_priority)
+                            {
+
+                                /* Remember the current priority of the new owner.  */
+                                mutex_ptr -> tx_mutex_original_priority =   thread_ptr -> tx_thread_priority;
+                            }
+
                             /* Remove the suspended thread from the list.  */
 
                             /* Decrement the suspension count.  */
@@ -561,6 +600,27 @@ UINT            inheritance_priority;
                                 }
                             }
 
+                            /* Determine if this is a priority ceiling mutex.  */
+                            else if (mutex_ptr -> tx_mutex_inherit == TX_CEILING_PROTOCOL)
+                            {
+
+                                /* Determine if the previous owner's priority must be restored.  */
+                                if (old_owner -> tx_thread_priority != old_priority)
+                                {
+
+                                    /* Restore the priority of thread.  */
+                                    _tx_mutex_priority_change(old_owner, old_priority);
+                                }
+
+                                /* Determine if the new owner must be raised to the ceiling priority.  */
+                                if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_priority)
+                                {
+
+                                    /* Raise the new owner to the ceiling priority.  */
+                                    _tx_mutex_priority_change(thread_ptr, TX_MUTEX_CEILING_PRIORITY(mutex_ptr));
+                                }
+                            }
+
                             /* Resume the thread!  */
                             _tx_thread_system_ni_resume(thread_ptr);
 
@@ -628,6 +688,27 @@ UINT            inheritance_priority;
                                 }
                             }
 
+                            /* Determine if this is a priority ceiling mutex.  */
+                            else if (mutex_ptr -> tx_mutex_inherit == TX_CEILING_PROTOCOL)
+                            {
+
+                                /* Determine if the previous owner's priority must be restored.  */
+                                if (old_owner -> tx_thread_priority != old_priority)
+                                {
+
+                                    /* Restore the priority of thread.  */
+                                    _tx_mutex_priority_change(old_owner, old_priority);
+                                }
+
+                                /* Determine if the new owner must be raised to the ceiling priority.  */
+                                if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_priority)
+                                {
+
+                                    /* Raise the new owner to the ceiling priority.  */
+                                    _tx_mutex_priority_change(thread_ptr, TX_MUTEX_CEILING_PRIORITY(mutex_ptr));
+                                }
+                            }
+
                             /* Resume thread.  */
                             _tx_thread_system_resume(thread_ptr);
 #endif
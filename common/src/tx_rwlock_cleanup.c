@@ -0,0 +1,520 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_cleanup                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes reader-writer lock timeout and thread       */
+/*    terminate actions that require the lock's suspension lists to be    */
+/*    cleaned up.  If the last waiting writer is removed while no writer  */
+/*    holds the lock, the waiting readers are released as well.  With     */
+/*    priority inheritance, the priority of the writer is recomputed      */
+/*    from the remaining waiting threads.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to suspended thread's     */
+/*                                        control block                   */
+/*    suspension_sequence               Suspension sequence number        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_mutex_priority_change         Change writer thread priority     */
+/*    _tx_rwlock_waiters_grant          Hand lock to waiting threads      */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_timeout                Thread timeout processing         */
+/*    _tx_thread_terminate              Thread terminate processing       */
+/*    _tx_thread_wait_abort             Thread wait abort processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_rwlock_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
+{
+
+#ifndef TX_NOT_INTERRUPTABLE
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+TX_RWLOCK           *rwlock_ptr;
+TX_THREAD           **list_head;
+UINT                *suspended_count;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+TX_THREAD           *resume_list;
+TX_THREAD           *writer_thread;
+TX_THREAD           *search_ptr;
+UINT                search_count;
+UINT                priority;
+
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+    /* Disable interrupts to remove the suspended thread from the lock.  */
+    TX_DISABLE
+
+    /* Determine if the cleanup is still required.  */
+    if (thread_ptr -> tx_thread_suspend_cleanup == &(_tx_rwlock_cleanup))
+    {
+
+        /* Check for valid suspension sequence.  */
+        if (suspension_sequence == thread_ptr -> tx_thread_suspension_sequence)
+        {
+
+            /* Setup pointer to reader-writer lock control block.  */
+            rwlock_ptr =  TX_VOID_TO_RWLOCK_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+
+            /* Check for a NULL reader-writer lock pointer.  */
+            if (rwlock_ptr != TX_NULL)
+            {
+
+                /* Check for a valid reader-writer lock ID.  */
+                if (rwlock_ptr -> tx_rwlock_id == TX_RWLOCK_ID)
+                {
+#else
+
+                    /* Setup pointer to reader-writer lock control block.  */
+                    rwlock_ptr =  TX_VOID_TO_RWLOCK_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+#endif
+
+                    /* Pickup the suspension list the thread is waiting on.  */
+                    if (thread_ptr -> tx_thread_suspend_option == TX_RWLOCK_WRITE)
+                    {
+
+                        /* The thread is waiting for write access.  */
+                        list_head =        &(rwlock_ptr -> tx_rwlock_write_suspension_list);
+                        suspended_count =  &(rwlock_ptr -> tx_rwlock_write_suspended_count);
+                    }
+                    else
+                    {
+
+                        /* The thread is waiting for read access.  */
+                        list_head =        &(rwlock_ptr -> tx_rwlock_read_suspension_list);
+                        suspended_count =  &(rwlock_ptr -> tx_rwlock_read_suspended_count);
+                    }
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+                    /* Determine if there are any thread suspensions.  */
+                    if (*suspended_count != TX_NO_SUSPENSIONS)
+                    {
+#endif
+
+                        /* Yes, we still have thread suspension!  */
+
+                        /* Clear the suspension cleanup flag.  */
+                        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                        /* Decrement the suspension count.  */
+                        *suspended_count =  *suspended_count - ((UINT) 1);
+
+                        /* Remove the suspended thread from the list.  */
+
+                        /* See if this is the only suspended thread on the list.  */
+                        if (*suspended_count == TX_NO_SUSPENSIONS)
+                        {
+
+                            /* Yes, the only suspended thread.  */
+
+                            /* Update the head pointer.  */
+                            *list_head =  TX_NULL;
+                        }
+                        else
+                        {
+
+                            /* At least one more thread is on the same suspension list.  */
+
+                            /* Update the links of the adjacent threads.  */
+                            next_thread =                                   thread_ptr -> tx_thread_suspended_next;
+                            previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                            next_thread -> tx_thread_suspended_previous =   previous_thread;
+                            previous_thread -> tx_thread_suspended_next =   next_thread;
+
+                            /* Determine if we need to update the head pointer.  */
+                            if (*list_head == thread_ptr)
+                            {
+
+                                /* Update the list head pointer.  */
+                                *list_head =  next_thread;
+                            }
+                        }
+
+                        /* Removing a waiting writer may allow the waiting readers to proceed.  */
+                        resume_list =  TX_NULL;
+                        if (thread_ptr -> tx_thread_suspend_option == TX_RWLOCK_WRITE)
+                        {
+
+                            /* Hand the lock to the waiting readers, if possible.  */
+                            resume_list =  _tx_rwlock_waiters_grant(rwlock_ptr);
+                        }
+
+                        /* Determine if the writer may have inherited the priority of this thread.  */
+                        writer_thread =  rwlock_ptr -> tx_rwlock_writer;
+                        priority =       ((UINT) TX_MAX_PRIORITIES);
+                        if ((rwlock_ptr -> tx_rwlock_inherit == TX_TRUE) && (writer_thread != TX_NULL))
+                        {
+
+                            /* Find the highest priority of the remaining waiting threads.  */
+                            search_ptr =    rwlock_ptr -> tx_rwlock_write_suspension_list;
+                            search_count =  rwlock_ptr -> tx_rwlock_write_suspended_count;
+                            while (search_count != TX_NO_SUSPENSIONS)
+                            {
+
+                                /* Is this thread of higher priority?  */
+                                if (search_ptr -> tx_thread_priority < priority)
+                                {
+
+                                    /* Yes, remember its priority.  */
+                                    priority =  search_ptr -> tx_thread_priority;
+                                }
+
+                                /* Move to the next waiting writer.  */
+                                search_ptr =  search_ptr -> tx_thread_suspended_next;
+                                search_count--;
+                            }
+
+                            search_ptr =    rwlock_ptr -> tx_rwlock_read_suspension_list;
+                            search_count =  rwlock_ptr -> tx_rwlock_read_suspended_count;
+                            while (search_count != TX_NO_SUSPENSIONS)
+                            {
+
+                                /* Is this thread of higher priority?  */
+                                if (search_ptr -> tx_thread_priority < priority)
+                                {
+
+                                    /* Yes, remember its priority.  */
+                                    priority =  search_ptr -> tx_thread_priority;
+                                }
+
+                                /* Move to the next waiting reader.  */
+                                search_ptr =  search_ptr -> tx_thread_suspended_next;
+                                search_count--;
+                            }
+
+                            /* Remember the highest priority waiting.  */
+                            rwlock_ptr -> tx_rwlock_highest_priority_waiting =  priority;
+
+                            /* The writer keeps its user priority, or a higher priority inherited
+                               from a mutex or from the remaining waiting threads.  */
+                            if (writer_thread -> tx_thread_user_priority < priority)
+                            {
+
+                                /* Use the user priority.  */
+                                priority =  writer_thread -> tx_thread_user_priority;
+                            }
+                            if (writer_thread -> tx_thread_inherit_priority < priority)
+                            {
+
+                                /* Keep the mutex inherited priority.  */
+                                priority =  writer_thread -> tx_thread_inherit_priority;
+                            }
+
+                            /* Determine if the writer is raised beyond that priority.  */
+                            if (writer_thread -> tx_thread_priority >= priority)
+                            {
+
+                                /* Nothing to restore.  */
+                                priority =  ((UINT) TX_MAX_PRIORITIES);
+                            }
+                        }
+
+                        /* Now we need to determine if this cleanup is from a terminate, timeout,
+                           or from a wait abort.  */
+                        if (thread_ptr -> tx_thread_state == TX_RWLOCK_SUSP)
+                        {
+
+                            /* Timeout condition and the thread is still suspended on the lock.
+                               Setup return error status and resume the thread.  */
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+                            /* Increment the total timeouts counter.  */
+                            _tx_rwlock_performance_timeout_count++;
+
+                            /* Increment the number of timeouts on this lock.  */
+                            rwlock_ptr -> tx_rwlock_performance_timeout_count++;
+#endif
+
+                            /* Setup return status.  */
+                            thread_ptr -> tx_thread_suspend_status =  TX_NOT_AVAILABLE;
+
+                            /* Place the thread at the front of the resume list.  */
+                            thread_ptr -> tx_thread_suspended_next =  resume_list;
+                            resume_list =                             thread_ptr;
+                        }
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                        /* Determine if the priority of the writer must be restored.  */
+                        if (priority != ((UINT) TX_MAX_PRIORITIES))
+                        {
+
+                            /* Restore the priority of the writer.  */
+                            _tx_mutex_priority_change(writer_thread, priority);
+                        }
+
+                        /* Walk through the resume list.  */
+                        while (resume_list != TX_NULL)
+                        {
+
+                            /* Get next pointer first.  */
+                            next_thread =  resume_list -> tx_thread_suspended_next;
+
+                            /* Resume the thread!  */
+                            _tx_thread_system_ni_resume(resume_list);
+
+                            /* Move to the next thread.  */
+                            resume_list =  next_thread;
+                        }
+#else
+
+                        /* Determine if there is anything to resume or to restore.  */
+                        if ((resume_list != TX_NULL) || (priority != ((UINT) TX_MAX_PRIORITIES)))
+                        {
+
+                            /* Disable preemption while the threads are resumed.  */
+                            _tx_thread_preempt_disable++;
+
+                            /* Restore interrupts.  */
+                            TX_RESTORE
+
+                            /* Determine if the priority of the writer must be restored.  */
+                            if (priority != ((UINT) TX_MAX_PRIORITIES))
+                            {
+
+                                /* Restore the priority of the writer.  */
+                                _tx_mutex_priority_change(writer_thread, priority);
+                            }
+
+                            /* Walk through the resume list.  */
+                            while (resume_list != TX_NULL)
+                            {
+
+                                /* Get next pointer first.  */
+                                next_thread =  resume_list -> tx_thread_suspended_next;
+
+                                /* Disable interrupts.  */
+                                TX_DISABLE
+
+                                /* Disable preemption again.  */
+                                _tx_thread_preempt_disable++;
+
+                                /* Restore interrupts.  */
+                                TX_RESTORE
+
+                                /* Resume the thread!  */
+                                _tx_thread_system_resume(resume_list);
+
+                                /* Move to the next thread.  */
+                                resume_list =  next_thread;
+                            }
+
+                            /* Disable interrupts.  */
+                            TX_DISABLE
+
+                            /* Release thread preemption disable.  */
+                            _tx_thread_preempt_disable--;
+
+                            /* Restore interrupts.  */
+                            TX_RESTORE
+
+                            /* Check for preemption.  */
+                            _tx_thread_system_preempt_check();
+
+                            /* Disable interrupts.  */
+                            TX_DISABLE
+                        }
+#endif
+#ifndef TX_NOT_INTERRUPTABLE
+                    }
+                }
+            }
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+}
+
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_thread_release                           PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases the write ownership of all reader-writer     */
+/*    locks held by the thread, and hands each lock to its waiting        */
+/*    threads.  This function is called when the thread completes or is   */
+/*    terminated.  Read holds are not tracked per thread and are not      */
+/*    released.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread's control block */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_rwlock_waiters_grant          Hand lock to waiting threads      */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_shell_entry            Thread completion processing      */
+/*    _tx_thread_terminate              Thread terminate processing       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_rwlock_thread_release(TX_THREAD *thread_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_RWLOCK           *rwlock_ptr;
+TX_THREAD           *granted_list;
+TX_THREAD           *next_thread;
+ULONG               rwlock_count;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+#endif
+
+    /* Loop to look at all the reader-writer locks.  */
+    rwlock_ptr =    _tx_rwlock_created_ptr;
+    rwlock_count =  _tx_rwlock_created_count;
+    while (rwlock_count != ((ULONG) 0))
+    {
+
+        /* Determine if the thread holds this lock for writing.  */
+        if (rwlock_ptr -> tx_rwlock_writer == thread_ptr)
+        {
+
+            /* Yes, release the write ownership.  */
+            rwlock_ptr -> tx_rwlock_writer =                    TX_NULL;
+            rwlock_ptr -> tx_rwlock_writer_count =              ((UINT) 0);
+            rwlock_ptr -> tx_rwlock_highest_priority_waiting =  ((UINT) TX_MAX_PRIORITIES);
+
+            /* Hand the lock to the waiting threads, if any.  */
+            granted_list =  _tx_rwlock_waiters_grant(rwlock_ptr);
+
+            /* Walk through the granted list.  */
+            while (granted_list != TX_NULL)
+            {
+
+                /* Get next pointer first.  */
+                next_thread =  granted_list -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(granted_list);
+#else
+
+                /* Disable preemption again.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Resume the thread!  */
+                _tx_thread_system_resume(granted_list);
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+
+                /* Move to the next thread.  */
+                granted_list =  next_thread;
+            }
+        }
+
+        /* Move to the next reader-writer lock.  */
+        rwlock_ptr =  rwlock_ptr -> tx_rwlock_created_next;
+        rwlock_count--;
+    }
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+    /* Restore preemption.  */
+    _tx_thread_preempt_disable--;
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_create                                   PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a reader-writer lock with optional writer     */
+/*    priority inheritance as specified in this call.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                            Pointer to rwlock control blk */
+/*    name_ptr                              Pointer to rwlock name        */
+/*    inherit                               Priority inheritance option   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_create(TX_RWLOCK *rwlock_ptr, CHAR *name_ptr, UINT inherit)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_RWLOCK       *next_rwlock;
+TX_RWLOCK       *previous_rwlock;
+
+
+    /* Initialize reader-writer lock control block to all zeros.  */
+    TX_MEMSET(rwlock_ptr, 0, (sizeof(TX_RWLOCK)));
+
+    /* Setup the basic reader-writer lock fields.  */
+    rwlock_ptr -> tx_rwlock_name =                      name_ptr;
+    rwlock_ptr -> tx_rwlock_inherit =                   inherit;
+    rwlock_ptr -> tx_rwlock_highest_priority_waiting =  ((UINT) TX_MAX_PRIORITIES);
+
+    /* Disable interrupts to place the reader-writer lock on the created list.  */
+    TX_DISABLE
+
+    /* Setup the reader-writer lock ID to make it valid.  */
+    rwlock_ptr -> tx_rwlock_id =  TX_RWLOCK_ID;
+
+    /* Setup the thread reader-writer lock release function pointer.  */
+    _tx_thread_rwlock_release =  &(_tx_rwlock_thread_release);
+
+    /* Place the reader-writer lock on the list of created reader-writer locks.
+       First, check for an empty list.  */
+    if (_tx_rwlock_created_count == TX_EMPTY)
+    {
+
+        /* The created reader-writer lock list is empty.  Add the lock to empty list.  */
+        _tx_rwlock_created_ptr =                    rwlock_ptr;
+        rwlock_ptr -> tx_rwlock_created_next =      rwlock_ptr;
+        rwlock_ptr -> tx_rwlock_created_previous =  rwlock_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_rwlock =      _tx_rwlock_created_ptr;
+        previous_rwlock =  next_rwlock -> tx_rwlock_created_previous;
+
+        /* Place the new reader-writer lock in the list.  */
+        next_rwlock -> tx_rwlock_created_previous =  rwlock_ptr;
+        previous_rwlock -> tx_rwlock_created_next =  rwlock_ptr;
+
+        /* Setup this reader-writer lock's next and previous created links.  */
+        rwlock_ptr -> tx_rwlock_created_previous =  previous_rwlock;
+        rwlock_ptr -> tx_rwlock_created_next =      next_rwlock;
+    }
+
+    /* Increment the created count.  */
+    _tx_rwlock_created_count++;
+
+    /* Optional reader-writer lock create extended processing.  */
+    TX_RWLOCK_CREATE_EXTENSION(rwlock_ptr)
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_RWLOCK, rwlock_ptr, name_ptr, inherit, 0)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_CREATE, rwlock_ptr, inherit, TX_POINTER_TO_ULONG_CONVERT(&next_rwlock), 0, TX_TRACE_RWLOCK_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_RWLOCK_CREATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
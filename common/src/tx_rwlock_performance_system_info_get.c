@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_rwlock.h"
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+#include "tx_trace.h"
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_performance_system_info_get              PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves system reader-writer lock performance       */
+/*    information.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    read_gets                         Destination for total number of   */
+/*                                        read gets                       */
+/*    write_gets                        Destination for total number of   */
+/*                                        write gets                      */
+/*    puts                              Destination for total number of   */
+/*                                        puts                            */
+/*    suspensions                       Destination for total number of   */
+/*                                        suspensions                     */
+/*    timeouts                          Destination for total number of   */
+/*                                        timeouts                        */
+/*    inheritances                      Destination for total number of   */
+/*                                        writer priority inheritances    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_performance_system_info_get(ULONG *read_gets, ULONG *write_gets, ULONG *puts,
+                                ULONG *suspensions, ULONG *timeouts, ULONG *inheritances)
+{
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_PERFORMANCE_SYSTEM_INFO_GET, 0, 0, 0, 0, TX_TRACE_RWLOCK_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_RWLOCK_PERFORMANCE_SYSTEM_INFO_GET_INSERT
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the total number of read gets.  */
+    if (read_gets != TX_NULL)
+    {
+
+        *read_gets =  _tx_rwlock_performance_read_get_count;
+    }
+
+    /* Retrieve the total number of write gets.  */
+    if (write_gets != TX_NULL)
+    {
+
+        *write_gets =  _tx_rwlock_performance_write_get_count;
+    }
+
+    /* Retrieve the total number of puts.  */
+    if (puts != TX_NULL)
+    {
+
+        *puts =  _tx_rwlock_performance_put_count;
+    }
+
+    /* Retrieve the total number of suspensions.  */
+    if (suspensions != TX_NULL)
+    {
+
+        *suspensions =  _tx_rwlock_performance_suspension_count;
+    }
+
+    /* Retrieve the total number of timeouts.  */
+    if (timeouts != TX_NULL)
+    {
+
+        *timeouts =  _tx_rwlock_performance_timeout_count;
+    }
+
+    /* Retrieve the total number of priority inheritances.  */
+    if (inheritances != TX_NULL)
+    {
+
+        *inheritances =  _tx_rwlock_performance_priority_inheritance_count;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (read_gets != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (write_gets != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (puts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (timeouts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (inheritances != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,319 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_read_get                                 PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function obtains shared read access to the specified           */
+/*    reader-writer lock.  Read access is granted immediately if no       */
+/*    writer holds or is waiting for the lock.  If the calling thread     */
+/*    already holds the lock for writing, the write ownership count is    */
+/*    simply incremented.  Otherwise, the caller is suspended until all   */
+/*    writers ahead of it have released the lock.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                            Pointer to rwlock control blk */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_mutex_priority_change             Inherit waiter priority       */
+/*    _tx_thread_system_suspend             Suspend thread service        */
+/*    _tx_thread_system_ni_suspend          Non-interruptable suspend     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_read_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *writer_thread;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            status;
+
+
+    /* Disable interrupts to get read access to the lock.  */
+    TX_DISABLE
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total reader-writer lock read get counter.  */
+    _tx_rwlock_performance_read_get_count++;
+
+    /* Increment the number of read attempts on this lock.  */
+    rwlock_ptr -> tx_rwlock_performance_read_get_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_READ_GET, rwlock_ptr, wait_option, TX_POINTER_TO_ULONG_CONVERT(rwlock_ptr -> tx_rwlock_writer), rwlock_ptr -> tx_rwlock_reader_count, TX_TRACE_RWLOCK_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_RWLOCK_READ_GET_INSERT
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Pickup the current writer.  */
+    writer_thread =  rwlock_ptr -> tx_rwlock_writer;
+
+    /* Determine if read access can be granted immediately.  Readers are held
+       off while any writer is waiting, so writers cannot be starved.  */
+    if ((writer_thread == TX_NULL) && (rwlock_ptr -> tx_rwlock_write_suspended_count == TX_NO_SUSPENSIONS))
+    {
+
+        /* Increment the number of readers.  */
+        rwlock_ptr -> tx_rwlock_reader_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Determine if the caller already holds the lock for writing.  */
+    else if (writer_thread == thread_ptr)
+    {
+
+        /* The writer may also read, just increment the ownership count.  */
+        rwlock_ptr -> tx_rwlock_writer_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_NOT_AVAILABLE;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total reader-writer lock suspension counter.  */
+            _tx_rwlock_performance_suspension_count++;
+
+            /* Increment the number of suspensions on this lock.  */
+            rwlock_ptr -> tx_rwlock_performance_suspension_count++;
+#endif
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_rwlock_cleanup);
+
+            /* Setup cleanup information, i.e. this reader-writer lock control
+               block and the type of access requested.  */
+            thread_ptr -> tx_thread_suspend_control_block =  (VOID *) rwlock_ptr;
+            thread_ptr -> tx_thread_suspend_option =         TX_RWLOCK_READ;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (rwlock_ptr -> tx_rwlock_read_suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                rwlock_ptr -> tx_rwlock_read_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   rwlock_ptr -> tx_rwlock_read_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the number of read suspensions.  */
+            rwlock_ptr -> tx_rwlock_read_suspended_count++;
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_RWLOCK_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Determine if we need to raise the priority of the current writer.  */
+            if ((rwlock_ptr -> tx_rwlock_inherit == TX_TRUE) && (writer_thread != TX_NULL))
+            {
+
+                /* Determine if this is the highest priority to raise for this lock.  */
+                if (rwlock_ptr -> tx_rwlock_highest_priority_waiting > thread_ptr -> tx_thread_priority)
+                {
+
+                    /* Remember this priority.  */
+                    rwlock_ptr -> tx_rwlock_highest_priority_waiting =  thread_ptr -> tx_thread_priority;
+                }
+
+                /* Check to see if the writer is lower priority.  */
+                if (writer_thread -> tx_thread_priority > thread_ptr -> tx_thread_priority)
+                {
+
+                    /* Yes, raise the writer's priority to that of the current thread.  */
+                    _tx_mutex_priority_change(writer_thread, thread_ptr -> tx_thread_priority);
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the total priority inheritance counter.  */
+                    _tx_rwlock_performance_priority_inheritance_count++;
+
+                    /* Increment the number of priority inheritance situations on this lock.  */
+                    rwlock_ptr -> tx_rwlock_performance_priority_inheritance_count++;
+#endif
+                }
+            }
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Determine if this is the highest priority to raise for this lock.  */
+            if ((rwlock_ptr -> tx_rwlock_inherit == TX_TRUE) && (writer_thread != TX_NULL) &&
+                (rwlock_ptr -> tx_rwlock_highest_priority_waiting > thread_ptr -> tx_thread_priority))
+            {
+
+                /* Remember this priority.  */
+                rwlock_ptr -> tx_rwlock_highest_priority_waiting =  thread_ptr -> tx_thread_priority;
+            }
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Determine if we need to raise the priority of the current writer.  */
+            if ((rwlock_ptr -> tx_rwlock_inherit == TX_TRUE) && (writer_thread != TX_NULL))
+            {
+
+                /* Check to see if the writer is lower priority.  */
+                if (writer_thread -> tx_thread_priority > thread_ptr -> tx_thread_priority)
+                {
+
+                    /* Yes, raise the writer's priority to that of the current thread.  */
+                    _tx_mutex_priority_change(writer_thread, thread_ptr -> tx_thread_priority);
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the total priority inheritance counter.  */
+                    _tx_rwlock_performance_priority_inheritance_count++;
+
+                    /* Increment the number of priority inheritance situations on this lock.  */
+                    rwlock_ptr -> tx_rwlock_performance_priority_inheritance_count++;
+#endif
+                }
+            }
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Immediate return, return error completion.  */
+        status =  TX_NOT_AVAILABLE;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,278 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_waiters_grant                            PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function hands the reader-writer lock to waiting threads once  */
+/*    it is no longer held in a conflicting mode.  If the lock is free    */
+/*    and writers are waiting, ownership is given to a single writer -    */
+/*    the highest priority one when priority inheritance is enabled,      */
+/*    otherwise the oldest.  If no writer holds or waits for the lock,    */
+/*    all waiting readers are granted access together.                   */
+/*                                                                        */
+/*    Granted threads are removed from the suspension lists, their        */
+/*    cleanup is cleared and their status is set to TX_SUCCESS.  They are */
+/*    returned as a NULL-terminated list linked through the suspended     */
+/*    next pointer; the caller is responsible for resuming them.  This    */
+/*    function must be called with interrupts disabled.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                            Pointer to rwlock control blk */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    granted_list                          List of threads to resume     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_mutex_priority_change             Inherit waiter priority       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_rwlock_put                        Release reader-writer lock    */
+/*    _tx_rwlock_cleanup                    Reader-writer lock cleanup    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+TX_THREAD  *_tx_rwlock_waiters_grant(TX_RWLOCK *rwlock_ptr)
+{
+
+TX_THREAD       *granted_list;
+TX_THREAD       *thread_ptr;
+TX_THREAD       *search_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            suspended_count;
+UINT            priority;
+
+
+    /* Default the granted list to empty.  */
+    granted_list =  TX_NULL;
+
+    /* Determine if the lock is completely free and a writer is waiting.  */
+    if ((rwlock_ptr -> tx_rwlock_writer == TX_NULL) && (rwlock_ptr -> tx_rwlock_reader_count == ((ULONG) 0)) &&
+        (rwlock_ptr -> tx_rwlock_write_suspended_count != TX_NO_SUSPENSIONS))
+    {
+
+        /* Default to the oldest waiting writer.  */
+        thread_ptr =  rwlock_ptr -> tx_rwlock_write_suspension_list;
+
+        /* Determine if priority inheritance is in effect.  */
+        if (rwlock_ptr -> tx_rwlock_inherit == TX_TRUE)
+        {
+
+            /* Yes, find the highest priority waiting writer.  The first writer
+               found at a given priority wins to preserve FIFO order.  */
+            search_ptr =       thread_ptr -> tx_thread_suspended_next;
+            suspended_count =  rwlock_ptr -> tx_rwlock_write_suspended_count;
+            while (suspended_count > ((UINT) 1))
+            {
+
+                /* Is this writer of higher priority?  */
+                if (search_ptr -> tx_thread_priority < thread_ptr -> tx_thread_priority)
+                {
+
+                    /* Yes, remember it.  */
+                    thread_ptr =  search_ptr;
+                }
+
+                /* Move to the next waiting writer.  */
+                search_ptr =  search_ptr -> tx_thread_suspended_next;
+                suspended_count--;
+            }
+        }
+
+        /* Remove the selected writer from the write suspension list.  */
+        rwlock_ptr -> tx_rwlock_write_suspended_count--;
+        if (rwlock_ptr -> tx_rwlock_write_suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* The list is now empty.  */
+            rwlock_ptr -> tx_rwlock_write_suspension_list =  TX_NULL;
+        }
+        else
+        {
+
+            /* Update the links of the adjacent threads.  */
+            next_thread =                                   thread_ptr -> tx_thread_suspended_next;
+            previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+            next_thread -> tx_thread_suspended_previous =   previous_thread;
+            previous_thread -> tx_thread_suspended_next =   next_thread;
+
+            /* Determine if we need to update the head pointer.  */
+            if (rwlock_ptr -> tx_rwlock_write_suspension_list == thread_ptr)
+            {
+
+                /* Update the list head pointer.  */
+                rwlock_ptr -> tx_rwlock_write_suspension_list =  next_thread;
+            }
+        }
+
+        /* Give the lock to the writer.  */
+        rwlock_ptr -> tx_rwlock_writer =                    thread_ptr;
+        rwlock_ptr -> tx_rwlock_writer_count =              ((UINT) 1);
+        rwlock_ptr -> tx_rwlock_highest_priority_waiting =  ((UINT) TX_MAX_PRIORITIES);
+
+        /* Clear the cleanup routine, this prevents the timeout from doing anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Put return status into the thread control block.  */
+        thread_ptr -> tx_thread_suspend_status =   TX_SUCCESS;
+
+        /* Terminate the granted list.  */
+        thread_ptr -> tx_thread_suspended_next =   TX_NULL;
+        granted_list =                             thread_ptr;
+
+        /* Determine if the new writer must inherit the priority of the remaining waiters.  */
+        if (rwlock_ptr -> tx_rwlock_inherit == TX_TRUE)
+        {
+
+            /* Find the highest priority of any remaining waiting thread.  */
+            priority =  ((UINT) TX_MAX_PRIORITIES);
+
+            search_ptr =       rwlock_ptr -> tx_rwlock_write_suspension_list;
+            suspended_count =  rwlock_ptr -> tx_rwlock_write_suspended_count;
+            while (suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Is this thread of higher priority?  */
+                if (search_ptr -> tx_thread_priority < priority)
+                {
+
+                    /* Yes, remember its priority.  */
+                    priority =  search_ptr -> tx_thread_priority;
+                }
+
+                /* Move to the next waiting writer.  */
+                search_ptr =  search_ptr -> tx_thread_suspended_next;
+                suspended_count--;
+            }
+
+            search_ptr =       rwlock_ptr -> tx_rwlock_read_suspension_list;
+            suspended_count =  rwlock_ptr -> tx_rwlock_read_suspended_count;
+            while (suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Is this thread of higher priority?  */
+                if (search_ptr -> tx_thread_priority < priority)
+                {
+
+                    /* Yes, remember its priority.  */
+                    priority =  search_ptr -> tx_thread_priority;
+                }
+
+                /* Move to the next waiting reader.  */
+                search_ptr =  search_ptr -> tx_thread_suspended_next;
+                suspended_count--;
+            }
+
+            /* Remember the highest priority waiting.  */
+            rwlock_ptr -> tx_rwlock_highest_priority_waiting =  priority;
+
+            /* Determine if the new writer needs to be raised.  The writer is not
+               ready at this point, so only its priority fields are updated.  */
+            if (thread_ptr -> tx_thread_priority > priority)
+            {
+
+                /* Raise the priority of the new writer.  */
+                _tx_mutex_priority_change(thread_ptr, priority);
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total priority inheritance counter.  */
+                _tx_rwlock_performance_priority_inheritance_count++;
+
+                /* Increment the number of priority inheritance situations on this lock.  */
+                rwlock_ptr -> tx_rwlock_performance_priority_inheritance_count++;
+#endif
+            }
+        }
+    }
+
+    /* Otherwise, determine if readers may proceed.  */
+    else if ((rwlock_ptr -> tx_rwlock_writer == TX_NULL) &&
+             (rwlock_ptr -> tx_rwlock_write_suspended_count == TX_NO_SUSPENSIONS) &&
+             (rwlock_ptr -> tx_rwlock_read_suspended_count != TX_NO_SUSPENSIONS))
+    {
+
+        /* Yes, grant every waiting reader at once.  */
+        granted_list =     rwlock_ptr -> tx_rwlock_read_suspension_list;
+        suspended_count =  rwlock_ptr -> tx_rwlock_read_suspended_count;
+
+        /* Break the circular list at the tail.  */
+        previous_thread =                             granted_list -> tx_thread_suspended_previous;
+        previous_thread -> tx_thread_suspended_next =  TX_NULL;
+
+        /* Account for the new readers.  */
+        rwlock_ptr -> tx_rwlock_reader_count =  rwlock_ptr -> tx_rwlock_reader_count + ((ULONG) suspended_count);
+
+        /* Clear the read suspension list.  */
+        rwlock_ptr -> tx_rwlock_read_suspension_list =  TX_NULL;
+        rwlock_ptr -> tx_rwlock_read_suspended_count =  TX_NO_SUSPENSIONS;
+
+        /* Walk the granted readers.  */
+        thread_ptr =  granted_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Clear the cleanup routine, this prevents the timeout from doing anything.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =   TX_SUCCESS;
+
+            /* Move to the next reader.  */
+            thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+        }
+    }
+
+    /* Return the list of granted threads.  */
+    return(granted_list);
+}
+
@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_budget_charge                            PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the timer interrupt on every tick.  It   */
+/*    charges the tick to the CPU budget of the interrupted thread and    */
+/*    places the thread on the pending list when its budget is            */
+/*    exhausted.  It also moves the threads on the enforced list whose    */
+/*    budget period has ended to the pending list.  If a thread was       */
+/*    placed on the pending list, the budget thread is resumed to demote  */
+/*    or suspend the thread, or to restore it.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume the budget thread          */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_interrupt               Timer interrupt handling          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_thread_budget_charge(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *previous_ptr;
+TX_THREAD       *next_ptr;
+ULONG           delta;
+UINT            resume;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Nothing is pending yet.  */
+    resume =  TX_FALSE;
+
+    /* Pickup the interrupted thread.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Determine if the interrupted thread has a CPU budget that is available.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        if ((thread_ptr -> tx_thread_budget != ((ULONG) 0)) && (thread_ptr -> tx_thread_budget_state == TX_THREAD_BUDGET_AVAILABLE))
+        {
+
+            /* Determine if the budget period has ended.  */
+            delta =  _tx_timer_system_clock - thread_ptr -> tx_thread_budget_replenish_time;
+            if (delta <= ((~((ULONG) 0)) >> 1))
+            {
+
+                /* Yes, replenish the budget.  */
+                thread_ptr -> tx_thread_budget_remaining =  thread_ptr -> tx_thread_budget;
+
+                /* Start the next budget period.  If the thread did not execute for
+                   more than a period, the next period starts now.  */
+                if (delta < thread_ptr -> tx_thread_budget_period)
+                {
+                    thread_ptr -> tx_thread_budget_replenish_time =  thread_ptr -> tx_thread_budget_replenish_time + thread_ptr -> tx_thread_budget_period;
+                }
+                else
+                {
+                    thread_ptr -> tx_thread_budget_replenish_time =  _tx_timer_system_clock + thread_ptr -> tx_thread_budget_period;
+                }
+            }
+
+            /* Charge the tick to the budget.  */
+            thread_ptr -> tx_thread_budget_remaining--;
+
+            /* Determine if the budget is exhausted.  */
+            if (thread_ptr -> tx_thread_budget_remaining == ((ULONG) 0))
+            {
+
+                /* Yes, place the thread on the pending list to be demoted or
+                   suspended.  */
+                thread_ptr -> tx_thread_budget_state =  TX_THREAD_BUDGET_EXHAUSTED;
+                thread_ptr -> tx_thread_budget_next =   _tx_thread_budget_pending_list;
+                _tx_thread_budget_pending_list =        thread_ptr;
+
+                /* Increment the exhaustion counters.  */
+                thread_ptr -> tx_thread_budget_exhaustion_count++;
+                _tx_thread_budget_exhaustion_count++;
+
+                /* The budget thread must run.  */
+                resume =  TX_TRUE;
+            }
+        }
+    }
+
+    /* Look for enforced threads whose budget period has ended.  */
+    previous_ptr =  TX_NULL;
+    thread_ptr =    _tx_thread_budget_enforced_list;
+    while (thread_ptr != TX_NULL)
+    {
+
+        /* Pickup the next enforced thread.  */
+        next_ptr =  thread_ptr -> tx_thread_budget_next;
+
+        /* Determine if the budget period of this thread has ended.  */
+        delta =  _tx_timer_system_clock - thread_ptr -> tx_thread_budget_replenish_time;
+        if (delta <= ((~((ULONG) 0)) >> 1))
+        {
+
+            /* Yes, remove the thread from the enforced list.  */
+            if (previous_ptr == TX_NULL)
+            {
+                _tx_thread_budget_enforced_list =  next_ptr;
+            }
+            else
+            {
+                previous_ptr -> tx_thread_budget_next =  next_ptr;
+            }
+
+            /* Replenish the budget and start the next budget period.  */
+            thread_ptr -> tx_thread_budget_remaining =       thread_ptr -> tx_thread_budget;
+            thread_ptr -> tx_thread_budget_replenish_time =  _tx_timer_system_clock + thread_ptr -> tx_thread_budget_period;
+
+            /* Place the thread on the pending list to be restored.  */
+            thread_ptr -> tx_thread_budget_state =  TX_THREAD_BUDGET_REPLENISHED;
+            thread_ptr -> tx_thread_budget_next =   _tx_thread_budget_pending_list;
+            _tx_thread_budget_pending_list =        thread_ptr;
+
+            /* The budget thread must run.  */
+            resume =  TX_TRUE;
+        }
+        else
+        {
+
+            /* This thread stays on the enforced list.  */
+            previous_ptr =  thread_ptr;
+        }
+
+        /* Move to the next enforced thread.  */
+        thread_ptr =  next_ptr;
+    }
+
+    /* Determine if the budget thread must run.  */
+    if (resume == TX_TRUE)
+    {
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the budget thread.  */
+        _tx_thread_system_ni_resume(&_tx_thread_budget_thread);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Call the system resume function to activate the budget thread.  */
+        _tx_thread_system_resume(&_tx_thread_budget_thread);
+#endif
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+}
+#endif
+
@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_budget_info_get                          PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the CPU budget of the specified thread,     */
+/*    the budget remaining in the current period, whether the thread is   */
+/*    currently demoted or suspended because of its budget, and the       */
+/*    number of times its budget was exhausted.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    budget                            Destination for the budget        */
+/*    period                            Destination for the period        */
+/*    remaining                         Destination for the remaining     */
+/*                                          budget                        */
+/*    enforced                          Destination for the enforced      */
+/*                                          flag                          */
+/*    exhaustions                       Destination for the number of     */
+/*                                          exhaustions                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_budget_info_get(TX_THREAD *thread_ptr, ULONG *budget, ULONG *period,
+                                    ULONG *remaining, UINT *enforced, ULONG *exhaustions)
+{
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Retrieve the budget.  */
+    if (budget != TX_NULL)
+    {
+
+        *budget =  thread_ptr -> tx_thread_budget;
+    }
+
+    /* Retrieve the period.  */
+    if (period != TX_NULL)
+    {
+
+        *period =  thread_ptr -> tx_thread_budget_period;
+    }
+
+    /* Retrieve the remaining budget.  */
+    if (remaining != TX_NULL)
+    {
+
+        *remaining =  thread_ptr -> tx_thread_budget_remaining;
+    }
+
+    /* Retrieve the enforced flag.  */
+    if (enforced != TX_NULL)
+    {
+
+        /* The thread is enforced from the exhaustion until it is restored.  */
+        if (thread_ptr -> tx_thread_budget_state != TX_THREAD_BUDGET_AVAILABLE)
+        {
+            *enforced =  TX_TRUE;
+        }
+        else
+        {
+            *enforced =  TX_FALSE;
+        }
+    }
+
+    /* Retrieve the number of exhaustions.  */
+    if (exhaustions != TX_NULL)
+    {
+
+        *exhaustions =  thread_ptr -> tx_thread_budget_exhaustion_count;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (budget != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (period != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (remaining != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (enforced != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (exhaustions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_budget_remove                            PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a thread from the pending list or the         */
+/*    enforced list of the CPU budget processing.  This function must be  */
+/*    called with interrupts disabled.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_budget_set             Set thread CPU budget             */
+/*    _tx_thread_delete                 Delete thread                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_thread_budget_remove(TX_THREAD *thread_ptr)
+{
+
+TX_THREAD       *previous_ptr;
+TX_THREAD       *current_ptr;
+
+
+    /* Determine if the thread is on the pending list.  */
+    if ((thread_ptr -> tx_thread_budget_state == TX_THREAD_BUDGET_EXHAUSTED) ||
+        (thread_ptr -> tx_thread_budget_state == TX_THREAD_BUDGET_REPLENISHED))
+    {
+
+        /* Yes, search the pending list.  */
+        previous_ptr =  TX_NULL;
+        current_ptr =   _tx_thread_budget_pending_list;
+    }
+    else
+    {
+
+        /* Otherwise, search the enforced list.  An available thread is on
+           neither list and is not found.  */
+        previous_ptr =  TX_NULL;
+        current_ptr =   _tx_thread_budget_enforced_list;
+    }
+
+    /* Find the thread on the list.  */
+    while ((current_ptr != TX_NULL) && (current_ptr != thread_ptr))
+    {
+
+        /* Move to the next thread.  */
+        previous_ptr =  current_ptr;
+        current_ptr =   current_ptr -> tx_thread_budget_next;
+    }
+
+    /* Determine if the thread was found.  */
+    if (current_ptr != TX_NULL)
+    {
+
+        /* Yes, unlink the thread.  */
+        if (previous_ptr != TX_NULL)
+        {
+            previous_ptr -> tx_thread_budget_next =  thread_ptr -> tx_thread_budget_next;
+        }
+        else if (_tx_thread_budget_pending_list == thread_ptr)
+        {
+            _tx_thread_budget_pending_list =  thread_ptr -> tx_thread_budget_next;
+        }
+        else
+        {
+            _tx_thread_budget_enforced_list =  thread_ptr -> tx_thread_budget_next;
+        }
+    }
+
+    /* The thread is now on neither list.  */
+    thread_ptr -> tx_thread_budget_next =  TX_NULL;
+}
+#endif
+
@@ -0,0 +1,219 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_budget_set                               PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the CPU budget of a thread.  The thread may      */
+/*    execute for the budget number of ticks in each period.  When the    */
+/*    budget is exhausted, the thread is demoted to the specified         */
+/*    priority or is suspended until the budget is replenished at the     */
+/*    end of the period.  The first period starts now.  A budget of zero  */
+/*    removes the budget, a thread that is demoted or suspended because   */
+/*    of its budget is restored.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    budget                            Ticks of execution per period     */
+/*    period                            Budget period in ticks            */
+/*    action                            TX_BUDGET_DEMOTE or               */
+/*                                          TX_BUDGET_SUSPEND             */
+/*    priority                          Priority of a demoted thread      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_budget_remove          Remove from budget lists          */
+/*    _tx_thread_priority_change        Restore thread priority           */
+/*    _tx_thread_resume                 Resume thread                     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_budget_set(TX_THREAD *thread_ptr, ULONG budget, ULONG period, UINT action, UINT priority)
+{
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            state;
+UINT            old_action;
+UINT            old_priority;
+UINT            suspended;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Remove the thread from the budget lists.  */
+    _tx_thread_budget_remove(thread_ptr);
+
+    /* Save the previous budget state and settings of the thread.  */
+    state =         thread_ptr -> tx_thread_budget_state;
+    old_action =    thread_ptr -> tx_thread_budget_action;
+    old_priority =  thread_ptr -> tx_thread_budget_priority;
+
+    /* Determine if the thread is still suspended by its previous budget.  */
+    suspended =  TX_FALSE;
+    if (thread_ptr -> tx_thread_budget_suspended == TX_TRUE)
+    {
+
+        /* Only a thread still suspended is resumed.  */
+        if ((thread_ptr -> tx_thread_state == TX_SUSPENDED) || (thread_ptr -> tx_thread_delayed_suspend == TX_TRUE))
+        {
+
+            /* Yes, the budget suspension is still in effect.  */
+            suspended =  TX_TRUE;
+        }
+
+        /* The budget suspension ends now.  */
+        thread_ptr -> tx_thread_budget_suspended =  TX_FALSE;
+    }
+
+    /* Setup the new budget of the thread.  */
+    thread_ptr -> tx_thread_budget =                 budget;
+    thread_ptr -> tx_thread_budget_period =          period;
+    thread_ptr -> tx_thread_budget_action =          action;
+    thread_ptr -> tx_thread_budget_priority =        priority;
+
+    /* Start the first budget period now.  */
+    thread_ptr -> tx_thread_budget_remaining =       budget;
+    thread_ptr -> tx_thread_budget_replenish_time =  _tx_timer_system_clock + period;
+    thread_ptr -> tx_thread_budget_state =           TX_THREAD_BUDGET_AVAILABLE;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if the thread was demoted or suspended because of its
+       previous budget.  */
+    if ((state == TX_THREAD_BUDGET_ENFORCED) || (state == TX_THREAD_BUDGET_REPLENISHED))
+    {
+
+        /* Yes, restore the thread.  */
+        if (old_action == TX_BUDGET_DEMOTE)
+        {
+
+            /* Restore the priority unless it was changed while the thread
+               was demoted.  */
+            if (thread_ptr -> tx_thread_user_priority == old_priority)
+            {
+
+                /* Change the priority back to the saved priority.  */
+                (VOID) _tx_thread_priority_change(thread_ptr, thread_ptr -> tx_thread_budget_saved_priority, &old_priority);
+            }
+        }
+        else if (suspended == TX_TRUE)
+        {
+
+            /* Resume the thread the budget suspended.  */
+            (VOID) _tx_thread_resume(thread_ptr);
+        }
+        else
+        {
+
+            /* The thread was resumed or suspended by the application, leave it.  */
+        }
+    }
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (budget != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (period != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (action != TX_BUDGET_DEMOTE)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (priority != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,266 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_budget_thread_entry                      PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry of the budget thread.  It takes the      */
+/*    threads from the pending list of the CPU budget processing.  A      */
+/*    thread that exhausted its budget is demoted to its budget priority  */
+/*    or is suspended, and placed on the enforced list.  A thread whose   */
+/*    budget was replenished is restored to its previous priority or is   */
+/*    resumed.  When the pending list is empty, the budget thread         */
+/*    suspends until the timer interrupt resumes it again.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    budget_thread_input               Budget thread input, must be      */
+/*                                          TX_THREAD_ID                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_priority_change        Demote or restore a thread        */
+/*    _tx_thread_suspend                Suspend a thread                  */
+/*    _tx_thread_resume                 Resume a thread                   */
+/*    _tx_thread_system_suspend         Suspend the budget thread         */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX Scheduler                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_thread_budget_thread_entry(ULONG budget_thread_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+UINT            state;
+UINT            old_priority;
+UINT            suspended;
+
+
+    /* Make sure the budget thread input is correct.  */
+    if (budget_thread_input == TX_THREAD_ID)
+    {
+
+        /* Process the pending list forever.  */
+        while (TX_LOOP_FOREVER)
+        {
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Pickup the first pending thread.  */
+            thread_ptr =  _tx_thread_budget_pending_list;
+
+            /* Determine if a thread is pending.  */
+            if (thread_ptr != TX_NULL)
+            {
+
+                /* Remove the thread from the pending list.  */
+                _tx_thread_budget_pending_list =  thread_ptr -> tx_thread_budget_next;
+
+                /* Pickup the budget state of the thread.  */
+                state =  thread_ptr -> tx_thread_budget_state;
+
+                /* Determine if the budget of the thread is exhausted.  */
+                if (state == TX_THREAD_BUDGET_EXHAUSTED)
+                {
+
+                    /* Yes, place the thread on the enforced list to wait for the
+                       replenishment of its budget.  */
+                    thread_ptr -> tx_thread_budget_state =  TX_THREAD_BUDGET_ENFORCED;
+                    thread_ptr -> tx_thread_budget_next =   _tx_thread_budget_enforced_list;
+                    _tx_thread_budget_enforced_list =       thread_ptr;
+
+                    /* Save the priority of the thread.  */
+                    thread_ptr -> tx_thread_budget_saved_priority =  thread_ptr -> tx_thread_user_priority;
+
+                    /* Determine if the thread is to be suspended and is not already
+                       suspended, or about to be, by the application.  */
+                    if ((thread_ptr -> tx_thread_budget_action == TX_BUDGET_SUSPEND) &&
+                        (thread_ptr -> tx_thread_state != TX_SUSPENDED) &&
+                        (thread_ptr -> tx_thread_delayed_suspend == TX_FALSE))
+                    {
+
+                        /* Yes, remember the suspension is made by the budget.  */
+                        thread_ptr -> tx_thread_budget_suspended =  TX_TRUE;
+                    }
+                }
+                else
+                {
+
+                    /* The budget was replenished, the thread is available again.  */
+                    thread_ptr -> tx_thread_budget_state =  TX_THREAD_BUDGET_AVAILABLE;
+                    thread_ptr -> tx_thread_budget_next =   TX_NULL;
+                }
+
+                /* Determine if the thread is still suspended by its budget.  The flag
+                   is cleared by any resume of the thread in the meantime.  */
+                suspended =  TX_FALSE;
+                if ((state != TX_THREAD_BUDGET_EXHAUSTED) && (thread_ptr -> tx_thread_budget_suspended == TX_TRUE))
+                {
+
+                    /* Only a thread still suspended is resumed.  */
+                    if ((thread_ptr -> tx_thread_state == TX_SUSPENDED) || (thread_ptr -> tx_thread_delayed_suspend == TX_TRUE))
+                    {
+
+                        /* Yes, the budget suspension is still in effect.  */
+                        suspended =  TX_TRUE;
+                    }
+
+                    /* The budget suspension ends now.  */
+                    thread_ptr -> tx_thread_budget_suspended =  TX_FALSE;
+                }
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Determine if the thread is demoted or suspended.  */
+                if (thread_ptr -> tx_thread_budget_action == TX_BUDGET_DEMOTE)
+                {
+
+                    /* Determine if the budget was exhausted.  */
+                    if (state == TX_THREAD_BUDGET_EXHAUSTED)
+                    {
+
+                        /* Demote the thread, unless it already has a lower priority.  */
+                        if (thread_ptr -> tx_thread_budget_priority > thread_ptr -> tx_thread_budget_saved_priority)
+                        {
+
+                            /* Change the priority to the budget priority.  */
+                            (VOID) _tx_thread_priority_change(thread_ptr, thread_ptr -> tx_thread_budget_priority, &old_priority);
+                        }
+                    }
+
+                    /* Otherwise, restore the thread unless its priority was changed
+                       while it was demoted.  */
+                    else if (thread_ptr -> tx_thread_user_priority == thread_ptr -> tx_thread_budget_priority)
+                    {
+
+                        /* Change the priority back to the saved priority.  */
+                        (VOID) _tx_thread_priority_change(thread_ptr, thread_ptr -> tx_thread_budget_saved_priority, &old_priority);
+                    }
+                    else
+                    {
+
+                        /* Priority was changed by the application, leave it.  */
+                    }
+                }
+                else
+                {
+
+                    /* Determine if the budget was exhausted.  */
+                    if (state == TX_THREAD_BUDGET_EXHAUSTED)
+                    {
+
+                        /* Suspend the thread.  A thread that is waiting for a resource
+                           is suspended when it gets the resource.  */
+                        (VOID) _tx_thread_suspend(thread_ptr);
+                    }
+                    else if (suspended == TX_TRUE)
+                    {
+
+                        /* Resume the thread the budget suspended.  */
+                        (VOID) _tx_thread_resume(thread_ptr);
+                    }
+                    else
+                    {
+
+                        /* The thread was resumed or suspended by the application, leave it.  */
+                    }
+                }
+            }
+            else
+            {
+
+                /* Nothing is pending, suspend the budget thread.  */
+                thread_ptr =  &_tx_thread_budget_thread;
+
+                /* Set the status to suspending, in order to indicate the
+                   suspension is in progress.  */
+                thread_ptr -> tx_thread_state =  TX_SUSPENDED;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Call actual non-interruptable thread suspension routine.  */
+                _tx_thread_system_ni_suspend(thread_ptr, ((ULONG) 0));
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Set the suspending flag.  */
+                thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+                /* Increment the preempt disable count prior to suspending.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Call actual thread suspension routine.  */
+                _tx_thread_system_suspend(thread_ptr);
+#endif
+            }
+        }
+    }
+
+#ifdef TX_SAFETY_CRITICAL
+
+    /* If we ever get here, raise safety critical exception.  */
+    TX_SAFETY_CRITICAL_EXCEPTION(__FILE__, __LINE__, 0);
+#endif
+}
+#endif
+
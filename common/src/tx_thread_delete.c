@@ -56,7 +56,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_thread_budget_remove          Remove from budget lists          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -127,6 +127,12 @@ UINT            status;
         /* Clear the thread ID to make it invalid.  */
         thread_ptr -> tx_thread_id =  TX_CLEAR_ID;
 
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+        /* Remove the thread from the CPU budget processing.  */
+        _tx_thread_budget_remove(thread_ptr);
+#endif
+
         /* Decrement the number of created threads.  */
         _tx_thread_created_count--;
 
@@ -0,0 +1,186 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_edf_info_get                             PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the earliest-deadline-first parameters and  */
+/*    the deadline statistics of the specified thread.  A job misses its  */
+/*    deadline when the thread waits for its next period after the        */
+/*    absolute deadline of the job.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    relative_deadline                 Destination for the relative      */
+/*                                          deadline                      */
+/*    period                            Destination for the period        */
+/*    absolute_deadline                 Destination for the absolute      */
+/*                                          deadline of the current job   */
+/*    jobs                              Destination for the number of     */
+/*                                          completed jobs                */
+/*    misses                            Destination for the number of     */
+/*                                          missed deadlines              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_edf_info_get(TX_THREAD *thread_ptr, ULONG *relative_deadline, ULONG *period,
+                                ULONG *absolute_deadline, ULONG *jobs, ULONG *misses)
+{
+
+#ifdef TX_THREAD_ENABLE_EDF
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Retrieve the relative deadline.  */
+    if (relative_deadline != TX_NULL)
+    {
+
+        *relative_deadline =  thread_ptr -> tx_thread_edf_relative_deadline;
+    }
+
+    /* Retrieve the period.  */
+    if (period != TX_NULL)
+    {
+
+        *period =  thread_ptr -> tx_thread_edf_period;
+    }
+
+    /* Retrieve the absolute deadline of the current job.  */
+    if (absolute_deadline != TX_NULL)
+    {
+
+        *absolute_deadline =  thread_ptr -> tx_thread_edf_absolute_deadline;
+    }
+
+    /* Retrieve the number of completed jobs.  */
+    if (jobs != TX_NULL)
+    {
+
+        *jobs =  thread_ptr -> tx_thread_edf_job_count;
+    }
+
+    /* Retrieve the number of missed deadlines.  */
+    if (misses != TX_NULL)
+    {
+
+        *misses =  thread_ptr -> tx_thread_edf_miss_count;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (relative_deadline != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (period != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (absolute_deadline != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (jobs != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (misses != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
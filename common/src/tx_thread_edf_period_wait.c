@@ -0,0 +1,281 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_edf_period_wait                          PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function completes the current job of the calling thread of    */
+/*    the earliest-deadline-first band and waits for the release of its   */
+/*    next job, one period after the release of the current job.  If the  */
+/*    current job completed after its absolute deadline, the deadline     */
+/*    miss counters are incremented.  When the next job is already        */
+/*    released, the thread is placed in deadline order again and          */
+/*    continues without suspension.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_edf_ready_insert       Place thread in deadline order    */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_suspend         Actual thread suspension          */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_edf_period_wait(VOID)
+{
+
+#ifdef TX_THREAD_ENABLE_EDF
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+TX_THREAD       *thread_ptr;
+ULONG           timer_ticks;
+ULONG           delta;
+
+
+    /* Lockout interrupts while the job is completed.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Determine if this is a legal request.  */
+
+    /* Is there a current thread?  */
+    if (thread_ptr == TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Illegal caller of this service.  */
+        status =  TX_CALLER_ERROR;
+    }
+
+    /* Is the caller an ISR or Initialization?  */
+    else if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Illegal caller of this service.  */
+        status =  TX_CALLER_ERROR;
+    }
+
+    /* Is the thread a periodic thread of the earliest-deadline-first band?  */
+    else if (thread_ptr -> tx_thread_priority != ((UINT) TX_THREAD_EDF_PRIORITY))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Thread is not in the band, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+    else if ((thread_ptr -> tx_thread_edf_relative_deadline == ((ULONG) 0)) || (thread_ptr -> tx_thread_edf_period == ((ULONG) 0)))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Thread is not periodic, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+
+    /* Determine if the preempt disable flag is non-zero.  */
+    else if (_tx_thread_preempt_disable != ((UINT) 0))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+        status =  TX_CALLER_ERROR;
+    }
+    else
+    {
+
+        /* Determine if the job completed after its absolute deadline.  */
+        delta =  _tx_timer_system_clock - thread_ptr -> tx_thread_edf_absolute_deadline;
+        if ((delta != ((ULONG) 0)) && (delta <= ((~((ULONG) 0)) >> 1)))
+        {
+
+            /* Yes, the deadline was missed.  */
+            thread_ptr -> tx_thread_edf_miss_count++;
+            _tx_thread_edf_miss_count++;
+        }
+
+        /* Increment the number of completed jobs.  */
+        thread_ptr -> tx_thread_edf_job_count++;
+
+        /* Calculate the release and the absolute deadline of the next job.  */
+        thread_ptr -> tx_thread_edf_release_time =       thread_ptr -> tx_thread_edf_release_time + thread_ptr -> tx_thread_edf_period;
+        thread_ptr -> tx_thread_edf_absolute_deadline =  thread_ptr -> tx_thread_edf_release_time + thread_ptr -> tx_thread_edf_relative_deadline;
+
+        /* Calculate the number of ticks until the next release, while no tick
+           can occur.  */
+        timer_ticks =  thread_ptr -> tx_thread_edf_release_time - _tx_timer_system_clock;
+
+        /* Determine if the next job is already released.  */
+        if ((timer_ticks == ((ULONG) 0)) || (timer_ticks > ((~((ULONG) 0)) >> 1)))
+        {
+
+            /* Yes, place the thread in deadline order again if there are other
+               threads in the band.  */
+            if (thread_ptr -> tx_thread_ready_next != thread_ptr)
+            {
+
+                /* Determine if the thread is the head of the band.  */
+                if (_tx_thread_priority_list[((UINT) TX_THREAD_EDF_PRIORITY)] == thread_ptr)
+                {
+
+                    /* Yes, move the head to the next thread.  */
+                    _tx_thread_priority_list[((UINT) TX_THREAD_EDF_PRIORITY)] =  thread_ptr -> tx_thread_ready_next;
+                }
+
+                /* Remove the thread from the list.  */
+                (thread_ptr -> tx_thread_ready_next) -> tx_thread_ready_previous =  thread_ptr -> tx_thread_ready_previous;
+                (thread_ptr -> tx_thread_ready_previous) -> tx_thread_ready_next =  thread_ptr -> tx_thread_ready_next;
+
+                /* Place the thread in deadline order.  */
+                _tx_thread_edf_ready_insert(thread_ptr);
+
+                /* Determine if the thread is the thread to execute and is not
+                   protected by preemption-threshold.  */
+                if (_tx_thread_execute_ptr == thread_ptr)
+                {
+
+                    /* Check to see if preemption-threshold is not being used.  */
+                    if (thread_ptr -> tx_thread_preempt_threshold == thread_ptr -> tx_thread_priority)
+                    {
+
+                        /* Execute the head of the band.  */
+                        _tx_thread_execute_ptr =  _tx_thread_priority_list[((UINT) TX_THREAD_EDF_PRIORITY)];
+                    }
+                }
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Check for preemption by a thread with an earlier deadline.  */
+            _tx_thread_system_preempt_check();
+
+            /* Return successful status.  */
+            status =  TX_SUCCESS;
+        }
+        else
+        {
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_THREAD_SLEEP, TX_ULONG_TO_POINTER_CONVERT(timer_ticks), thread_ptr -> tx_thread_state, TX_POINTER_TO_ULONG_CONVERT(&status), 0, TX_TRACE_THREAD_EVENTS)
+
+            /* Log this kernel call.  */
+            TX_EL_THREAD_SLEEP_INSERT
+
+            /* Suspend the current thread until the next release.  */
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_SLEEP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, timer_ticks);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag. */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Initialize the status to successful.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  timer_ticks;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return status to the caller.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+    /* Not enabled, return error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#endif
+}
+
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+#ifdef TX_THREAD_ENABLE_EDF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_edf_ready_insert                         PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a thread that is becoming ready on the ready   */
+/*    list of the earliest-deadline-first band, which already holds       */
+/*    other threads.  Threads with a deadline are ordered by their        */
+/*    absolute deadline, threads with the same deadline in the order      */
+/*    they became ready.  Threads without a deadline are placed at the    */
+/*    end of the list.  If the thread becomes the new head of the list    */
+/*    and the band is executing, the thread is also made the thread to    */
+/*    execute.  This function must be called with interrupts disabled.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread becoming        */
+/*                                          ready                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread                     */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume          */
+/*    _tx_thread_resume                 Resume thread                     */
+/*    _tx_thread_edf_period_wait        Wait for next period              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_thread_edf_ready_insert(TX_THREAD *thread_ptr)
+{
+
+TX_THREAD       *head_ptr;
+TX_THREAD       *next_ptr;
+TX_THREAD       *previous_ptr;
+ULONG           deadline;
+ULONG           delta;
+UINT            found;
+
+
+    /* Pickup the head of the earliest-deadline-first band.  */
+    head_ptr =  _tx_thread_priority_list[((UINT) TX_THREAD_EDF_PRIORITY)];
+
+    /* Start the search at the head of the list.  */
+    next_ptr =  head_ptr;
+    found =     TX_FALSE;
+
+    /* Determine if this thread has a deadline.  */
+    if (thread_ptr -> tx_thread_edf_relative_deadline != ((ULONG) 0))
+    {
+
+        /* Pickup the absolute deadline of the thread.  */
+        deadline =  thread_ptr -> tx_thread_edf_absolute_deadline;
+
+        /* Find the first thread without a deadline or with a later deadline.  */
+        do
+        {
+
+            /* Calculate the distance to the deadline of this thread, the tick
+               counter may have wrapped.  */
+            delta =  next_ptr -> tx_thread_edf_absolute_deadline - deadline;
+
+            /* Does this thread have no deadline or a later deadline?  */
+            if (next_ptr -> tx_thread_edf_relative_deadline == ((ULONG) 0))
+            {
+
+                /* Yes, insert in front of this thread.  */
+                found =  TX_TRUE;
+            }
+            else if ((delta != ((ULONG) 0)) && (delta <= ((~((ULONG) 0)) >> 1)))
+            {
+
+                /* Yes, insert in front of this thread.  */
+                found =  TX_TRUE;
+            }
+            else
+            {
+
+                /* Move to the next thread.  */
+                next_ptr =  next_ptr -> tx_thread_ready_next;
+            }
+        } while ((found == TX_FALSE) && (next_ptr != head_ptr));
+    }
+
+    /* Link the thread in front of the thread found.  When no thread was found
+       this is the head of the list, which places the thread at the end.  */
+    previous_ptr =                             next_ptr -> tx_thread_ready_previous;
+    previous_ptr -> tx_thread_ready_next =     thread_ptr;
+    next_ptr -> tx_thread_ready_previous =     thread_ptr;
+    thread_ptr -> tx_thread_ready_previous =   previous_ptr;
+    thread_ptr -> tx_thread_ready_next =       next_ptr;
+
+    /* Determine if the thread is the new head of the list.  */
+    if ((found == TX_TRUE) && (next_ptr == head_ptr))
+    {
+
+        /* Yes, move the head of the band to this thread.  */
+        _tx_thread_priority_list[((UINT) TX_THREAD_EDF_PRIORITY)] =  thread_ptr;
+
+        /* Determine if the previous head is the thread to execute and is not
+           protected by preemption-threshold.  */
+        if (_tx_thread_execute_ptr == head_ptr)
+        {
+
+            /* Check to see if preemption-threshold is not being used.  */
+            if (head_ptr -> tx_thread_preempt_threshold == head_ptr -> tx_thread_priority)
+            {
+
+                /* The earlier deadline preempts the previous head.  */
+                _tx_thread_execute_ptr =  thread_ptr;
+            }
+        }
+    }
+}
+#endif
+
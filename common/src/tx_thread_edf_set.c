@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_edf_set                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the relative deadline and the period of a        */
+/*    thread of the earliest-deadline-first band.  The first job of the   */
+/*    thread is released at the current tick, such that its absolute      */
+/*    deadline is the current tick plus the relative deadline.  A         */
+/*    relative deadline of zero removes the deadline, the thread is then  */
+/*    placed after the threads with a deadline.  The new deadline is      */
+/*    used the next time the thread becomes ready.  Time-slicing is       */
+/*    disabled for the thread.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    relative_deadline                 Deadline in ticks after the       */
+/*                                          release of each job           */
+/*    period                            Period in ticks, zero for a       */
+/*                                          single job                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_edf_set(TX_THREAD *thread_ptr, ULONG relative_deadline, ULONG period)
+{
+
+#ifdef TX_THREAD_ENABLE_EDF
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Setup the deadline and the period of the thread.  */
+    thread_ptr -> tx_thread_edf_relative_deadline =  relative_deadline;
+    thread_ptr -> tx_thread_edf_period =             period;
+
+    /* Release the first job now.  */
+    thread_ptr -> tx_thread_edf_release_time =       _tx_timer_system_clock;
+    thread_ptr -> tx_thread_edf_absolute_deadline =  _tx_timer_system_clock + relative_deadline;
+
+    /* The order of the band is the deadline order, disable time-slicing.  */
+    thread_ptr -> tx_thread_time_slice =             ((ULONG) 0);
+    thread_ptr -> tx_thread_new_time_slice =         ((ULONG) 0);
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (relative_deadline != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (period != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -139,6 +139,13 @@ volatile UINT   _tx_thread_preempt_disable; // 不允许抢占，==0时允许
 VOID            (*_tx_thread_mutex_release)(TX_THREAD *thread_ptr); // thread异常或者正常终结时 释放mutex
 
 
+/* Define the global function pointer for reader-writer lock cleanup on thread
+   completion or termination. This pointer is setup during reader-writer lock
+   creation.  */
+
+VOID            (*_tx_thread_rwlock_release)(TX_THREAD *thread_ptr);
+
+
 /* Define the global build options variable.  This contains a bit map representing
    how the ThreadX library was built. The following are the bit field definitions:
 
@@ -263,6 +270,41 @@ ULONG           _tx_thread_performance__execute_log_index;
 TX_THREAD *     _tx_thread_performance_execute_log[TX_THREAD_EXECUTE_LOG_SIZE];
 #endif
 
+#ifdef TX_THREAD_ENABLE_EDF
+
+/* Define the total number of deadline misses of earliest-deadline-first threads.  Each time
+   a thread completes a job after its absolute deadline this variable is incremented.  */
+
+ULONG           _tx_thread_edf_miss_count;
+
+#endif
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+/* Define the budget thread, which demotes or suspends threads that exhausted their CPU
+   budget and restores them when the budget is replenished.  */
+
+TX_THREAD       _tx_thread_budget_thread;
+
+
+/* Define the stack of the budget thread.  */
+
+ULONG           _tx_thread_budget_thread_stack_area[(((UINT) TX_THREAD_BUDGET_THREAD_STACK_SIZE)+((sizeof(ULONG)) - ((UINT) 1)))/sizeof(ULONG)];
+
+
+/* Define the list of threads waiting for the budget thread and the list of threads
+   waiting for the replenishment of their budget.  */
+
+TX_THREAD *     _tx_thread_budget_pending_list;
+TX_THREAD *     _tx_thread_budget_enforced_list;
+
+
+/* Define the total number of times a CPU budget was exhausted.  */
+
+ULONG           _tx_thread_budget_exhaustion_count;
+
+#endif
+
 
 /* Define special string.  */
 
@@ -297,7 +339,7 @@ const CHAR _tx_thread_special_string[] =
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_thread_create                 Create the budget thread          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -362,6 +404,9 @@ VOID  _tx_thread_initialize(VOID)
     /* Initialize the thread mutex release function pointer.  */
     _tx_thread_mutex_release =      TX_NULL;
 
+    /* Initialize the thread reader-writer lock release function pointer.  */
+    _tx_thread_rwlock_release =     TX_NULL;
+
 #ifdef TX_ENABLE_STACK_CHECKING
 
     /* Clear application registered stack error handler.  */
@@ -386,6 +431,20 @@ VOID  _tx_thread_initialize(VOID)
     /* Initialize the execute thread log.  */
     TX_MEMSET(&_tx_thread_performance_execute_log[0], 0, (sizeof(_tx_thread_performance_execute_log)));
 #endif
+
+#ifdef TX_THREAD_ENABLE_EDF
+
+    /* Clear the deadline miss counter.  */
+    _tx_thread_edf_miss_count =  ((ULONG) 0);
+#endif
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+    /* Clear the budget lists and the exhaustion counter.  */
+    _tx_thread_budget_pending_list =      TX_NULL;
+    _tx_thread_budget_enforced_list =     TX_NULL;
+    _tx_thread_budget_exhaustion_count =  ((ULONG) 0);
+#endif
 #endif
 
     /* Setup the build options flag. This is used to identify how the ThreadX library was constructed.  */
@@ -452,5 +511,17 @@ VOID  _tx_thread_initialize(VOID)
                             | TX_PORT_SPECIFIC_BUILD_OPTIONS
 #endif
                             ;
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+    /* Create the budget thread.  It is resumed by the timer interrupt when a CPU
+       budget is exhausted or replenished.  */
+    (VOID) _tx_thread_create(&_tx_thread_budget_thread,
+                             TX_CONST_CHAR_TO_CHAR_POINTER_CONVERT("Budget Thread"),
+                             _tx_thread_budget_thread_entry, ((ULONG) TX_THREAD_ID),
+                             &_tx_thread_budget_thread_stack_area[0], ((ULONG) TX_THREAD_BUDGET_THREAD_STACK_SIZE),
+                             ((UINT) TX_THREAD_BUDGET_THREAD_PRIORITY), ((UINT) TX_THREAD_BUDGET_THREAD_PRIORITY),
+                             TX_NO_TIME_SLICE, TX_DONT_START);
+#endif
 }
 
@@ -262,8 +262,29 @@ UINT            original_priority;
                            pointer to this thread.  */
                         _tx_thread_execute_ptr =  thread_ptr;
 
+#ifdef TX_THREAD_ENABLE_EDF
+
+                        /* Determine if the thread is in the earliest-deadline-first band.  */
+                        if (thread_ptr -> tx_thread_priority == ((UINT) TX_THREAD_EDF_PRIORITY))
+                        {
+
+                            /* Yes, the resume placed the thread in deadline order, which is kept.  Unless
+                               preemption-threshold protects the thread, the head of the band executes.  */
+                            if (thread_ptr -> tx_thread_preempt_threshold == thread_ptr -> tx_thread_priority)
+                            {
+
+                                /* Execute the thread with the earliest deadline.  */
+                                _tx_thread_execute_ptr =  _tx_thread_priority_list[((UINT) TX_THREAD_EDF_PRIORITY)];
+                            }
+                        }
+
+                        /* Determine if we moved to a lower priority. If so, move the thread to the front of its priority list.  */
+                        else if (original_priority < new_priority)
+#else
+
                         /* Determine if we moved to a lower priority. If so, move the thread to the front of its priority list.  */
                         if (original_priority < new_priority)
+#endif
                         {
 
                             /* Ensure that this thread is placed at the front of the priority list.  */
@@ -105,8 +105,13 @@ TX_THREAD       *thread_ptr;
     /* Pickup the thread's priority.  */
     priority =  thread_ptr -> tx_thread_priority;
 
-    /* Determine if there is another thread at the same priority.  */
+    /* Determine if there is another thread at the same priority.  Threads of the
+       earliest-deadline-first band are kept in deadline order.  */
+#ifdef TX_THREAD_ENABLE_EDF
+    if ((thread_ptr -> tx_thread_ready_next != thread_ptr) && (priority != ((UINT) TX_THREAD_EDF_PRIORITY)))
+#else
     if (thread_ptr -> tx_thread_ready_next != thread_ptr)
+#endif
     {
 
         /* Yes, there is another thread at this priority, make it the highest at
@@ -143,6 +143,12 @@ UINT            status;
         /* Disable interrupts.  */
         TX_DISABLE
 
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+        /* The reset thread is not suspended by its CPU budget.  */
+        thread_ptr -> tx_thread_budget_suspended =  TX_FALSE;
+#endif
+
         /* Finally, move into a suspended state to allow for the thread to be resumed.  */
         thread_ptr -> tx_thread_state =  TX_SUSPENDED;
 
@@ -121,6 +121,12 @@ UINT            map_index;
     if (thread_ptr -> tx_thread_state == TX_SUSPENDED) // 只能resume suspend的thread
     {
 
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+        /* Any resume ends a suspension made by the CPU budget.  */
+        thread_ptr -> tx_thread_budget_suspended =  TX_FALSE;
+#endif
+
         /* Determine if the create call is being called from initialization.  */
         if (TX_THREAD_GET_SYSTEM_STATE() >= TX_INITIALIZE_IN_PROGRESS) // 刚开机时初始化的状态
         {
@@ -449,6 +455,15 @@ UINT            map_index;
                 }
             }
         }
+#ifdef TX_THREAD_ENABLE_EDF
+        else if (priority == ((UINT) TX_THREAD_EDF_PRIORITY))
+        {
+
+            /* Other threads of the earliest-deadline-first band are ready, insert this
+               thread in deadline order.  */
+            _tx_thread_edf_ready_insert(thread_ptr);
+        }
+#endif
         else
         {
 
@@ -528,6 +543,12 @@ UINT            map_index;
         /* Clear the delayed suspension.  */
         thread_ptr -> tx_thread_delayed_suspend =  TX_FALSE;
 
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+        /* Any resume ends a suspension made by the CPU budget.  */
+        thread_ptr -> tx_thread_budget_suspended =  TX_FALSE;
+#endif
+
         /* Setup delayed suspend lifted return status.  */
         status =  TX_SUSPEND_LIFTED;
     }
@@ -124,6 +124,15 @@ VOID            (*entry_exit_notify)(TX_THREAD *notify_thread_ptr, UINT type);
         (_tx_thread_mutex_release)(thread_ptr);
     }
 
+    /* Determine if the application is using reader-writer locks.  */
+    if (_tx_thread_rwlock_release != TX_NULL)
+    {
+
+        /* Yes, call the reader-writer lock release function via a function
+           pointer that is setup during reader-writer lock creation.  */
+        (_tx_thread_rwlock_release)(thread_ptr);
+    }
+
     /* Lockout interrupts while the thread state is setup.  */
     TX_DISABLE
 
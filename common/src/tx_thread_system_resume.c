@@ -389,6 +389,15 @@ UINT            map_index;
                         }
                     }
                 }
+#ifdef TX_THREAD_ENABLE_EDF
+                else if (priority == ((UINT) TX_THREAD_EDF_PRIORITY))
+                {
+
+                    /* Other threads of the earliest-deadline-first band are ready, insert this
+                       thread in deadline order.  */
+                    _tx_thread_edf_ready_insert(thread_ptr);
+                }
+#endif
                 else
                 {
 
@@ -909,6 +918,15 @@ UINT            map_index;
                     }
                 }
             }
+#ifdef TX_THREAD_ENABLE_EDF
+            else if (priority == ((UINT) TX_THREAD_EDF_PRIORITY))
+            {
+
+                /* Other threads of the earliest-deadline-first band are ready, insert this
+                   thread in deadline order.  */
+                _tx_thread_edf_ready_insert(thread_ptr);
+            }
+#endif
             else
             {
 
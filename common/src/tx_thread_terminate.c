@@ -284,6 +284,15 @@ ULONG       suspension_sequence;
             (_tx_thread_mutex_release)(thread_ptr);
         }
 
+        /* Determine if the application is using reader-writer locks.  */
+        if (_tx_thread_rwlock_release != TX_NULL)
+        {
+
+            /* Yes, call the reader-writer lock release function via a function
+               pointer that is setup during reader-writer lock creation.  */
+            (_tx_thread_rwlock_release)(thread_ptr);
+        }
+
 #ifndef TX_NOT_INTERRUPTABLE
 
         /* Disable interrupts.  */
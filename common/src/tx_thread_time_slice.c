@@ -123,8 +123,13 @@ UINT            preempt_disable;
             _tx_timer_time_slice =  thread_ptr -> tx_thread_time_slice;
 
             /* Determine if there is another thread at the same priority and preemption-threshold
-               is not set.  Preemption-threshold overrides time-slicing.  */
+               is not set.  Preemption-threshold overrides time-slicing.  The earliest-deadline-first
+               band is kept in deadline order and is not time-sliced.  */
+#ifdef TX_THREAD_ENABLE_EDF
+            if ((thread_ptr -> tx_thread_ready_next != thread_ptr) && (thread_ptr -> tx_thread_priority != ((UINT) TX_THREAD_EDF_PRIORITY)))
+#else
             if (thread_ptr -> tx_thread_ready_next != thread_ptr)
+#endif
             {
 
                 /* Check to see if preemption-threshold is not being used.  */
@@ -43,7 +43,8 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function modifies the internal, free-running, system clock     */
-/*    as specified by the caller.                                         */
+/*    as specified by the caller.  With the 64-bit system clock, the      */
+/*    upper 32 bits are cleared.                                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -85,9 +86,22 @@ TX_INTERRUPT_SAVE_AREA
     /* Log this kernel call.  */
     TX_EL_TIME_SET_INSERT
 
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+    /* Keep the cascade clock running, such that cascaded timers still expire
+       after the correct number of ticks.  */
+    _tx_timer_cascade_offset =  _tx_timer_cascade_offset + (new_time - _tx_timer_system_clock);
+#endif
+
     /* Set the system clock time.  */
     _tx_timer_system_clock =  new_time;
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+    /* The 64-bit system clock is set to the new time as well.  */
+    _tx_timer_system_clock_upper =  ((ULONG) 0);
+#endif
+
     /* Restore interrupts.  */
     TX_RESTORE
 }
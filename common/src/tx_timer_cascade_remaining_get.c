@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_cascade_remaining_get                     PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of ticks left before a timer on a  */
+/*    cascade list expires.  If the expiration time has already passed,   */
+/*    which happens when the cascade timer is processed late, one tick is */
+/*    returned.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    ticks_left                        Ticks left before expiration      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_cascade_process         Cascade timer processing          */
+/*    _tx_timer_deactivate              Application timer deactivate      */
+/*    _tx_timer_info_get                Application timer information get */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_timer_cascade_remaining_get(TX_TIMER_INTERNAL *timer_ptr)
+{
+
+ULONG                       current_time;
+ULONG                       ticks_left;
+ULONG                       elapsed;
+
+
+    /* Pickup the cascade clock.  */
+    current_time =  _tx_timer_system_clock - _tx_timer_cascade_offset;
+
+    /* Pickup the ticks from the start of the next pass to the expiration.  The
+       expiration time is never before the start of the pass.  */
+    ticks_left =  timer_ptr -> tx_timer_internal_remaining_ticks - _tx_timer_cascade_time;
+
+    /* Calculate the ticks before the start of the next pass.  */
+    elapsed =  _tx_timer_cascade_time - current_time;
+
+    /* Determine if the cascade clock is before the start of the next pass.  */
+    if ((elapsed != ((ULONG) 0)) && (elapsed <= (TX_TIMER_ENTRIES + ((ULONG) 1))))
+    {
+
+        /* Yes, add the ticks before the start of the pass.  */
+        ticks_left =  ticks_left + elapsed;
+    }
+    else
+    {
+
+        /* The cascade timer is late, calculate the ticks since the start of
+           the pass.  */
+        elapsed =  current_time - _tx_timer_cascade_time;
+
+        /* Determine if the timer has not expired yet.  */
+        if (ticks_left > elapsed)
+        {
+
+            /* Subtract the ticks since the start of the pass.  */
+            ticks_left =  ticks_left - elapsed;
+        }
+        else
+        {
+
+            /* The expiration time has passed, expire on the next tick.  */
+            ticks_left =  ((ULONG) 1);
+        }
+    }
+
+    /* Return the ticks left.  */
+    return(ticks_left);
+}
+#endif
+#endif
+
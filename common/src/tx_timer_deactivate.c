@@ -54,7 +54,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_cascade_remaining_get   Get ticks left of cascaded timer  */
+/*    _tx_timer_service_cancel          Discard pending expiration        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -168,6 +169,28 @@ UINT                active_timer_list;
                 internal_ptr -> tx_timer_internal_remaining_ticks =  ticks_left;
             }
         }
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+        /* Determine if the timer is on one of the cascade lists.  */
+        else if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_cascade_list_start)) &&
+                 (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_cascade_list_end)))
+        {
+
+            /* Convert the expiration time of the timer back into the ticks left.  */
+            internal_ptr -> tx_timer_internal_remaining_ticks =  _tx_timer_cascade_remaining_get(internal_ptr);
+        }
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+        /* Determine if the timer is on the high-resolution timer list.  */
+        else if (list_head == &_tx_timer_high_resolution_list)
+        {
+
+            /* High-resolution timers do not use the remaining ticks, nothing
+               to adjust.  The one-shot timer of the port is left as is, an
+               early expiration just finds nothing to do.  */
+        }
+#endif
         else
         {
 
@@ -243,6 +266,17 @@ UINT                active_timer_list;
         internal_ptr -> tx_timer_internal_list_head =  TX_NULL;
     }
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+    /* Determine if an expiration of the timer is waiting for its timer service.  */
+    if (timer_ptr -> tx_timer_service_pending == TX_TRUE)
+    {
+
+        /* Yes, discard the expiration.  */
+        _tx_timer_service_cancel(timer_ptr);
+    }
+#endif
+
     /* Restore interrupts to previous posture.  */
     TX_RESTORE
 
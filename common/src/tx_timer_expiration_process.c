@@ -61,6 +61,8 @@
 /*                                                                        */
 /*    _tx_thread_system_resume          Thread resume processing          */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_timer_cascade_list_get        Get cascade list for timer        */
+/*    _tx_timer_slack_apply             Move expiration within slack      */
 /*    _tx_timer_system_activate         Timer reactivate processing       */
 /*    Timer Expiration Function                                           */
 /*                                                                        */
@@ -321,6 +323,18 @@ TX_TIMER                    *timer_ptr;
                         /* Copy the reinitialize ticks into the remaining ticks.  */
                         current_timer -> tx_timer_internal_remaining_ticks =  current_timer -> tx_timer_internal_re_initialize_ticks;
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+                        /* Determine if the timer is rescheduled and has a slack.  */
+                        if ((current_timer -> tx_timer_internal_remaining_ticks != ((ULONG) 0)) &&
+                            (current_timer -> tx_timer_internal_slack != ((ULONG) 0)))
+                        {
+
+                            /* Move the next expiration within the slack.  */
+                            _tx_timer_slack_apply(current_timer);
+                        }
+#endif
+
                         /* Determine if the timer should be reactivated.  */
                         if (current_timer -> tx_timer_internal_remaining_ticks != ((ULONG) 0))
                         {
@@ -429,6 +443,17 @@ TX_TIMER                    *timer_ptr;
                             timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
                         }
 
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+                        /* Determine if the timer expires beyond the timer list.  */
+                        if (current_timer -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
+                        {
+
+                            /* Use the cascade list that covers the expiration instead.  */
+                            timer_list =  _tx_timer_cascade_list_get(current_timer);
+                        }
+#endif
+
                         /* Now put the timer on this list.  */
                         if ((*timer_list) == TX_NULL)
                         {
@@ -441,6 +466,9 @@ TX_TIMER                    *timer_ptr;
 
                             /* Setup the list head pointer.  */
                             *timer_list =  current_timer;
+
+                            /* Mark the list entry as in use.  */
+                            TX_TIMER_LIST_MAP_SET(timer_list)
                         }
                         else
                         {
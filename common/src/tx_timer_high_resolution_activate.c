@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_high_resolution_activate                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function activates the specified application timer as a        */
+/*    high-resolution timer.  The timer expires after the specified       */
+/*    number of nanoseconds and, if the reschedule time is not zero,      */
+/*    periodically after that.  High-resolution timers are driven by the  */
+/*    one-shot timer of the port instead of the periodic timer            */
+/*    interrupt, and their expiration functions are called from the       */
+/*    high-resolution timer interrupt.  The timer is stopped with         */
+/*    tx_timer_deactivate.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*    initial_nanoseconds               Initial expiration in             */
+/*                                        nanoseconds                     */
+/*    reschedule_nanoseconds            Periodic expiration in            */
+/*                                        nanoseconds, zero for a         */
+/*                                        one-shot timer                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_high_resolution_system_activate                           */
+/*                                        Place timer on the list         */
+/*    TX_TIMER_HIGH_RESOLUTION_TIME_GET Get high-resolution time          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_high_resolution_activate(TX_TIMER *timer_ptr, ULONG64 initial_nanoseconds, ULONG64 reschedule_nanoseconds)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL   *internal_ptr;
+UINT                status;
+
+
+    /* Setup internal timer pointer.  */
+    internal_ptr =  &(timer_ptr -> tx_timer_internal);
+
+    /* Disable interrupts to put the timer on the list.  */
+    TX_DISABLE
+
+    /* Check for an already active timer or an initial expiration of zero.  */
+    if (internal_ptr -> tx_timer_internal_list_head != TX_NULL)
+    {
+
+        /* Timer is already active, return an error.  */
+        status =  TX_ACTIVATE_ERROR;
+    }
+    else if (initial_nanoseconds == ((ULONG64) 0))
+    {
+
+        /* There is no expiration time, return an error.  */
+        status =  TX_ACTIVATE_ERROR;
+    }
+    else
+    {
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total activations counter.  */
+        _tx_timer_performance_activate_count++;
+
+        /* Increment the number of activations on this timer.  */
+        timer_ptr -> tx_timer_performance_activate_count++;
+#endif
+
+        /* Setup the expiration and reschedule times.  */
+        internal_ptr -> tx_timer_internal_expiration_time =  TX_TIMER_HIGH_RESOLUTION_TIME_GET() + initial_nanoseconds;
+        internal_ptr -> tx_timer_internal_reschedule_time =  reschedule_nanoseconds;
+
+        /* Place the timer on the high-resolution timer list.  */
+        _tx_timer_high_resolution_system_activate(internal_ptr);
+
+        /* Return successful completion.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
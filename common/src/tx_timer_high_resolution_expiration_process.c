@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_high_resolution_expiration_process        PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the high-resolution timer interrupt of   */
+/*    the port.  It removes every high-resolution timer whose expiration  */
+/*    time has passed from the list and calls its expiration function.    */
+/*    Periodic timers are placed back on the list first, at the next      */
+/*    multiple of their period, so their expirations do not drift.        */
+/*    Finally, the one-shot timer of the port is programmed for the next  */
+/*    expiration, or stopped if no timer is left.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_system_deactivate       Timer deactivate                  */
+/*    _tx_timer_high_resolution_system_activate                           */
+/*                                        Place timer on the list         */
+/*    TX_TIMER_HIGH_RESOLUTION_TIME_GET Get high-resolution time          */
+/*    TX_TIMER_HIGH_RESOLUTION_SET      Program one-shot timer            */
+/*    Timer Expiration Function                                           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    High-resolution timer interrupt                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_high_resolution_expiration_process(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           *current_timer;
+TX_TIMER_INTERNAL           *saved_expired_timer;
+VOID                        (*timeout_function)(ULONG id);
+ULONG                       timeout_param;
+ULONG64                     current_time;
+ULONG64                     periods;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Save the timer being processed by the timer thread, which this interrupt
+       may have interrupted.  */
+    saved_expired_timer =  _tx_timer_expired_timer_ptr;
+
+    /* Pickup the current high-resolution time.  */
+    current_time =  TX_TIMER_HIGH_RESOLUTION_TIME_GET();
+
+    /* Process all the timers that have expired.  */
+    current_timer =  _tx_timer_high_resolution_list;
+    while ((current_timer != TX_NULL) && (current_timer -> tx_timer_internal_expiration_time <= current_time))
+    {
+
+        /* Remove the timer from the list.  */
+        _tx_timer_system_deactivate(current_timer);
+
+        /* Pickup the expiration function and its parameter.  */
+        timeout_function =  current_timer -> tx_timer_internal_timeout_function;
+        timeout_param =     current_timer -> tx_timer_internal_timeout_param;
+
+        /* Determine if the timer is periodic.  */
+        if (current_timer -> tx_timer_internal_reschedule_time != ((ULONG64) 0))
+        {
+
+            /* Calculate the number of periods that have passed, at least one.  */
+            periods =  ((current_time - current_timer -> tx_timer_internal_expiration_time) /
+                                current_timer -> tx_timer_internal_reschedule_time) + ((ULONG64) 1);
+
+            /* Move the expiration time past the current time.  */
+            current_timer -> tx_timer_internal_expiration_time =
+                    current_timer -> tx_timer_internal_expiration_time + (periods * current_timer -> tx_timer_internal_reschedule_time);
+
+            /* Place the timer back on the list.  */
+            _tx_timer_high_resolution_system_activate(current_timer);
+        }
+
+        /* Setup the expired timer pointer, which is used by the thread
+           timeout function of some ports.  */
+        _tx_timer_expired_timer_ptr =  current_timer;
+
+        /* Restore interrupts for the expiration function call.  */
+        TX_RESTORE
+
+        /* Call the expiration function.  */
+        (timeout_function) (timeout_param);
+
+        /* Lockout interrupts again.  */
+        TX_DISABLE
+
+        /* Pickup the current high-resolution time again, the expiration
+           function may take some time.  */
+        current_time =  TX_TIMER_HIGH_RESOLUTION_TIME_GET();
+
+        /* Pickup the next timer to expire.  */
+        current_timer =  _tx_timer_high_resolution_list;
+    }
+
+    /* Restore the timer being processed by the timer thread.  */
+    _tx_timer_expired_timer_ptr =  saved_expired_timer;
+
+    /* Determine if there is a timer left.  */
+    if (current_timer != TX_NULL)
+    {
+
+        /* Program the one-shot timer for the next expiration.  */
+        TX_TIMER_HIGH_RESOLUTION_SET(current_timer -> tx_timer_internal_expiration_time);
+    }
+    else
+    {
+
+        /* Stop the one-shot timer.  */
+        TX_TIMER_HIGH_RESOLUTION_SET(((ULONG64) 0));
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+#endif
+
@@ -61,7 +61,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_cascade_remaining_get   Get ticks left of cascaded timer  */
+/*    TX_TIMER_HIGH_RESOLUTION_TIME_GET Get high-resolution time          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -87,6 +88,9 @@ TX_TIMER_INTERNAL   **list_head;
 ULONG               ticks_left;
 UINT                timer_active;
 UINT                active_timer_list;
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+ULONG64             current_time;
+#endif
 
 
     /* Disable interrupts.  */
@@ -177,6 +181,36 @@ UINT                active_timer_list;
             }
 
         }
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+        /* Determine if the timer is on one of the cascade lists.  */
+        else if ((internal_ptr -> tx_timer_internal_list_head >= _tx_timer_cascade_list_start) &&
+                 (internal_ptr -> tx_timer_internal_list_head < _tx_timer_cascade_list_end))
+        {
+
+            /* Convert the expiration time of the timer into the ticks left.  */
+            ticks_left =  _tx_timer_cascade_remaining_get(internal_ptr);
+        }
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+        /* Determine if the timer is on the high-resolution timer list.  */
+        else if (internal_ptr -> tx_timer_internal_list_head == &_tx_timer_high_resolution_list)
+        {
+
+            /* Pickup the current high-resolution time.  */
+            current_time =  TX_TIMER_HIGH_RESOLUTION_TIME_GET();
+
+            /* Convert the time left before expiration into ticks, rounded up.  */
+            ticks_left =  ((ULONG) 0);
+            if (internal_ptr -> tx_timer_internal_expiration_time > current_time)
+            {
+
+                ticks_left =  (ULONG) (((internal_ptr -> tx_timer_internal_expiration_time - current_time) +
+                                        (TX_TIMER_HIGH_RESOLUTION_TICK_NANOSECONDS - ((ULONG64) 1))) / TX_TIMER_HIGH_RESOLUTION_TICK_NANOSECONDS);
+            }
+        }
+#endif
         else
         {
 
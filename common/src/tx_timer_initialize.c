@@ -42,6 +42,14 @@
 volatile ULONG      _tx_timer_system_clock;
 
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+/* Define the upper 32 bits of the 64-bit system clock.  */
+
+ULONG               _tx_timer_system_clock_upper;
+#endif
+
+
 /* Define the time-slice expiration flag.  This is used to indicate that a time-slice
    has happened.  */
 
@@ -67,6 +75,22 @@ TX_TIMER_INTERNAL   **_tx_timer_list_end;
 TX_TIMER_INTERNAL   **_tx_timer_current_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the map of timer list entries in use.  */
+
+ULONG               _tx_timer_list_map;
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define the high-resolution timer list.  */
+
+TX_TIMER_INTERNAL   *_tx_timer_high_resolution_list;
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer
    has expired.  */
 
@@ -83,11 +107,70 @@ TX_TIMER            *_tx_timer_created_ptr;
 ULONG               _tx_timer_created_count;
 
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+/* Define the created timer service list head pointer.  */
+
+TX_TIMER_SERVICE    *_tx_timer_service_created_ptr;
+
+
+/* Define the created timer service count.  */
+
+ULONG               _tx_timer_service_created_count;
+#endif
+
+
 /* Define the pointer to the timer that has expired and is being processed.  */
 
 TX_TIMER_INTERNAL  *_tx_timer_expired_timer_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+/* Define the cascade lists for timers that expire beyond the timer list.  */
+
+TX_TIMER_INTERNAL   *_tx_timer_cascade_list[TX_TIMER_CASCADE_LEVELS][TX_TIMER_ENTRIES];
+
+
+/* Define the boundary pointers to the cascade lists.  */
+
+TX_TIMER_INTERNAL   **_tx_timer_cascade_list_start;
+TX_TIMER_INTERNAL   **_tx_timer_cascade_list_end;
+
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the maps of cascade list entries in use.  */
+
+ULONG               _tx_timer_cascade_map[TX_TIMER_CASCADE_LEVELS];
+#endif
+
+
+/* Define the cascade clock value at which the next pass through the timer list
+   starts.  */
+
+ULONG               _tx_timer_cascade_time;
+
+
+/* Define the flag that indicates the cascade timer is in use.  */
+
+UINT                _tx_timer_cascade_active;
+
+
+/* Define the offset of the system clock from the clock used by the cascade
+   lists.  */
+
+ULONG               _tx_timer_cascade_offset;
+
+
+/* Define the internal timer that moves timers from the cascade lists into the
+   timer list.  */
+
+TX_TIMER            _tx_timer_cascade_timer;
+
+#endif
+
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
 /* Define the timer thread's control block.  */
@@ -123,6 +206,20 @@ UINT                _tx_timer_processing_active;
 
 #endif
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+/* Define the total number of expirations moved within the slack of a timer.  */
+
+ULONG               _tx_timer_slack_deferral_count;
+
+
+/* Define the total number of expirations placed on a timer list entry that
+   already holds a timer, which saves a timer wakeup.  */
+
+ULONG               _tx_timer_slack_coalesce_count;
+
+#endif
+
 #ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of timer activations.  */
@@ -214,6 +311,12 @@ UINT    status;
     /* Initialize the system clock to 0.  */
     _tx_timer_system_clock =  ((ULONG) 0);
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+    /* Initialize the upper 32 bits of the 64-bit system clock to 0.  */
+    _tx_timer_system_clock_upper =  ((ULONG) 0);
+#endif
+
     /* Initialize the time-slice value to 0 to make sure it is disabled.  */
     _tx_timer_time_slice =  ((ULONG) 0);
 
@@ -228,6 +331,18 @@ UINT    status;
 
     /* First, initialize the timer list.  */
     TX_MEMSET(&_tx_timer_list[0], 0, (sizeof(_tx_timer_list)));
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Clear the map of timer list entries in use.  */
+    _tx_timer_list_map =  ((ULONG) 0);
+#endif
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+    /* Clear the high-resolution timer list.  */
+    _tx_timer_high_resolution_list =  TX_NULL;
+#endif
 #endif
 
     /* Initialize all of the list pointers.  */
@@ -239,6 +354,34 @@ UINT    status;
     _tx_timer_list_end =     &_tx_timer_list[TX_TIMER_ENTRIES-((ULONG) 1)];
     _tx_timer_list_end =     TX_TIMER_POINTER_ADD(_tx_timer_list_end, ((ULONG) 1));
 
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+#ifndef TX_DISABLE_REDUNDANT_CLEARING
+
+    /* Initialize the cascade lists and mark the cascade timer as not in use.  */
+    TX_MEMSET(&_tx_timer_cascade_list[0][0], 0, (sizeof(_tx_timer_cascade_list)));
+    TX_MEMSET(&_tx_timer_cascade_timer, 0, (sizeof(TX_TIMER)));
+    _tx_timer_cascade_time =    ((ULONG) 0);
+    _tx_timer_cascade_active =  TX_FALSE;
+    _tx_timer_cascade_offset =  ((ULONG) 0);
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Clear the maps of cascade list entries in use.  */
+    TX_MEMSET(&_tx_timer_cascade_map[0], 0, (sizeof(_tx_timer_cascade_map)));
+#endif
+#endif
+
+    /* Setup the boundary pointers of the cascade lists.  */
+    _tx_timer_cascade_list_start =  &_tx_timer_cascade_list[0][0];
+    _tx_timer_cascade_list_end =    &_tx_timer_cascade_list[TX_TIMER_CASCADE_LEVELS-((UINT) 1)][TX_TIMER_ENTRIES-((ULONG) 1)];
+    _tx_timer_cascade_list_end =    TX_TIMER_POINTER_ADD(_tx_timer_cascade_list_end, ((ULONG) 1));
+
+    /* Setup the cascade timer.  It is a one-shot timer that is rescheduled by
+       its own expiration routine.  */
+    _tx_timer_cascade_timer.tx_timer_internal.tx_timer_internal_timeout_function =  &(_tx_timer_cascade_process);
+#endif
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
     /* Setup the variables associated with the system timer thread's stack and
@@ -291,6 +434,22 @@ UINT    status;
     /* Set the created count to zero.  */
     _tx_timer_created_count =  TX_EMPTY;
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+    /* Initialize the head pointer of the created timer service list.  */
+    _tx_timer_service_created_ptr =    TX_NULL;
+
+    /* Set the created timer service count to zero.  */
+    _tx_timer_service_created_count =  TX_EMPTY;
+#endif
+
+#ifdef TX_TIMER_ENABLE_SLACK
+
+    /* Initialize the timer slack counters.  */
+    _tx_timer_slack_deferral_count =  ((ULONG) 0);
+    _tx_timer_slack_coalesce_count =  ((ULONG) 0);
+#endif
+
 #ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
 
     /* Initialize timer performance counters.  */
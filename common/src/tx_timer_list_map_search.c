@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_list_map_search                           PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the first entry in use of a timer list or a     */
+/*    cascade list level, starting at the specified offset from the base  */
+/*    entry and wrapping around the end of the list.  Map bits of         */
+/*    entries that are found to be empty are cleared along the way.  This */
+/*    function must be called with interrupts disabled.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    list_map_ptr                      Pointer to map of entries in use  */
+/*    list_start                        Pointer to first list entry       */
+/*    base                              Index of the base entry           */
+/*    offset                            Offset from the base entry to     */
+/*                                        start the search at             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    offset                            Offset from the base entry of the */
+/*                                        first entry in use, or          */
+/*                                        TX_TIMER_ENTRIES if none        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    tx_timer_get_next                 Get next timer expiration         */
+/*    tx_time_increment                 Increment the ThreadX time        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_timer_list_map_search(ULONG *list_map_ptr, TX_TIMER_INTERNAL **list_start, ULONG base, ULONG offset)
+{
+
+TX_TIMER_INTERNAL           **timer_list;
+ULONG                       list_map;
+ULONG                       search_map;
+ULONG                       entry;
+ULONG                       result;
+UINT                        bit;
+
+
+    /* Pickup the map and rotate it, such that bit 0 is the base entry.  */
+    list_map =  *list_map_ptr;
+    if (base != ((ULONG) 0))
+    {
+
+        /* Rotate the map.  Only the lower TX_TIMER_ENTRIES bits are used.  */
+        list_map =  ((list_map >> base) | (list_map << (TX_TIMER_ENTRIES - base))) & ((ULONG) 0xFFFFFFFFUL);
+    }
+
+    /* Remove the entries before the starting offset.  */
+    if (offset >= TX_TIMER_ENTRIES)
+    {
+
+        /* Nothing left to search.  */
+        list_map =  ((ULONG) 0);
+    }
+    else
+    {
+
+        /* Clear the bits below the offset.  */
+        list_map =  list_map & (~((((ULONG) 1) << offset) - ((ULONG) 1)));
+    }
+
+    /* Default to no entry in use.  */
+    result =  TX_TIMER_ENTRIES;
+
+    /* Loop until an entry in use is found or the map is exhausted.  */
+    while (list_map != ((ULONG) 0))
+    {
+
+        /* Find the closest entry in the map.  */
+        search_map =  list_map;
+        TX_LOWEST_SET_BIT_CALCULATE(search_map, bit)
+
+        /* Calculate the index of this entry.  */
+        entry =  (base + ((ULONG) bit)) & (TX_TIMER_ENTRIES - ((ULONG) 1));
+        timer_list =  TX_TIMER_POINTER_ADD(list_start, entry);
+
+        /* Determine if the entry still has timers.  */
+        if ((*timer_list) != TX_NULL)
+        {
+
+            /* Yes, return its offset.  */
+            result =  (ULONG) bit;
+
+            /* Stop searching.  */
+            list_map =  ((ULONG) 0);
+        }
+        else
+        {
+
+            /* The entry has become empty, clear it in the map.  */
+            *list_map_ptr =  (*list_map_ptr) & (~(((ULONG) 1) << entry));
+
+            /* Move past this entry.  */
+            list_map =  list_map & (~(((ULONG) 1) << bit));
+        }
+    }
+
+    /* Return the offset of the entry found.  */
+    return(result);
+}
+#endif
+#endif
+
@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_service_bind                              PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function binds an application timer to a timer service.  From  */
+/*    the next expiration on, the expiration function of the timer is     */
+/*    called by the timer service thread instead of the system timer      */
+/*    thread.  A TX_NULL timer service pointer binds the timer to the     */
+/*    system timer thread again.  An expiration waiting for the previous  */
+/*    timer service is discarded.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*    service_ptr                       Pointer to timer service          */
+/*                                          control block                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_service_cancel          Discard a pending expiration      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_service_bind(TX_TIMER *timer_ptr, TX_TIMER_SERVICE *service_ptr)
+{
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the timer is bound to a timer service.  */
+    if (timer_ptr -> tx_timer_service != TX_NULL)
+    {
+
+        /* Determine if an expiration is waiting for the timer service.  */
+        if (timer_ptr -> tx_timer_service_pending == TX_TRUE)
+        {
+
+            /* Yes, discard the expiration.  */
+            _tx_timer_service_cancel(timer_ptr);
+        }
+
+        /* Restore the expiration function of the timer.  */
+        timer_ptr -> tx_timer_internal.tx_timer_internal_timeout_function =  timer_ptr -> tx_timer_service_function;
+        timer_ptr -> tx_timer_service_function =                              TX_NULL;
+        timer_ptr -> tx_timer_service =                                       TX_NULL;
+    }
+
+    /* Determine if the timer is bound to a new timer service.  */
+    if (service_ptr != TX_NULL)
+    {
+
+        /* Save the expiration function of the timer and replace it with the
+           dispatch function of the timer service.  */
+        timer_ptr -> tx_timer_service_function =                              timer_ptr -> tx_timer_internal.tx_timer_internal_timeout_function;
+        timer_ptr -> tx_timer_internal.tx_timer_internal_timeout_function =  &_tx_timer_service_dispatch;
+        timer_ptr -> tx_timer_service =                                       service_ptr;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (timer_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (service_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
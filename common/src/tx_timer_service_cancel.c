@@ -0,0 +1,126 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_service_cancel                            PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the pending expiration of a timer from the    */
+/*    list of its timer service, such that the expiration function is     */
+/*    not called.  This function must be called with interrupts           */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_deactivate              Application timer deactivate      */
+/*    _tx_timer_delete                  Application timer delete          */
+/*    _tx_timer_service_bind            Bind timer to timer service       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_service_cancel(TX_TIMER *timer_ptr)
+{
+
+TX_TIMER_SERVICE    *service_ptr;
+TX_TIMER            *previous_timer;
+TX_TIMER            *next_timer;
+
+
+    /* Pickup the timer service.  */
+    service_ptr =  timer_ptr -> tx_timer_service;
+
+    /* Pickup the timer after this timer on the pending list.  */
+    next_timer =  timer_ptr -> tx_timer_service_pending_next;
+
+    /* Determine if the timer is at the front of the pending list.  */
+    if (service_ptr -> tx_timer_service_pending_head == timer_ptr)
+    {
+
+        /* Yes, move the head to the next timer.  */
+        service_ptr -> tx_timer_service_pending_head =  next_timer;
+        previous_timer =                                TX_NULL;
+    }
+    else
+    {
+
+        /* Find the timer before this timer on the pending list.  */
+        previous_timer =  service_ptr -> tx_timer_service_pending_head;
+        while (previous_timer -> tx_timer_service_pending_next != timer_ptr)
+        {
+
+            /* Move to the next timer.  */
+            previous_timer =  previous_timer -> tx_timer_service_pending_next;
+        }
+
+        /* Unlink the timer.  */
+        previous_timer -> tx_timer_service_pending_next =  next_timer;
+    }
+
+    /* Determine if the timer is at the end of the pending list.  */
+    if (service_ptr -> tx_timer_service_pending_tail == timer_ptr)
+    {
+
+        /* Yes, the previous timer is now the last one.  */
+        service_ptr -> tx_timer_service_pending_tail =  previous_timer;
+    }
+
+    /* The timer is no longer pending.  */
+    timer_ptr -> tx_timer_service_pending_next =  TX_NULL;
+    timer_ptr -> tx_timer_service_pending =       TX_FALSE;
+}
+#endif
+
@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_service_create                            PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a timer service, which is a thread that       */
+/*    calls the expiration functions of the application timers bound to   */
+/*    it.  The thread runs at the specified priority, such that the       */
+/*    expiration functions of timers bound to a high priority timer       */
+/*    service preempt those of timers bound to a lower priority timer     */
+/*    service or to the system timer thread.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    service_ptr                       Pointer to timer service          */
+/*                                          control block                 */
+/*    name_ptr                          Pointer to timer service name     */
+/*    priority                          Priority of the timer service     */
+/*                                          thread                        */
+/*    stack_start                       Pointer to start of stack         */
+/*    stack_size                        Size of the stack in bytes        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_create                 Create the timer service thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_service_create(TX_TIMER_SERVICE *service_ptr, CHAR *name_ptr, UINT priority,
+                                VOID *stack_start, ULONG stack_size)
+{
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Initialize timer service control block to all zeros.  */
+    TX_MEMSET(service_ptr, 0, (sizeof(TX_TIMER_SERVICE)));
+
+    /* Setup the basic timer service fields.  */
+    service_ptr -> tx_timer_service_name =  name_ptr;
+
+    /* Create the timer service thread.  It is not started, the first
+       expiration of a bound timer resumes it.  */
+    status =  _tx_thread_create(&(service_ptr -> tx_timer_service_thread), name_ptr,
+                                _tx_timer_service_thread_entry, ((ULONG) 0),
+                                stack_start, stack_size, priority, priority,
+                                TX_NO_TIME_SLICE, TX_DONT_START);
+
+    /* Determine if the timer service thread was created.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Disable interrupts to place the timer service on the created list.  */
+        TX_DISABLE
+
+        /* Setup the timer service ID to make it valid.  */
+        service_ptr -> tx_timer_service_id =  TX_TIMER_SERVICE_ID;
+
+        /* Place the timer service at the front of the created list.  Timer
+           services are never deleted, so the list is only added to.  */
+        service_ptr -> tx_timer_service_created_next =  _tx_timer_service_created_ptr;
+        _tx_timer_service_created_ptr =                 service_ptr;
+
+        /* Increment the created count.  */
+        _tx_timer_service_created_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* No, undo the partial creation so the control block is left
+           invalid and can be created again.  */
+        TX_MEMSET(service_ptr, 0, (sizeof(TX_TIMER_SERVICE)));
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (service_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (name_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (priority != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (stack_start != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (stack_size != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
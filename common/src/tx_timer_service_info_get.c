@@ -0,0 +1,192 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_service_info_get                          PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information and the expiration lag          */
+/*    statistics of the specified timer service.  The lag of an           */
+/*    expiration is the number of ticks from the expiration of the timer  */
+/*    until the timer service thread calls its expiration function.  An   */
+/*    overrun is an expiration of a timer whose previous expiration is    */
+/*    still waiting for the timer service, such an expiration is not      */
+/*    delivered.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    service_ptr                       Pointer to timer service          */
+/*                                          control block                 */
+/*    name                              Destination for the timer         */
+/*                                          service name                  */
+/*    expirations                       Destination for the number of     */
+/*                                          expiration functions called   */
+/*    lag_total                         Destination for the total lag     */
+/*                                          in ticks                      */
+/*    lag_maximum                       Destination for the maximum lag   */
+/*                                          in ticks                      */
+/*    overruns                          Destination for the number of     */
+/*                                          overruns                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_service_info_get(TX_TIMER_SERVICE *service_ptr, CHAR **name, ULONG *expirations,
+                                    ULONG *lag_total, ULONG *lag_maximum, ULONG *overruns)
+{
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Retrieve the name of the timer service.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  service_ptr -> tx_timer_service_name;
+    }
+
+    /* Retrieve the number of expiration functions called.  */
+    if (expirations != TX_NULL)
+    {
+
+        *expirations =  service_ptr -> tx_timer_service_expiration_count;
+    }
+
+    /* Retrieve the total lag.  */
+    if (lag_total != TX_NULL)
+    {
+
+        *lag_total =  service_ptr -> tx_timer_service_lag_total;
+    }
+
+    /* Retrieve the maximum lag.  */
+    if (lag_maximum != TX_NULL)
+    {
+
+        *lag_maximum =  service_ptr -> tx_timer_service_lag_maximum;
+    }
+
+    /* Retrieve the number of overruns.  */
+    if (overruns != TX_NULL)
+    {
+
+        *overruns =  service_ptr -> tx_timer_service_overrun_count;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (service_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (name != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (expirations != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (lag_total != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (lag_maximum != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (overruns != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,220 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.                                        */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include "tx_barrier.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_barrier_create                                  PORTABLE C     */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the create barrier function      */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    barrier_ptr                       Pointer to barrier control block  */
+/*    name_ptr                          Pointer to barrier name           */
+/*    thread_count                      Number of threads to release the  */
+/*                                        barrier                         */
+/*    barrier_control_block_size        Size of barrier control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_BARRIER_ERROR                  Invalid barrier pointer           */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    TX_SIZE_ERROR                     Invalid thread count              */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_barrier_create                Actual create barrier function    */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_barrier_create(TX_BARRIER *barrier_ptr, CHAR *name_ptr, UINT thread_count, UINT barrier_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           i;
+TX_BARRIER      *next_barrier;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid barrier pointer.  */
+    if (barrier_ptr == TX_NULL)
+    {
+
+        /* Barrier pointer is invalid, return appropriate error code.  */
+        status =  TX_BARRIER_ERROR;
+    }
+
+    /* Now check to make sure the control block is the correct size.  */
+    else if (barrier_control_block_size != (sizeof(TX_BARRIER)))
+    {
+
+        /* Barrier pointer is invalid, return appropriate error code.  */
+        status =  TX_BARRIER_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_barrier =   _tx_barrier_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_barrier_created_count; i++)
+        {
+
+            /* Determine if this barrier matches the barrier in the list.  */
+            if (barrier_ptr == next_barrier)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next barrier.  */
+                next_barrier =  next_barrier -> tx_barrier_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate barrier.  */
+        if (barrier_ptr == next_barrier)
+        {
+
+            /* Barrier is already created, return appropriate error code.  */
+            status =  TX_BARRIER_ERROR;
+        }
+
+        /* Check for an invalid thread count.  */
+        else if (thread_count == ((UINT) 0))
+        {
+
+            /* A barrier must be released by at least one thread.  */
+            status =  TX_SIZE_ERROR;
+        }
+        else
+        {
+
+            /* Barrier parameters are okay.  */
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(thread_ptr)
+
+        /* Check for invalid caller of this function.  First check for a calling thread.  */
+        if (thread_ptr == &_tx_timer_thread)
+        {
+
+            /* Invalid caller of this function, return appropriate error code.  */
+            status =  TX_CALLER_ERROR;
+        }
+#endif
+
+        /* Check for interrupt call.  */
+        if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+        {
+
+            /* Now, make sure the call is from an interrupt and not initialization.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual barrier create function.  */
+        status =  _tx_barrier_create(barrier_ptr, name_ptr, thread_count);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
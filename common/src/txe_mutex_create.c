@@ -58,7 +58,7 @@
 /*                                                                        */
 /*    TX_MUTEX_ERROR                    Invalid mutex pointer             */
 /*    TX_CALLER_ERROR                   Invalid caller of this function   */
-/*    TX_INHERIT_ERROR                  Invalid inherit option            */
+/*    TX_INHERIT_ERROR                  Invalid inherit or ceiling option */
 /*    status                            Actual completion status          */
 /*                                                                        */
 /*  CALLS                                                                 */
@@ -170,8 +170,21 @@ TX_THREAD       *thread_ptr;
                 if (inherit != TX_NO_INHERIT)
                 {
 
-                    /* Inherit option is illegal.  */
-                    status =  TX_INHERIT_ERROR;
+                    /* Determine if a priority ceiling is requested.  */
+                    if ((inherit & TX_CEILING_PROTOCOL) == ((UINT) 0))
+                    {
+
+                        /* Inherit option is illegal.  */
+                        status =  TX_INHERIT_ERROR;
+                    }
+
+                    /* Check for a valid ceiling priority.  */
+                    else if ((inherit & ((UINT) (~TX_CEILING_PROTOCOL))) >= ((UINT) TX_MAX_PRIORITIES))
+                    {
+
+                        /* Ceiling priority is illegal.  */
+                        status =  TX_INHERIT_ERROR;
+                    }
                 }
             }
         }
@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.                                        */
+
+#include "tx_api.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_rwlock_info_get                                 PORTABLE C     */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the reader-writer lock           */
+/*    information get service.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                        Pointer to rwlock control block   */
+/*    name                              Destination for the lock name     */
+/*    reader_count                      Destination for the number of     */
+/*                                        read holds                      */
+/*    writer                            Destination for the writer's      */
+/*                                        thread control block pointer    */
+/*    first_read_suspended              Destination for pointer of first  */
+/*                                        thread waiting to read          */
+/*    read_suspended_count              Destination for number of threads */
+/*                                        waiting to read                 */
+/*    first_write_suspended             Destination for pointer of first  */
+/*                                        thread waiting to write         */
+/*    write_suspended_count             Destination for number of threads */
+/*                                        waiting to write                */
+/*    next_rwlock                       Destination for pointer to next   */
+/*                                        lock on the created list        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_RWLOCK_ERROR                   Invalid rwlock pointer            */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_rwlock_info_get               Actual rwlock info get service    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_rwlock_info_get(TX_RWLOCK *rwlock_ptr, CHAR **name, ULONG *reader_count, TX_THREAD **writer,
+                    TX_THREAD **first_read_suspended, ULONG *read_suspended_count,
+                    TX_THREAD **first_write_suspended, ULONG *write_suspended_count,
+                    TX_RWLOCK **next_rwlock)
+{
+
+UINT        status;
+
+
+    /* Check for an invalid reader-writer lock pointer.  */
+    if (rwlock_ptr == TX_NULL)
+    {
+
+        /* Reader-writer lock pointer is invalid, return appropriate error code.  */
+        status =  TX_RWLOCK_ERROR;
+    }
+
+    /* Now check for invalid reader-writer lock ID.  */
+    else if (rwlock_ptr -> tx_rwlock_id != TX_RWLOCK_ID)
+    {
+
+        /* Reader-writer lock pointer is invalid, return appropriate error code.  */
+        status =  TX_RWLOCK_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual reader-writer lock information get service.  */
+        status =  _tx_rwlock_info_get(rwlock_ptr, name, reader_count, writer, first_read_suspended,
+                                      read_suspended_count, first_write_suspended, write_suspended_count, next_rwlock);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_thread_budget_set                              PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the thread CPU budget set        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    budget                            Ticks of execution per period     */
+/*    period                            Budget period in ticks            */
+/*    action                            TX_BUDGET_DEMOTE or               */
+/*                                          TX_BUDGET_SUSPEND             */
+/*    priority                          Priority of a demoted thread      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_budget_set             Actual thread budget set          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_thread_budget_set(TX_THREAD *thread_ptr, ULONG budget, ULONG period, UINT action, UINT priority)
+{
+
+UINT        status;
+
+
+    /* Check for an invalid thread pointer.  */
+    if (thread_ptr == TX_NULL)
+    {
+
+        /* Thread pointer is invalid, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+
+    /* Now check for invalid thread ID.  */
+    else if (thread_ptr -> tx_thread_id != TX_THREAD_ID)
+    {
+
+        /* Thread pointer is invalid, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+    /* Check for the budget thread.  */
+    else if (thread_ptr == &_tx_thread_budget_thread)
+    {
+
+        /* The budget thread can't have a budget, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+#endif
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+    /* Check for the system timer thread.  */
+    else if (thread_ptr == &_tx_timer_thread)
+    {
+
+        /* The timer thread can't have a budget, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+#endif
+
+    /* Check for a budget beyond its period.  */
+    else if ((budget != ((ULONG) 0)) && (budget > period))
+    {
+
+        /* Budget is invalid, return appropriate error code.  */
+        status =  TX_TICK_ERROR;
+    }
+
+    /* Check for an invalid action.  */
+    else if (action > TX_BUDGET_SUSPEND)
+    {
+
+        /* Action is invalid, return appropriate error code.  */
+        status =  TX_OPTION_ERROR;
+    }
+
+    /* Check for an invalid demotion priority.  */
+    else if (priority >= ((UINT) TX_MAX_PRIORITIES))
+    {
+
+        /* Priority is invalid, return appropriate error code.  */
+        status =  TX_PRIORITY_ERROR;
+    }
+
+    /* Check for invalid caller of this function.  */
+    else if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+    {
+
+        /* Invalid caller of this function, return appropriate error code.  */
+        status =  TX_CALLER_ERROR;
+    }
+    else
+    {
+
+        /* Call actual thread budget set function.  */
+        status =  _tx_thread_budget_set(thread_ptr, budget, period, action, priority);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,243 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_timer_service_create                           PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the create timer service         */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    service_ptr                       Pointer to timer service          */
+/*                                          control block                 */
+/*    name_ptr                          Pointer to timer service name     */
+/*    priority                          Priority of the timer service     */
+/*                                          thread                        */
+/*    stack_start                       Pointer to start of stack         */
+/*    stack_size                        Size of the stack in bytes        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TIMER_ERROR                    Invalid timer service pointer     */
+/*    TX_PTR_ERROR                      Invalid stack pointer             */
+/*    TX_SIZE_ERROR                     Invalid stack size                */
+/*    TX_PRIORITY_ERROR                 Invalid thread priority           */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_timer_service_create          Actual timer service create       */
+/*                                        function                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_timer_service_create(TX_TIMER_SERVICE *service_ptr, CHAR *name_ptr, UINT priority,
+                                VOID *stack_start, ULONG stack_size)
+{
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG               i;
+#endif
+UINT                status;
+TX_TIMER_SERVICE    *next_service;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD           *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid timer service pointer.  */
+    if (service_ptr == TX_NULL)
+    {
+
+        /* Timer service pointer is invalid, return appropriate error code.  */
+        status =  TX_TIMER_ERROR;
+    }
+    else
+    {
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_service =  _tx_timer_service_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_timer_service_created_count; i++)
+        {
+
+            /* Determine if this timer service matches the timer service in the list.  */
+            if (service_ptr == next_service)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next timer service.  */
+                next_service =  next_service -> tx_timer_service_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+#else
+
+        /* Timer services are not enabled, so none can have been created.  */
+        next_service =  TX_NULL;
+#endif
+
+        /* At this point, check to see if there is a duplicate timer service.  */
+        if (service_ptr == next_service)
+        {
+
+            /* Timer service is already created, return appropriate error code.  */
+            status =  TX_TIMER_ERROR;
+        }
+
+        /* Check for invalid starting address of stack.  */
+        else if (stack_start == TX_NULL)
+        {
+
+            /* Invalid stack, return appropriate error code.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check the stack size.  */
+        else if (stack_size < ((ULONG) TX_MINIMUM_STACK))
+        {
+
+            /* Stack is not big enough, return appropriate error code.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check the priority specified.  */
+        else if (priority >= ((UINT) TX_MAX_PRIORITIES))
+        {
+
+            /* Invalid priority selected, return appropriate error code.  */
+            status =  TX_PRIORITY_ERROR;
+        }
+        else
+        {
+
+            /* Timer service parameters are okay.  */
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(thread_ptr)
+
+        /* Check for invalid caller of this function.  First check for a calling thread.  */
+        if (thread_ptr == &_tx_timer_thread)
+        {
+
+            /* Invalid caller of this function, return appropriate error code.  */
+            status =  TX_CALLER_ERROR;
+        }
+#endif
+
+        /* Check for interrupt call.  */
+        if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+        {
+
+            /* Now, make sure the call is from an interrupt and not initialization.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual timer service create function.  */
+        status =  _tx_timer_service_create(service_ptr, name_ptr, priority, stack_start, stack_size);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_timer_service_info_get                         PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the timer service information    */
+/*    get function call.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    service_ptr                       Pointer to timer service          */
+/*                                          control block                 */
+/*    name                              Destination for the timer         */
+/*                                          service name                  */
+/*    expirations                       Destination for the number of     */
+/*                                          expiration functions called   */
+/*    lag_total                         Destination for the total lag     */
+/*                                          in ticks                      */
+/*    lag_maximum                       Destination for the maximum lag   */
+/*                                          in ticks                      */
+/*    overruns                          Destination for the number of     */
+/*                                          overruns                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TIMER_ERROR                    Invalid timer service pointer     */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_service_info_get        Actual timer service info get     */
+/*                                        function                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_timer_service_info_get(TX_TIMER_SERVICE *service_ptr, CHAR **name, ULONG *expirations,
+                                    ULONG *lag_total, ULONG *lag_maximum, ULONG *overruns)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid timer service pointer.  */
+    if (service_ptr == TX_NULL)
+    {
+
+        /* Timer service pointer is invalid, return appropriate error code.  */
+        status =  TX_TIMER_ERROR;
+    }
+
+    /* Now check for invalid timer service ID.  */
+    else if (service_ptr -> tx_timer_service_id != TX_TIMER_SERVICE_ID)
+    {
+
+        /* Timer service pointer is invalid, return appropriate error code.  */
+        status =  TX_TIMER_ERROR;
+    }
+    else
+    {
+
+        /* Call actual timer service information get function.  */
+        status =  _tx_timer_service_info_get(service_ptr, name, expirations, lag_total, lag_maximum, overruns);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
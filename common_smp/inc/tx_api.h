@@ -156,6 +156,8 @@ extern   "C" {
 #define TX_NULL                         ((void *) 0)
 #define TX_INHERIT                      ((UINT)   1)
 #define TX_NO_INHERIT                   ((UINT)   0)
+#define TX_CEILING_PROTOCOL             ((UINT)   0x8000)
+#define TX_PRIORITY_CEILING(p)          (TX_CEILING_PROTOCOL | ((UINT) (p)))
 #define TX_THREAD_ENTRY                 ((UINT)   0)
 #define TX_THREAD_EXIT                  ((UINT)   1)
 #define TX_NO_SUSPENSIONS               ((UINT)   0)
@@ -182,6 +184,8 @@ extern   "C" {
 #define TX_TCP_IP                       ((UINT) 12)
 #define TX_MUTEX_SUSP                   ((UINT) 13)
 #define TX_PRIORITY_CHANGE              ((UINT) 14)
+#define TX_RWLOCK_SUSP                  ((UINT) 15)
+#define TX_BARRIER_SUSP                 ((UINT) 16)
 
 
 /* API return values.  */
@@ -222,6 +226,8 @@ extern   "C" {
 #define TX_NOT_DONE                     ((UINT) 0x20)
 #define TX_CEILING_EXCEEDED             ((UINT) 0x21)
 #define TX_INVALID_CEILING              ((UINT) 0x22)
+#define TX_RWLOCK_ERROR                 ((UINT) 0x23)
+#define TX_BARRIER_ERROR                ((UINT) 0x24)
 #define TX_FEATURE_NOT_ENABLED          ((UINT) 0xFF)
 
 
@@ -234,6 +240,21 @@ extern   "C" {
 #endif
 
 
+/* High-resolution timers keep their expiration times in nanoseconds, which requires
+   the 64-bit type of the port.  */
+
+#if defined(TX_TIMER_ENABLE_HIGH_RESOLUTION) && !defined(ULONG64_DEFINED)
+#error "TX_TIMER_ENABLE_HIGH_RESOLUTION requires ULONG64 to be defined in tx_port.h."
+#endif
+
+
+/* The 64-bit system clock is returned as ULONG64 as well.  */
+
+#if defined(TX_TIMER_ENABLE_64BIT_CLOCK) && !defined(ULONG64_DEFINED)
+#error "TX_TIMER_ENABLE_64BIT_CLOCK requires ULONG64 to be defined in tx_port.h."
+#endif
+
+
 /* Event numbers 0 through 4095 are reserved by Azure RTOS. Specific event assignments are:
 
                                 ThreadX events:     1-199
@@ -252,7 +273,7 @@ extern   "C" {
 
 /* Define event filters that can be used to selectively disable certain events or groups of events.  */
 
-#define TX_TRACE_ALL_EVENTS                 0x000007FF      /* All ThreadX events                        */
+#define TX_TRACE_ALL_EVENTS                 0x00001FFF      /* All ThreadX events                        */
 #define TX_TRACE_INTERNAL_EVENTS            0x00000001      /* ThreadX internal events                   */
 #define TX_TRACE_BLOCK_POOL_EVENTS          0x00000002      /* ThreadX Block Pool events                 */
 #define TX_TRACE_BYTE_POOL_EVENTS           0x00000004      /* ThreadX Byte Pool events                  */
@@ -264,6 +285,8 @@ extern   "C" {
 #define TX_TRACE_THREAD_EVENTS              0x00000100      /* ThreadX Thread events                     */
 #define TX_TRACE_TIME_EVENTS                0x00000200      /* ThreadX Time events                       */
 #define TX_TRACE_TIMER_EVENTS               0x00000400      /* ThreadX Timer events                      */
+#define TX_TRACE_RWLOCK_EVENTS              0x00000800      /* ThreadX Reader-Writer Lock events         */
+#define TX_TRACE_BARRIER_EVENTS             0x00001000      /* ThreadX Barrier events                    */
 #define TX_TRACE_USER_EVENTS                0x80000000UL    /* ThreadX User Events                       */
 
 
@@ -313,11 +336,33 @@ typedef struct TX_TIMER_INTERNAL_STRUCT
     struct TX_TIMER_INTERNAL_STRUCT
                         **tx_timer_internal_list_head;
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+    /* Define the number of ticks each expiration of the timer may be delayed
+       to share a tick with other timers.  */
+    ULONG               tx_timer_internal_slack;
+#endif
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+    /* Define the expiration time and the reschedule time of a high-resolution
+       timer, in nanoseconds of the high-resolution time of the port.  */
+    ULONG64             tx_timer_internal_expiration_time;
+    ULONG64             tx_timer_internal_reschedule_time;
+#endif
+
     /************* Define ThreadX SMP timer control block extensions.  *************/
 
     /* Define the timer SMP core exclusion for timer callback.  */
     ULONG               tx_timer_internal_smp_cores_excluded;
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+    /* Define the core the timer is pinned to.  The timer is placed on the
+       timer list of this core and expires in its timer thread.  */
+    UINT                tx_timer_internal_smp_core;
+#endif
+
     /************* End of ThreadX SMP timer control block extensions.  *************/
 
     /* Define optional extension to internal timer control block.  */
@@ -375,6 +420,23 @@ typedef struct TX_TIMER_STRUCT
     ULONG               tx_timer_performance__expiration_adjust_count;
 #endif
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+    /* Define the timer service the timer is bound to, along with the
+       expiration function of the timer.  The expiration function in the
+       internal timer is replaced by the dispatch of the timer service.  */
+    struct TX_TIMER_SERVICE_STRUCT
+                        *tx_timer_service;
+    VOID                (*tx_timer_service_function)(ULONG id);
+
+    /* Define the link of the pending list of the timer service, the flag
+       that indicates an expiration is pending and the time it expired.  */
+    struct TX_TIMER_STRUCT
+                        *tx_timer_service_pending_next;
+    UINT                tx_timer_service_pending;
+    ULONG               tx_timer_service_expiration_time;
+#endif
+
 } TX_TIMER;
 
 
@@ -568,6 +630,41 @@ typedef struct TX_THREAD_STRUCT
 } TX_THREAD;
 
 
+/* Define the timer service structure utilized by the application.  A timer
+   service is a thread that calls the expiration functions of the timers
+   bound to it, at its own priority.  */
+
+typedef struct TX_TIMER_SERVICE_STRUCT
+{
+
+    /* Define the timer service ID used for error checking.  */
+    ULONG               tx_timer_service_id;
+
+    /* Define the timer service's name.  */
+    CHAR                *tx_timer_service_name;
+
+    /* Define the thread that calls the expiration functions.  */
+    TX_THREAD           tx_timer_service_thread;
+
+    /* Define the list of expired timers waiting for the thread.  */
+    struct TX_TIMER_STRUCT
+                        *tx_timer_service_pending_head,
+                        *tx_timer_service_pending_tail;
+
+    /* Define the created list next pointer.  */
+    struct TX_TIMER_SERVICE_STRUCT
+                        *tx_timer_service_created_next;
+
+    /* Define the expiration lag statistics, the lag is the number of ticks
+       from the expiration until the expiration function is called.  */
+    ULONG               tx_timer_service_expiration_count;
+    ULONG               tx_timer_service_lag_total;
+    ULONG               tx_timer_service_lag_maximum;
+    ULONG               tx_timer_service_overrun_count;
+
+} TX_TIMER_SERVICE;
+
+
 /* Define the block memory pool structure utilized by the application.  */
 
 typedef struct TX_BLOCK_POOL_STRUCT
@@ -830,7 +927,8 @@ typedef struct TX_MUTEX_STRUCT
     TX_THREAD           *tx_mutex_owner;
 
     /* Define the priority inheritance flag.  If this flag is set, priority
-       inheritance will be in effect.  */
+       inheritance will be in effect.  If it is TX_CEILING_PROTOCOL, the
+       priority ceiling protocol is in effect instead.  */
     UINT                tx_mutex_inherit;
 
     /* Define the save area for the owning thread's original priority.  */
@@ -877,6 +975,24 @@ typedef struct TX_MUTEX_STRUCT
     ULONG               tx_mutex_performance__priority_inheritance_count;
 #endif
 
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+    /* Define the maximum number of iterations a thread spins waiting for
+       the owner of this mutex to release it before suspending.  */
+    ULONG               tx_mutex_spin_limit;
+
+    /* Define the number of gets that spun waiting for the owner.  */
+    ULONG               tx_mutex_spin_count;
+
+    /* Define the number of gets that obtained the mutex after spinning,
+       without suspending.  */
+    ULONG               tx_mutex_spin_success_count;
+#endif
+
+    /* Define the priority ceiling.  The owner runs at this priority or higher
+       while it holds the mutex.  Only valid for priority ceiling mutexes.  */
+    UINT                tx_mutex_ceiling_priority;
+
     /* Define the port extension in the mutex control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_MUTEX_EXTENSION
@@ -884,6 +1000,143 @@ typedef struct TX_MUTEX_STRUCT
 } TX_MUTEX;
 
 
+/* Determine if the reader-writer lock extension is defined. If not, define the
+   extension to whitespace.  */
+
+#ifndef TX_RWLOCK_EXTENSION
+#define TX_RWLOCK_EXTENSION
+#endif
+
+
+/* Define the reader-writer lock structure utilized by the application.  */
+
+typedef struct TX_RWLOCK_STRUCT
+{
+
+    /* Define the reader-writer lock ID used for error checking.  */
+    ULONG               tx_rwlock_id;
+
+    /* Define the reader-writer lock's name.  */
+    CHAR                *tx_rwlock_name;
+
+    /* Define the number of read holds currently granted.  */
+    ULONG               tx_rwlock_reader_count;
+
+    /* Define the writer pointer.  This pointer points to the thread that
+       currently holds the lock for writing, or is NULL.  */
+    TX_THREAD           *tx_rwlock_writer;
+
+    /* Define the nested write ownership count of the writer.  */
+    UINT                tx_rwlock_writer_count;
+
+    /* Define the priority inheritance flag.  If this flag is set, the writer
+       inherits the priority of the highest priority waiting thread.  */
+    UINT                tx_rwlock_inherit;
+
+    /* Define the read suspension list head along with a count of
+       how many threads are waiting for read access.  */
+    struct TX_THREAD_STRUCT
+                        *tx_rwlock_read_suspension_list;
+    UINT                tx_rwlock_read_suspended_count;
+
+    /* Define the write suspension list head along with a count of
+       how many threads are waiting for write access.  */
+    struct TX_THREAD_STRUCT
+                        *tx_rwlock_write_suspension_list;
+    UINT                tx_rwlock_write_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_RWLOCK_STRUCT
+                        *tx_rwlock_created_next,
+                        *tx_rwlock_created_previous;
+
+    /* Define the priority of the highest priority thread waiting for
+       this reader-writer lock.  */
+    UINT                tx_rwlock_highest_priority_waiting;
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of read gets.  */
+    ULONG               tx_rwlock_performance_read_get_count;
+
+    /* Define the number of write gets.  */
+    ULONG               tx_rwlock_performance_write_get_count;
+
+    /* Define the number of puts.  */
+    ULONG               tx_rwlock_performance_put_count;
+
+    /* Define the number of suspensions.  */
+    ULONG               tx_rwlock_performance_suspension_count;
+
+    /* Define the number of timeouts.  */
+    ULONG               tx_rwlock_performance_timeout_count;
+
+    /* Define the number of writer priority inheritance conditions.  */
+    ULONG               tx_rwlock_performance_priority_inheritance_count;
+#endif
+
+    /* Define the port extension in the reader-writer lock control block. This
+       is typically defined to whitespace.  */
+    TX_RWLOCK_EXTENSION
+
+} TX_RWLOCK;
+
+
+/* Determine if the barrier extension is defined. If not, define the
+   extension to whitespace.  */
+
+#ifndef TX_BARRIER_EXTENSION
+#define TX_BARRIER_EXTENSION
+#endif
+
+
+/* Define the barrier structure utilized by the application.  */
+
+typedef struct TX_BARRIER_STRUCT
+{
+
+    /* Define the barrier ID used for error checking.  */
+    ULONG               tx_barrier_id;
+
+    /* Define the barrier's name.  */
+    CHAR                *tx_barrier_name;
+
+    /* Define the number of threads that must arrive to release the barrier.  */
+    UINT                tx_barrier_thread_count;
+
+    /* Define the barrier suspension list head along with a count of
+       how many threads have arrived and are waiting for the release.  */
+    struct TX_THREAD_STRUCT
+                        *tx_barrier_suspension_list;
+    UINT                tx_barrier_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_BARRIER_STRUCT
+                        *tx_barrier_created_next,
+                        *tx_barrier_created_previous;
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of waits.  */
+    ULONG               tx_barrier_performance_wait_count;
+
+    /* Define the number of releases.  */
+    ULONG               tx_barrier_performance_release_count;
+
+    /* Define the number of suspensions.  */
+    ULONG               tx_barrier_performance_suspension_count;
+
+    /* Define the number of timeouts.  */
+    ULONG               tx_barrier_performance_timeout_count;
+#endif
+
+    /* Define the port extension in the barrier control block. This
+       is typically defined to whitespace.  */
+    TX_BARRIER_EXTENSION
+
+} TX_BARRIER;
+
+
 /* Define the queue structure utilized by the application.  */
 
 typedef struct TX_QUEUE_STRUCT
@@ -1026,6 +1279,8 @@ typedef struct TX_SEMAPHORE_STRUCT
 #define tx_thread_smp_core_exclude              _tx_thread_smp_core_exclude
 #define tx_thread_smp_core_exclude_get          _tx_thread_smp_core_exclude_get
 #define tx_thread_smp_core_get                  _tx_thread_smp_core_get
+#define tx_mutex_spin_info_get                  _tx_mutex_spin_info_get
+#define tx_mutex_spin_limit_set                 _tx_mutex_spin_limit_set
 #define tx_timer_smp_core_exclude               _tx_timer_smp_core_exclude
 #define tx_timer_smp_core_exclude_get           _tx_timer_smp_core_exclude_get
 #endif
@@ -1045,6 +1300,8 @@ extern ULONG volatile  _tx_timer_system_clock;
 UINT        _tx_thread_smp_core_exclude(TX_THREAD *thread_ptr, ULONG exclusion_map);
 UINT        _tx_thread_smp_core_exclude_get(TX_THREAD *thread_ptr, ULONG *exclusion_map_ptr);
 UINT        _tx_thread_smp_core_get(void);
+UINT        _tx_mutex_spin_info_get(TX_MUTEX *mutex_ptr, ULONG *spin_limit, ULONG *spins, ULONG *spin_successes);
+UINT        _tx_mutex_spin_limit_set(TX_MUTEX *mutex_ptr, ULONG spin_limit);
 UINT        _tx_timer_smp_core_exclude(TX_TIMER *timer_ptr, ULONG exclusion_map);
 UINT        _tx_timer_smp_core_exclude_get(TX_TIMER *timer_ptr, ULONG *exclusion_map_ptr);
 
@@ -1145,6 +1402,22 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_prioritize                         _tx_mutex_prioritize
 #define tx_mutex_put                                _tx_mutex_put
 
+#define tx_rwlock_create                            _tx_rwlock_create
+#define tx_rwlock_delete                            _tx_rwlock_delete
+#define tx_rwlock_info_get                          _tx_rwlock_info_get
+#define tx_rwlock_performance_info_get              _tx_rwlock_performance_info_get
+#define tx_rwlock_performance_system_info_get       _tx_rwlock_performance_system_info_get
+#define tx_rwlock_put                               _tx_rwlock_put
+#define tx_rwlock_read_get                          _tx_rwlock_read_get
+#define tx_rwlock_write_get                         _tx_rwlock_write_get
+
+#define tx_barrier_create                           _tx_barrier_create
+#define tx_barrier_delete                           _tx_barrier_delete
+#define tx_barrier_info_get                         _tx_barrier_info_get
+#define tx_barrier_performance_info_get             _tx_barrier_performance_info_get
+#define tx_barrier_performance_system_info_get      _tx_barrier_performance_system_info_get
+#define tx_barrier_wait                             _tx_barrier_wait
+
 #define tx_queue_create                             _tx_queue_create
 #define tx_queue_delete                             _tx_queue_delete
 #define tx_queue_flush                              _tx_queue_flush
@@ -1181,6 +1454,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_reset                             _tx_thread_reset
 #define tx_thread_resume                            _tx_thread_resume
 #define tx_thread_sleep                             _tx_thread_sleep
+#define tx_thread_sleep_ns                          _tx_thread_sleep_ns
+#define tx_thread_sleep_until                       _tx_thread_sleep_until
 #define tx_thread_stack_error_notify                _tx_thread_stack_error_notify
 #define tx_thread_suspend                           _tx_thread_suspend
 #define tx_thread_terminate                         _tx_thread_terminate
@@ -1192,6 +1467,7 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_time_get()                               (_tx_timer_system_clock)
 #else
 #define tx_time_get                                 _tx_time_get
+#define tx_time_get64                               _tx_time_get64
 #endif
 /************* End ThreadX SMP remapping of tx_time_get.  *************/
 #define tx_time_set                                 _tx_time_set
@@ -1200,9 +1476,15 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_timer_create                             _tx_timer_create
 #define tx_timer_deactivate                         _tx_timer_deactivate
 #define tx_timer_delete                             _tx_timer_delete
+#define tx_timer_high_resolution_activate           _tx_timer_high_resolution_activate
 #define tx_timer_info_get                           _tx_timer_info_get
 #define tx_timer_performance_info_get               _tx_timer_performance_info_get
 #define tx_timer_performance_system_info_get        _tx_timer_performance_system_info_get
+#define tx_timer_service_bind                       _tx_timer_service_bind
+#define tx_timer_service_create                     _tx_timer_service_create
+#define tx_timer_service_info_get                   _tx_timer_service_info_get
+#define tx_timer_slack_set                          _tx_timer_slack_set
+#define tx_timer_slack_system_info_get              _tx_timer_slack_system_info_get
 
 #define tx_trace_enable                             _tx_trace_enable
 #define tx_trace_event_filter                       _tx_trace_event_filter
@@ -1273,6 +1555,22 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_prioritize                         _txr_mutex_prioritize
 #define tx_mutex_put                                _txr_mutex_put
 
+#define tx_rwlock_create(r,n,i)                     _txr_rwlock_create((r),(n),(i),(sizeof(TX_RWLOCK)))
+#define tx_rwlock_delete                            _txr_rwlock_delete
+#define tx_rwlock_info_get                          _txr_rwlock_info_get
+#define tx_rwlock_performance_info_get              _tx_rwlock_performance_info_get
+#define tx_rwlock_performance_system_info_get       _tx_rwlock_performance_system_info_get
+#define tx_rwlock_put                               _txr_rwlock_put
+#define tx_rwlock_read_get                          _txr_rwlock_read_get
+#define tx_rwlock_write_get                         _txr_rwlock_write_get
+
+#define tx_barrier_create(b,n,c)                    _txr_barrier_create((b),(n),(c),(sizeof(TX_BARRIER)))
+#define tx_barrier_delete                           _txr_barrier_delete
+#define tx_barrier_info_get                         _txr_barrier_info_get
+#define tx_barrier_performance_info_get             _tx_barrier_performance_info_get
+#define tx_barrier_performance_system_info_get      _tx_barrier_performance_system_info_get
+#define tx_barrier_wait                             _txr_barrier_wait
+
 #define tx_queue_create(q,n,m,s,l)                  _txr_queue_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_delete                             _txr_queue_delete
 #define tx_queue_flush                              _txr_queue_flush
@@ -1309,6 +1607,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_reset                             _txr_thread_reset
 #define tx_thread_resume                            _txr_thread_resume
 #define tx_thread_sleep                             _tx_thread_sleep
+#define tx_thread_sleep_ns                          _tx_thread_sleep_ns
+#define tx_thread_sleep_until                       _tx_thread_sleep_until
 #define tx_thread_stack_error_notify                _tx_thread_stack_error_notify
 #define tx_thread_suspend                           _txr_thread_suspend
 #define tx_thread_terminate                         _txr_thread_terminate
@@ -1320,6 +1620,7 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_time_get()                               (_tx_timer_system_clock)
 #else
 #define tx_time_get                                 _tx_time_get
+#define tx_time_get64                               _tx_time_get64
 #endif
 /************* End ThreadX SMP remapping of tx_time_get.  *************/
 #define tx_time_set                                 _tx_time_set
@@ -1328,9 +1629,15 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_timer_create(t,n,e,i,c,r,a)              _txr_timer_create((t),(n),(e),(i),(c),(r),(a),(sizeof(TX_TIMER)))
 #define tx_timer_deactivate                         _txr_timer_deactivate
 #define tx_timer_delete                             _txr_timer_delete
+#define tx_timer_high_resolution_activate           _txr_timer_high_resolution_activate
 #define tx_timer_info_get                           _txr_timer_info_get
 #define tx_timer_performance_info_get               _tx_timer_performance_info_get
 #define tx_timer_performance_system_info_get        _tx_timer_performance_system_info_get
+#define tx_timer_service_bind                       _txr_timer_service_bind
+#define tx_timer_service_create                     _txr_timer_service_create
+#define tx_timer_service_info_get                   _txr_timer_service_info_get
+#define tx_timer_slack_set                          _txr_timer_slack_set
+#define tx_timer_slack_system_info_get              _tx_timer_slack_system_info_get
 
 #define tx_trace_enable                             _tx_trace_enable
 #define tx_trace_event_filter                       _tx_trace_event_filter
@@ -1390,6 +1697,22 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_prioritize                         _txe_mutex_prioritize
 #define tx_mutex_put                                _txe_mutex_put
 
+#define tx_rwlock_create(r,n,i)                     _txe_rwlock_create((r),(n),(i),(sizeof(TX_RWLOCK)))
+#define tx_rwlock_delete                            _txe_rwlock_delete
+#define tx_rwlock_info_get                          _txe_rwlock_info_get
+#define tx_rwlock_performance_info_get              _tx_rwlock_performance_info_get
+#define tx_rwlock_performance_system_info_get       _tx_rwlock_performance_system_info_get
+#define tx_rwlock_put                               _txe_rwlock_put
+#define tx_rwlock_read_get                          _txe_rwlock_read_get
+#define tx_rwlock_write_get                         _txe_rwlock_write_get
+
+#define tx_barrier_create(b,n,c)                    _txe_barrier_create((b),(n),(c),(sizeof(TX_BARRIER)))
+#define tx_barrier_delete                           _txe_barrier_delete
+#define tx_barrier_info_get                         _txe_barrier_info_get
+#define tx_barrier_performance_info_get             _tx_barrier_performance_info_get
+#define tx_barrier_performance_system_info_get      _tx_barrier_performance_system_info_get
+#define tx_barrier_wait                             _txe_barrier_wait
+
 #define tx_queue_create(q,n,m,s,l)                  _txe_queue_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_delete                             _txe_queue_delete
 #define tx_queue_flush                              _txe_queue_flush
@@ -1426,6 +1749,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_reset                             _txe_thread_reset
 #define tx_thread_resume                            _txe_thread_resume
 #define tx_thread_sleep                             _tx_thread_sleep
+#define tx_thread_sleep_ns                          _tx_thread_sleep_ns
+#define tx_thread_sleep_until                       _tx_thread_sleep_until
 #define tx_thread_stack_error_notify                _tx_thread_stack_error_notify
 #define tx_thread_suspend                           _txe_thread_suspend
 #define tx_thread_terminate                         _txe_thread_terminate
@@ -1437,6 +1762,7 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_time_get()                               (_tx_timer_system_clock)
 #else
 #define tx_time_get                                 _tx_time_get
+#define tx_time_get64                               _tx_time_get64
 #endif
 /************* End ThreadX SMP remapping of tx_time_get.  *************/
 #define tx_time_set                                 _tx_time_set
@@ -1445,9 +1771,15 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_timer_create(t,n,e,i,c,r,a)              _txe_timer_create((t),(n),(e),(i),(c),(r),(a),(sizeof(TX_TIMER)))
 #define tx_timer_deactivate                         _txe_timer_deactivate
 #define tx_timer_delete                             _txe_timer_delete
+#define tx_timer_high_resolution_activate           _txe_timer_high_resolution_activate
 #define tx_timer_info_get                           _txe_timer_info_get
 #define tx_timer_performance_info_get               _tx_timer_performance_info_get
 #define tx_timer_performance_system_info_get        _tx_timer_performance_system_info_get
+#define tx_timer_service_bind                       _txe_timer_service_bind
+#define tx_timer_service_create                     _txe_timer_service_create
+#define tx_timer_service_info_get                   _txe_timer_service_info_get
+#define tx_timer_slack_set                          _txe_timer_slack_set
+#define tx_timer_slack_system_info_get              _tx_timer_slack_system_info_get
 
 #define tx_trace_enable                             _tx_trace_enable
 #define tx_trace_event_filter                       _tx_trace_event_filter
@@ -1603,6 +1935,78 @@ UINT        _txe_mutex_prioritize(TX_MUTEX *mutex_ptr);
 UINT        _txe_mutex_put(TX_MUTEX *mutex_ptr);
 
 
+/* Define reader-writer lock management function prototypes.  */
+
+UINT        _tx_rwlock_create(TX_RWLOCK *rwlock_ptr, CHAR *name_ptr, UINT inherit);
+UINT        _tx_rwlock_delete(TX_RWLOCK *rwlock_ptr);
+UINT        _tx_rwlock_info_get(TX_RWLOCK *rwlock_ptr, CHAR **name, ULONG *reader_count, TX_THREAD **writer,
+                    TX_THREAD **first_read_suspended, ULONG *read_suspended_count,
+                    TX_THREAD **first_write_suspended, ULONG *write_suspended_count,
+                    TX_RWLOCK **next_rwlock);
+UINT        _tx_rwlock_performance_info_get(TX_RWLOCK *rwlock_ptr, ULONG *read_gets, ULONG *write_gets,
+                    ULONG *puts, ULONG *suspensions, ULONG *timeouts, ULONG *inheritances);
+UINT        _tx_rwlock_performance_system_info_get(ULONG *read_gets, ULONG *write_gets, ULONG *puts,
+                    ULONG *suspensions, ULONG *timeouts, ULONG *inheritances);
+UINT        _tx_rwlock_put(TX_RWLOCK *rwlock_ptr);
+UINT        _tx_rwlock_read_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option);
+UINT        _tx_rwlock_write_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option);
+
+
+/* Define error checking shells for API services.  These are only referenced by the
+   application.  */
+
+UINT        _txe_rwlock_create(TX_RWLOCK *rwlock_ptr, CHAR *name_ptr, UINT inherit, UINT rwlock_control_block_size);
+UINT        _txe_rwlock_delete(TX_RWLOCK *rwlock_ptr);
+UINT        _txe_rwlock_info_get(TX_RWLOCK *rwlock_ptr, CHAR **name, ULONG *reader_count, TX_THREAD **writer,
+                    TX_THREAD **first_read_suspended, ULONG *read_suspended_count,
+                    TX_THREAD **first_write_suspended, ULONG *write_suspended_count,
+                    TX_RWLOCK **next_rwlock);
+UINT        _txe_rwlock_put(TX_RWLOCK *rwlock_ptr);
+UINT        _txe_rwlock_read_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option);
+UINT        _txe_rwlock_write_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option);
+#ifdef TX_ENABLE_MULTI_ERROR_CHECKING
+UINT        _txr_rwlock_create(TX_RWLOCK *rwlock_ptr, CHAR *name_ptr, UINT inherit, UINT rwlock_control_block_size);
+UINT        _txr_rwlock_delete(TX_RWLOCK *rwlock_ptr);
+UINT        _txr_rwlock_info_get(TX_RWLOCK *rwlock_ptr, CHAR **name, ULONG *reader_count, TX_THREAD **writer,
+                    TX_THREAD **first_read_suspended, ULONG *read_suspended_count,
+                    TX_THREAD **first_write_suspended, ULONG *write_suspended_count,
+                    TX_RWLOCK **next_rwlock);
+UINT        _txr_rwlock_put(TX_RWLOCK *rwlock_ptr);
+UINT        _txr_rwlock_read_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option);
+UINT        _txr_rwlock_write_get(TX_RWLOCK *rwlock_ptr, ULONG wait_option);
+#endif
+
+
+/* Define barrier management function prototypes.  */
+
+UINT        _tx_barrier_create(TX_BARRIER *barrier_ptr, CHAR *name_ptr, UINT thread_count);
+UINT        _tx_barrier_delete(TX_BARRIER *barrier_ptr);
+UINT        _tx_barrier_info_get(TX_BARRIER *barrier_ptr, CHAR **name, ULONG *thread_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BARRIER **next_barrier);
+UINT        _tx_barrier_performance_info_get(TX_BARRIER *barrier_ptr, ULONG *waits, ULONG *releases,
+                    ULONG *suspensions, ULONG *timeouts);
+UINT        _tx_barrier_performance_system_info_get(ULONG *waits, ULONG *releases,
+                    ULONG *suspensions, ULONG *timeouts);
+UINT        _tx_barrier_wait(TX_BARRIER *barrier_ptr, UINT *last_arrival, ULONG wait_option);
+
+
+/* Define error checking shells for API services.  These are only referenced by the
+   application.  */
+
+UINT        _txe_barrier_create(TX_BARRIER *barrier_ptr, CHAR *name_ptr, UINT thread_count, UINT barrier_control_block_size);
+UINT        _txe_barrier_delete(TX_BARRIER *barrier_ptr);
+UINT        _txe_barrier_info_get(TX_BARRIER *barrier_ptr, CHAR **name, ULONG *thread_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BARRIER **next_barrier);
+UINT        _txe_barrier_wait(TX_BARRIER *barrier_ptr, UINT *last_arrival, ULONG wait_option);
+#ifdef TX_ENABLE_MULTI_ERROR_CHECKING
+UINT        _txr_barrier_create(TX_BARRIER *barrier_ptr, CHAR *name_ptr, UINT thread_count, UINT barrier_control_block_size);
+UINT        _txr_barrier_delete(TX_BARRIER *barrier_ptr);
+UINT        _txr_barrier_info_get(TX_BARRIER *barrier_ptr, CHAR **name, ULONG *thread_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BARRIER **next_barrier);
+UINT        _txr_barrier_wait(TX_BARRIER *barrier_ptr, UINT *last_arrival, ULONG wait_option);
+#endif
+
+
 /* Define queue management function prototypes.  */
 
 UINT        _tx_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
@@ -1701,6 +2105,10 @@ VOID        _tx_thread_relinquish(VOID);
 UINT        _tx_thread_reset(TX_THREAD *thread_ptr);
 UINT        _tx_thread_resume(TX_THREAD *thread_ptr);
 UINT        _tx_thread_sleep(ULONG timer_ticks);
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+UINT        _tx_thread_sleep_ns(ULONG64 nanoseconds);
+#endif
+UINT        _tx_thread_sleep_until(ULONG absolute_tick);
 UINT        _tx_thread_stack_error_notify(VOID (*stack_error_handler)(TX_THREAD *thread_ptr));
 UINT        _tx_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _tx_thread_terminate(TX_THREAD *thread_ptr);
@@ -1743,14 +2151,27 @@ UINT        _tx_timer_create(TX_TIMER *timer_ptr, CHAR *name_ptr,
                 ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate);
 UINT        _tx_timer_deactivate(TX_TIMER *timer_ptr);
 UINT        _tx_timer_delete(TX_TIMER *timer_ptr);
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+UINT        _tx_timer_high_resolution_activate(TX_TIMER *timer_ptr, ULONG64 initial_nanoseconds, ULONG64 reschedule_nanoseconds);
+#endif
 UINT        _tx_timer_info_get(TX_TIMER *timer_ptr, CHAR **name, UINT *active, ULONG *remaining_ticks,
                 ULONG *reschedule_ticks, TX_TIMER **next_timer);
 UINT        _tx_timer_performance_info_get(TX_TIMER *timer_ptr, ULONG *activates, ULONG *reactivates,
                 ULONG *deactivates, ULONG *expirations, ULONG *expiration_adjusts);
 UINT        _tx_timer_performance_system_info_get(ULONG *activates, ULONG *reactivates,
                 ULONG *deactivates, ULONG *expirations, ULONG *expiration_adjusts);
+UINT        _tx_timer_service_bind(TX_TIMER *timer_ptr, TX_TIMER_SERVICE *service_ptr);
+UINT        _tx_timer_service_create(TX_TIMER_SERVICE *service_ptr, CHAR *name_ptr, UINT priority,
+                VOID *stack_start, ULONG stack_size);
+UINT        _tx_timer_service_info_get(TX_TIMER_SERVICE *service_ptr, CHAR **name, ULONG *expirations,
+                ULONG *lag_total, ULONG *lag_maximum, ULONG *overruns);
+UINT        _tx_timer_slack_set(TX_TIMER *timer_ptr, ULONG slack_ticks);
+UINT        _tx_timer_slack_system_info_get(ULONG *deferrals, ULONG *coalesces);
 
 ULONG       _tx_time_get(VOID);
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+ULONG64     _tx_time_get64(VOID);
+#endif
 VOID        _tx_time_set(ULONG new_time);
 
 
@@ -1764,8 +2185,17 @@ UINT        _txe_timer_create(TX_TIMER *timer_ptr, CHAR *name_ptr,
                 ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate, UINT timer_control_block_size);
 UINT        _txe_timer_deactivate(TX_TIMER *timer_ptr);
 UINT        _txe_timer_delete(TX_TIMER *timer_ptr);
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+UINT        _txe_timer_high_resolution_activate(TX_TIMER *timer_ptr, ULONG64 initial_nanoseconds, ULONG64 reschedule_nanoseconds);
+#endif
 UINT        _txe_timer_info_get(TX_TIMER *timer_ptr, CHAR **name, UINT *active, ULONG *remaining_ticks,
                 ULONG *reschedule_ticks, TX_TIMER **next_timer);
+UINT        _txe_timer_service_bind(TX_TIMER *timer_ptr, TX_TIMER_SERVICE *service_ptr);
+UINT        _txe_timer_service_create(TX_TIMER_SERVICE *service_ptr, CHAR *name_ptr, UINT priority,
+                VOID *stack_start, ULONG stack_size);
+UINT        _txe_timer_service_info_get(TX_TIMER_SERVICE *service_ptr, CHAR **name, ULONG *expirations,
+                ULONG *lag_total, ULONG *lag_maximum, ULONG *overruns);
+UINT        _txe_timer_slack_set(TX_TIMER *timer_ptr, ULONG slack_ticks);
 
 
 /* Define trace API function prototypes.  */
@@ -1842,6 +2272,8 @@ TX_BYTE_POOL            **_tx_misra_uchar_to_indirect_byte_pool_pointer_convert(
 TX_EVENT_FLAGS_GROUP    *_tx_misra_void_to_event_flags_pointer_convert(VOID *pointer);
 ULONG                   *_tx_misra_void_to_ulong_pointer_convert(VOID *pointer);
 TX_MUTEX                *_tx_misra_void_to_mutex_pointer_convert(VOID *pointer);
+TX_RWLOCK               *_tx_misra_void_to_rwlock_pointer_convert(VOID *pointer);
+TX_BARRIER              *_tx_misra_void_to_barrier_pointer_convert(VOID *pointer);
 UINT                    _tx_misra_status_get(UINT status);
 TX_QUEUE                *_tx_misra_void_to_queue_pointer_convert(VOID *pointer);
 TX_SEMAPHORE            *_tx_misra_void_to_semaphore_pointer_convert(VOID *pointer);
@@ -1893,6 +2325,8 @@ VOID                    _tx_misra_thread_entry_exit_notify_not_used(VOID (*threa
 #define TX_VOID_TO_ULONG_POINTER_CONVERT(a)             _tx_misra_void_to_ulong_pointer_convert((a))
 #define TX_VOID_TO_MUTEX_POINTER_CONVERT(a)             _tx_misra_void_to_mutex_pointer_convert((a))
 #define TX_MUTEX_PRIORITIZE_MISRA_EXTENSION(a)          _tx_misra_status_get((a))
+#define TX_VOID_TO_RWLOCK_POINTER_CONVERT(a)            _tx_misra_void_to_rwlock_pointer_convert((a))
+#define TX_VOID_TO_BARRIER_POINTER_CONVERT(a)           _tx_misra_void_to_barrier_pointer_convert((a))
 #define TX_VOID_TO_QUEUE_POINTER_CONVERT(a)             _tx_misra_void_to_queue_pointer_convert((a))
 #define TX_VOID_TO_SEMAPHORE_POINTER_CONVERT(a)         _tx_misra_void_to_semaphore_pointer_convert((a))
 #define TX_UCHAR_TO_VOID_POINTER_CONVERT(a)             _tx_misra_uchar_to_void_pointer_convert((a))
@@ -1957,6 +2391,8 @@ VOID                    _tx_misra_thread_entry_exit_notify_not_used(VOID (*threa
 #define TX_VOID_TO_EVENT_FLAGS_POINTER_CONVERT(a)       ((TX_EVENT_FLAGS_GROUP *) ((VOID *) (a)))
 #define TX_VOID_TO_ULONG_POINTER_CONVERT(a)             ((ULONG *) ((VOID *) (a)))
 #define TX_VOID_TO_MUTEX_POINTER_CONVERT(a)             ((TX_MUTEX *) ((VOID *) (a)))
+#define TX_VOID_TO_RWLOCK_POINTER_CONVERT(a)            ((TX_RWLOCK *) ((VOID *) (a)))
+#define TX_VOID_TO_BARRIER_POINTER_CONVERT(a)           ((TX_BARRIER *) ((VOID *) (a)))
 #define TX_VOID_TO_QUEUE_POINTER_CONVERT(a)             ((TX_QUEUE *) ((VOID *) (a)))
 #define TX_VOID_TO_SEMAPHORE_POINTER_CONVERT(a)         ((TX_SEMAPHORE *) ((VOID *) (a)))
 #define TX_UCHAR_TO_VOID_POINTER_CONVERT(a)             ((VOID *) (a))
@@ -2102,6 +2538,16 @@ VOID                    _tx_misra_thread_entry_exit_notify_not_used(VOID (*threa
 #error "TX_MUTEX_ENABLE_PERFORMANCE_INFO must not be defined."
 #endif
 
+/* Ensure reader-writer lock performance info enable is not defined.  */
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+#error "TX_RWLOCK_ENABLE_PERFORMANCE_INFO must not be defined."
+#endif
+
+/* Ensure barrier performance info enable is not defined.  */
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+#error "TX_BARRIER_ENABLE_PERFORMANCE_INFO must not be defined."
+#endif
+
 /* Ensure queue performance info enable is not defined.  */
 #ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 #error "TX_QUEUE_ENABLE_PERFORMANCE_INFO must not be defined."
@@ -2217,6 +2663,16 @@ void __ghs_rnerr(char *errMsg, int stackLevels, int stackTraceDisplay, void *hex
 #define TX_EL_MUTEX_INFO_GET_INSERT
 #define TX_EL_MUTEX_PRIORITIZE_INSERT
 #define TX_EL_MUTEX_PUT_INSERT
+#define TX_EL_RWLOCK_CREATE_INSERT
+#define TX_EL_RWLOCK_DELETE_INSERT
+#define TX_EL_RWLOCK_INFO_GET_INSERT
+#define TX_EL_RWLOCK_PUT_INSERT
+#define TX_EL_RWLOCK_READ_GET_INSERT
+#define TX_EL_RWLOCK_WRITE_GET_INSERT
+#define TX_EL_BARRIER_CREATE_INSERT
+#define TX_EL_BARRIER_DELETE_INSERT
+#define TX_EL_BARRIER_INFO_GET_INSERT
+#define TX_EL_BARRIER_WAIT_INSERT
 #define TX_EL_QUEUE_INFO_GET_INSERT
 #define TX_EL_QUEUE_FRONT_SEND_INSERT
 #define TX_EL_QUEUE_PRIORITIZE_INSERT
@@ -2234,6 +2690,10 @@ void __ghs_rnerr(char *errMsg, int stackLevels, int stackTraceDisplay, void *hex
 #define TX_EL_EVENT_FLAGS_SET_NOTIFY_INSERT
 #define TX_EL_MUTEX_PERFORMANCE_INFO_GET_INSERT
 #define TX_EL_MUTEX_PERFORMANCE_SYSTEM_INFO_GET_INSERT
+#define TX_EL_RWLOCK_PERFORMANCE_INFO_GET_INSERT
+#define TX_EL_RWLOCK_PERFORMANCE_SYSTEM_INFO_GET_INSERT
+#define TX_EL_BARRIER_PERFORMANCE_INFO_GET_INSERT
+#define TX_EL_BARRIER_PERFORMANCE_SYSTEM_INFO_GET_INSERT
 #define TX_EL_QUEUE_PERFORMANCE_INFO_GET_INSERT
 #define TX_EL_QUEUE_PERFORMANCE_SYSTEM_INFO_GET_INSERT
 #define TX_EL_QUEUE_SEND_NOTIFY_INSERT
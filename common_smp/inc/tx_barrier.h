@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_barrier.h                                        PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX barrier management component,         */
+/*    including all data types and external references.  It is assumed    */
+/*    that tx_api.h and tx_port.h have already been included.             */
+/*                                                                        */
+/*    A barrier is created for a fixed number of threads.  Threads that   */
+/*    arrive at the barrier are suspended until the last one arrives,     */
+/*    which then releases all of them at once.  The barrier is            */
+/*    immediately ready for the next cycle.                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_BARRIER_H
+#define TX_BARRIER_H
+
+
+/* Define barrier control specific data definitions.  */
+
+#define TX_BARRIER_ID                           ((ULONG) 0x42415252)
+
+
+/* Determine if in-line component initialization is supported by the
+   caller.  */
+
+#ifdef TX_INVOKE_INLINE_INITIALIZATION
+
+/* Yes, in-line initialization is supported, remap the barrier initialization
+   function.  */
+
+#ifndef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+#define _tx_barrier_initialize() \
+                    _tx_barrier_created_ptr =                   TX_NULL;      \
+                    _tx_barrier_created_count =                 TX_EMPTY
+#else
+#define _tx_barrier_initialize() \
+                    _tx_barrier_created_ptr =                   TX_NULL;      \
+                    _tx_barrier_created_count =                 TX_EMPTY;     \
+                    _tx_barrier_performance_wait_count =        ((ULONG) 0);  \
+                    _tx_barrier_performance_release_count =     ((ULONG) 0);  \
+                    _tx_barrier_performance_suspension_count =  ((ULONG) 0);  \
+                    _tx_barrier_performance_timeout_count =     ((ULONG) 0)
+#endif
+#define TX_BARRIER_INIT
+#else
+
+/* No in-line initialization is supported, use standard function call.  */
+VOID        _tx_barrier_initialize(VOID);
+#endif
+
+
+/* Define internal barrier management function prototypes.  */
+
+VOID        _tx_barrier_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+
+
+/* Barrier management component data declarations follow.  */
+
+/* Determine if the initialization function of this component is including
+   this file.  If so, make the data definitions really happen.  Otherwise,
+   make them extern so other functions in the component can access them.  */
+
+#ifdef TX_BARRIER_INIT
+#define BARRIER_DECLARE
+#else
+#define BARRIER_DECLARE extern
+#endif
+
+
+/* Define the head pointer of the created barrier list.  */
+
+BARRIER_DECLARE  TX_BARRIER *   _tx_barrier_created_ptr;
+
+
+/* Define the variable that holds the number of created barriers. */
+
+BARRIER_DECLARE  ULONG          _tx_barrier_created_count;
+
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+/* Define the total number of barrier waits.  */
+
+BARRIER_DECLARE  ULONG          _tx_barrier_performance_wait_count;
+
+
+/* Define the total number of barrier releases.  */
+
+BARRIER_DECLARE  ULONG          _tx_barrier_performance_release_count;
+
+
+/* Define the total number of barrier suspensions.  */
+
+BARRIER_DECLARE  ULONG          _tx_barrier_performance_suspension_count;
+
+
+/* Define the total number of barrier timeouts.  */
+
+BARRIER_DECLARE  ULONG          _tx_barrier_performance_timeout_count;
+
+
+#endif
+
+
+/* Define default barrier create and delete extensions to whitespace, if they haven't
+   been defined previously (typically in tx_port.h).  */
+
+#ifndef TX_BARRIER_CREATE_EXTENSION
+#define TX_BARRIER_CREATE_EXTENSION(b)
+#endif
+
+#ifndef TX_BARRIER_DELETE_EXTENSION
+#define TX_BARRIER_DELETE_EXTENSION(b)
+#endif
+
+
+#endif
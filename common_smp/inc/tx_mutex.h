@@ -87,11 +87,22 @@ VOID        _tx_mutex_initialize(VOID);
 #endif
 
 
+/* The uncontended mutex fast path relies on preemption disable for exclusion, which does not
+   exclude threads running on other cores.  */
+
+#ifdef TX_MUTEX_ENABLE_FAST_PATH
+#error "TX_MUTEX_ENABLE_FAST_PATH is not supported for SMP."
+#endif
+
+
 /* Define internal mutex management function prototypes.  */
 
 VOID        _tx_mutex_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
 VOID        _tx_mutex_thread_release(TX_THREAD *thread_ptr);
 VOID        _tx_mutex_priority_change(TX_THREAD *thread_ptr, UINT new_priority);
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+UINT        _tx_mutex_spin_wait(TX_MUTEX *mutex_ptr);
+#endif
 
 
 /* Mutex management component data declarations follow.  */
@@ -152,6 +163,50 @@ MUTEX_DECLARE  ULONG        _tx_mutex_performance__priority_inheritance_count;
 #endif
 
 
+/* Define the default number of iterations a thread spins on a mutex owned by a thread running on
+   another core, if it hasn't been defined previously (typically in tx_port.h or tx_user.h).  */
+
+#ifndef TX_MUTEX_SPIN_LIMIT
+#define TX_MUTEX_SPIN_LIMIT                     ((ULONG) 1000)
+#endif
+
+
+/* Define the default mutex spin delay, if it hasn't been defined previously (typically in
+   tx_port.h). Where the compiler and architecture are known, issue the processor's spin-wait
+   hint so the spinning core yields pipeline resources to the mutex owner, otherwise define
+   it to whitespace.  */
+
+#ifndef TX_MUTEX_SPIN_PAUSE
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define TX_MUTEX_SPIN_PAUSE                     __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+#define TX_MUTEX_SPIN_PAUSE                     __asm__ volatile ("yield" : : : "memory");
+#else
+#define TX_MUTEX_SPIN_PAUSE
+#endif
+#endif
+
+
+/* Define the default mutex spin compiler barrier, if it hasn't been defined previously
+   (typically in tx_port.h). This forces the mutex and execute list to be read again on
+   every spin iteration.  */
+
+#ifndef TX_MUTEX_SPIN_BARRIER
+#ifdef __GNUC__
+#define TX_MUTEX_SPIN_BARRIER                   __asm__ volatile ("" : : : "memory");
+#else
+#define TX_MUTEX_SPIN_BARRIER
+#endif
+#endif
+
+
+/* Define the macro to pickup the priority ceiling of a mutex.  A mutex not created with the
+   priority ceiling protocol, including a statically initialized control block, has no ceiling.  */
+
+#define TX_MUTEX_CEILING_PRIORITY(m)            (((m) -> tx_mutex_inherit == TX_CEILING_PROTOCOL) ? \
+                                                 (m) -> tx_mutex_ceiling_priority : ((UINT) TX_MAX_PRIORITIES))
+
+
 /* Define default post mutex delete macro to whitespace, if it hasn't been defined previously (typically in tx_port.h).  */
 
 #ifndef TX_MUTEX_DELETE_PORT_COMPLETION
@@ -320,6 +320,13 @@ THREAD_DECLARE  volatile UINT               _tx_thread_preempt_disable;
 THREAD_DECLARE  VOID            (*_tx_thread_mutex_release)(TX_THREAD *thread_ptr);
 
 
+/* Define the global function pointer for reader-writer lock cleanup on thread
+   completion or termination. This pointer is setup during reader-writer lock
+   creation.  */
+
+THREAD_DECLARE  VOID            (*_tx_thread_rwlock_release)(TX_THREAD *thread_ptr);
+
+
 /* Define the global build options variable.  This contains a bit map representing
    how the ThreadX library was built. The following are the bit field definitions:
 
@@ -52,9 +52,116 @@
 /* Define timer management specific data definitions.  */
 
 #define TX_TIMER_ID                             ((ULONG) 0x4154494D)
+#define TX_TIMER_SERVICE_ID                     ((ULONG) 0x54535256)
 #define TX_TIMER_ENTRIES                        ((ULONG) 32)
 
 
+/* Define the cascade list constants.  Each cascade level covers TX_TIMER_ENTRIES
+   times the span of the level below it, so the shift value must match the
+   number of timer entries.  */
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+#ifndef TX_TIMER_CASCADE_LEVELS
+#define TX_TIMER_CASCADE_LEVELS                 3
+#endif
+#if (TX_TIMER_CASCADE_LEVELS < 1) || (TX_TIMER_CASCADE_LEVELS > 5)
+#error "TX_TIMER_CASCADE_LEVELS must be between 1 and 5."
+#endif
+#define TX_TIMER_CASCADE_SHIFT                  ((UINT) 5)
+#endif
+
+
+/* Define the check for the 64-bit system clock.  The timer interrupt of the port must
+   carry into the upper 32 bits, which the port indicates by defining
+   TX_PORT_TIMER_64BIT_CLOCK in tx_port.h.  */
+
+#if defined(TX_TIMER_ENABLE_64BIT_CLOCK) && !defined(TX_PORT_TIMER_64BIT_CLOCK)
+#error "TX_TIMER_ENABLE_64BIT_CLOCK is not supported by this port."
+#endif
+
+
+/* Define the macro that marks an entry of the timer list as in use.  The map is
+   only updated when a timer is placed on an empty entry.  Entries that become
+   empty again are cleared when the map is searched.  */
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+#ifdef TX_TIMER_ENABLE_CASCADE
+#define TX_TIMER_LIST_MAP_SET(l)                                                                                             \
+    if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(l) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_start)) && \
+        (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(l) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end)))      \
+    {                                                                                                                        \
+        _tx_timer_list_map =  _tx_timer_list_map | (((ULONG) 1) << TX_TIMER_POINTER_DIF((l), _tx_timer_list_start));         \
+    }
+#else
+#define TX_TIMER_LIST_MAP_SET(l)    _tx_timer_list_map =  _tx_timer_list_map | (((ULONG) 1) << TX_TIMER_POINTER_DIF((l), _tx_timer_list_start));
+#endif
+#else
+#define TX_TIMER_LIST_MAP_SET(l)
+#endif
+
+
+/* Define the high-resolution timer services of the port.  The port returns the current
+   high-resolution time in nanoseconds with TX_TIMER_HIGH_RESOLUTION_TIME_GET and programs
+   its one-shot timer for an absolute expiration time with TX_TIMER_HIGH_RESOLUTION_SET.  An
+   expiration time of zero stops the one-shot timer.  When the one-shot timer expires, the
+   port calls _tx_timer_high_resolution_expiration_process from interrupt context.  The
+   length of a timer tick in nanoseconds is used to report high-resolution timers in ticks.  */
+
+/* Define the per-core timer lists.  Each core has its own timer list and timer thread, and
+   a timer is placed on the list of the core it is pinned to.  All timer lists advance with
+   the same current timer pointer, which points into the list of core 0, so the timer list
+   of a core is found at a fixed offset from the list of core 0.  The timer interrupt of
+   the port calls _tx_timer_smp_expiration_process on every tick instead of checking the
+   current timer pointer itself, which the port indicates by defining
+   TX_PORT_TIMER_SMP_PER_CORE in tx_port.h.  */
+
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+#ifndef TX_PORT_TIMER_SMP_PER_CORE
+#error "TX_TIMER_ENABLE_SMP_PER_CORE is not supported by this port."
+#endif
+#if TX_THREAD_SMP_MAX_CORES < 2
+#error "TX_TIMER_ENABLE_SMP_PER_CORE requires more than one core."
+#endif
+#if defined(TX_TIMER_PROCESS_IN_ISR) || defined(TX_TIMER_ENABLE_CASCADE) || defined(TX_TIMER_ENABLE_LIST_MAP) || defined(TX_TIMER_ENABLE_SLACK)
+#error "TX_TIMER_ENABLE_SMP_PER_CORE can not be combined with TX_TIMER_PROCESS_IN_ISR, TX_TIMER_ENABLE_CASCADE, TX_TIMER_ENABLE_LIST_MAP or TX_TIMER_ENABLE_SLACK."
+#endif
+#define TX_TIMER_SMP_LIST_ENTRIES               (TX_TIMER_ENTRIES * ((ULONG) TX_THREAD_SMP_MAX_CORES))
+#define TX_TIMER_SMP_LIST_OFFSET(c)             (((ULONG) (c)) * TX_TIMER_ENTRIES)
+#define TX_TIMER_SMP_THREAD(c)                  (((c) == ((UINT) 0)) ? &_tx_timer_thread : &_tx_timer_smp_thread[(c) - ((UINT) 1)])
+#endif
+
+
+/* Define the check for a system timer thread, which is used to reject services that
+   are illegal from timer expiration functions.  With per-core timer lists, the timer
+   threads of the other cores must be matched as well.  */
+
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+#define TX_TIMER_THREAD_CHECK(t)                ((t) == &_tx_timer_thread)
+#else
+#define TX_TIMER_THREAD_CHECK(t)                (((t) == &_tx_timer_thread) || \
+                                                 (((t) >= &_tx_timer_smp_thread[0]) && \
+                                                  ((t) <= &_tx_timer_smp_thread[TX_THREAD_SMP_MAX_CORES - 2])))
+#endif
+
+
+/* Define the pointer to the timer being processed by the caller.  With per-core timer
+   lists each core processes its own timers, so there is one such pointer per core.  */
+
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+#define TX_TIMER_EXPIRED_TIMER_PTR              _tx_timer_expired_timer_ptr
+#else
+#define TX_TIMER_EXPIRED_TIMER_PTR              _tx_timer_smp_expired_timer_ptr[TX_SMP_CORE_ID]
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+#if !defined(TX_TIMER_HIGH_RESOLUTION_TIME_GET) || !defined(TX_TIMER_HIGH_RESOLUTION_SET)
+#error "TX_TIMER_ENABLE_HIGH_RESOLUTION is not supported by this port."
+#endif
+#define TX_TIMER_HIGH_RESOLUTION_TICK_NANOSECONDS   (((ULONG64) 1000000000) / ((ULONG64) TX_TIMER_TICKS_PER_SECOND))
+#endif
+
+
 /* Define internal timer management function prototypes.  */
 
 VOID        _tx_timer_expiration_process(VOID);
@@ -62,6 +169,30 @@ VOID        _tx_timer_initialize(VOID);
 VOID        _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_system_deactivate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
+#ifdef TX_TIMER_ENABLE_CASCADE
+TX_TIMER_INTERNAL **_tx_timer_cascade_list_get(TX_TIMER_INTERNAL *timer_ptr);
+VOID        _tx_timer_cascade_process(ULONG timeout_input);
+ULONG       _tx_timer_cascade_remaining_get(TX_TIMER_INTERNAL *timer_ptr);
+#endif
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+ULONG       _tx_timer_list_map_search(ULONG *list_map_ptr, TX_TIMER_INTERNAL **list_start, ULONG base, ULONG offset);
+#endif
+#ifdef TX_TIMER_ENABLE_SLACK
+VOID        _tx_timer_slack_apply(TX_TIMER_INTERNAL *timer_ptr);
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+VOID        _tx_timer_high_resolution_expiration_process(VOID);
+VOID        _tx_timer_high_resolution_system_activate(TX_TIMER_INTERNAL *timer_ptr);
+#endif
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+VOID        _tx_timer_smp_expiration_process(VOID);
+VOID        _tx_timer_smp_thread_entry(ULONG timer_thread_input);
+#endif
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+VOID        _tx_timer_service_cancel(TX_TIMER *timer_ptr);
+VOID        _tx_timer_service_dispatch(ULONG timeout_input);
+VOID        _tx_timer_service_thread_entry(ULONG service_thread_input);
+#endif
 
 
 /* Timer management component data declarations follow.  */
@@ -79,6 +210,16 @@ VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
 TIMER_DECLARE volatile ULONG    _tx_timer_system_clock;
 
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+/* Define the upper 32 bits of the 64-bit system clock.  The timer interrupt
+   processing of the port increments it whenever the system clock wraps
+   around.  */
+
+TIMER_DECLARE ULONG             _tx_timer_system_clock_upper;
+#endif
+
+
 /* Define the current time slice value.  If non-zero, a time-slice is active.
    Otherwise, the time_slice is not active.  There is one of these entries
    per core.  */
@@ -100,7 +241,11 @@ TIMER_DECLARE UINT              _tx_timer_expired_time_slice;
 /* Define the thread and application timer entry list.  This list provides a direct access
    method for insertion of times less than TX_TIMER_ENTRIES.  */
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
 TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_list[TX_TIMER_ENTRIES];
+#else
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_list[TX_TIMER_SMP_LIST_ENTRIES];
+#endif
 
 
 /* Define the boundary pointers to the list.  These are setup to easily manage
@@ -116,6 +261,25 @@ TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_list_end;
 TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_current_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the map of timer list entries in use.  Bit n is set when a timer is
+   placed on entry n of the timer list.  Bits of entries that have become empty
+   since are cleared when the map is searched.  */
+
+TIMER_DECLARE ULONG             _tx_timer_list_map;
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define the high-resolution timer list.  It holds all active high-resolution
+   timers, sorted by expiration time, the first one to expire at the head.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_high_resolution_list;
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer
    has expired.  */
 
@@ -132,10 +296,85 @@ TIMER_DECLARE TX_TIMER          *_tx_timer_created_ptr;
 TIMER_DECLARE ULONG             _tx_timer_created_count;
 
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+/* Define the created timer service list head pointer.  */
+
+TIMER_DECLARE TX_TIMER_SERVICE  *_tx_timer_service_created_ptr;
+
+
+/* Define the created timer service count.  */
+
+TIMER_DECLARE ULONG             _tx_timer_service_created_count;
+#endif
+
+
 /* Define the pointer to the timer that has expired and is being processed.  */
 
 TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_expired_timer_ptr;
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+/* Define the pointers to the timer that has expired and is being processed by the timer
+   thread of each core.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_smp_expired_timer_ptr[TX_THREAD_SMP_MAX_CORES];
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+/* Define the cascade lists for timers that expire beyond the timer list.  The
+   first level holds one entry per pass through the timer list, and each higher
+   level holds one entry per full pass of the level below it.  A timer on a
+   cascade list keeps its expiration time, on the cascade clock, in its
+   remaining ticks.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_cascade_list[TX_TIMER_CASCADE_LEVELS][TX_TIMER_ENTRIES];
+
+
+/* Define the boundary pointers to the cascade lists.  These are used to identify
+   timers that are on a cascade list.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_cascade_list_start;
+TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_cascade_list_end;
+
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the maps of cascade list entries in use, one for each level.  They are
+   maintained in the same way as the map of the timer list.  */
+
+TIMER_DECLARE ULONG             _tx_timer_cascade_map[TX_TIMER_CASCADE_LEVELS];
+#endif
+
+
+/* Define the cascade clock value at which the next pass through the timer list
+   starts.  The cascade lists are processed relative to this time.  */
+
+TIMER_DECLARE ULONG             _tx_timer_cascade_time;
+
+
+/* Define the flag that indicates the cascade timer is in use.  */
+
+TIMER_DECLARE UINT              _tx_timer_cascade_active;
+
+
+/* Define the offset of the system clock from the clock used by the cascade
+   lists.  It is adjusted when the system clock is set, so the expiration
+   times of the cascaded timers remain valid.  */
+
+TIMER_DECLARE ULONG             _tx_timer_cascade_offset;
+
+
+/* Define the internal timer that moves timers from the cascade lists into the
+   timer list at the start of each pass.  It is only active while any timer is
+   on a cascade list.  */
+
+TIMER_DECLARE TX_TIMER          _tx_timer_cascade_timer;
+
+#endif
+
 
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
@@ -163,6 +402,25 @@ TIMER_DECLARE UINT              _tx_timer_priority;
 
 TIMER_DECLARE ULONG             _tx_timer_thread_stack_area[(((UINT) TX_TIMER_THREAD_STACK_SIZE)+((sizeof(ULONG)) - ((UINT) 1)))/sizeof(ULONG)];
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+/* Define the timer threads of the other cores.  The timer thread of core 0 is the
+   system timer thread.  */
+
+TIMER_DECLARE TX_THREAD         _tx_timer_smp_thread[TX_THREAD_SMP_MAX_CORES - 1];
+
+
+/* Define the stacks of the timer threads of the other cores.  */
+
+TIMER_DECLARE ULONG             _tx_timer_smp_thread_stack_area[TX_THREAD_SMP_MAX_CORES - 1][(((UINT) TX_TIMER_THREAD_STACK_SIZE)+((sizeof(ULONG)) - ((UINT) 1)))/sizeof(ULONG)];
+
+
+/* Define the lists of expired timers waiting for the timer thread of each core.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_smp_expired_list[TX_THREAD_SMP_MAX_CORES];
+
+#endif
+
 #else
 
 
@@ -172,6 +430,20 @@ TIMER_DECLARE UINT              _tx_timer_processing_active;
 
 #endif
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+/* Define the total number of expirations moved within the slack of a timer.  */
+
+TIMER_DECLARE  ULONG            _tx_timer_slack_deferral_count;
+
+
+/* Define the total number of expirations placed on a timer list entry that
+   already holds a timer, which saves a timer wakeup.  */
+
+TIMER_DECLARE  ULONG            _tx_timer_slack_coalesce_count;
+
+#endif
+
 #ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of timer activations.  */
@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_barrier.h"
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+#include "tx_trace.h"
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_barrier_performance_info_get                    PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves performance information from the specified  */
+/*    barrier.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    barrier_ptr                       Pointer to barrier control block  */
+/*    waits                             Destination for the number of     */
+/*                                        waits on this barrier           */
+/*    releases                          Destination for the number of     */
+/*                                        releases of this barrier        */
+/*    suspensions                       Destination for the number of     */
+/*                                        suspensions on this barrier     */
+/*    timeouts                          Destination for number of timeouts*/
+/*                                        on this barrier                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_barrier_performance_info_get(TX_BARRIER *barrier_ptr, ULONG *waits, ULONG *releases,
+                    ULONG *suspensions, ULONG *timeouts)
+{
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+TX_INTERRUPT_SAVE_AREA
+UINT                    status;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Determine if this is a legal request.  */
+    if (barrier_ptr == TX_NULL)
+    {
+
+        /* Barrier pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the barrier ID is invalid.  */
+    else if (barrier_ptr -> tx_barrier_id != TX_BARRIER_ID)
+    {
+
+        /* Barrier pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BARRIER_PERFORMANCE_INFO_GET, barrier_ptr, 0, 0, 0, TX_TRACE_BARRIER_EVENTS)
+
+        /* Log this kernel call.  */
+        TX_EL_BARRIER_PERFORMANCE_INFO_GET_INSERT
+
+        /* Retrieve all the pertinent information and return it in the supplied
+           destinations.  */
+
+        /* Retrieve the number of waits on this barrier.  */
+        if (waits != TX_NULL)
+        {
+
+            *waits =  barrier_ptr -> tx_barrier_performance_wait_count;
+        }
+
+        /* Retrieve the number of releases of this barrier.  */
+        if (releases != TX_NULL)
+        {
+
+            *releases =  barrier_ptr -> tx_barrier_performance_release_count;
+        }
+
+        /* Retrieve the number of suspensions on this barrier.  */
+        if (suspensions != TX_NULL)
+        {
+
+            *suspensions =  barrier_ptr -> tx_barrier_performance_suspension_count;
+        }
+
+        /* Retrieve the number of timeouts on this barrier.  */
+        if (timeouts != TX_NULL)
+        {
+
+            *timeouts =  barrier_ptr -> tx_barrier_performance_timeout_count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+#else
+UINT                    status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (barrier_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (waits != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (releases != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (timeouts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
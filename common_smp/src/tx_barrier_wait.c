@@ -0,0 +1,357 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Barrier                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_barrier.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_barrier_wait                                    PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function registers the arrival of the caller at the specified  */
+/*    barrier.  If the caller is the last of the barrier's threads to     */
+/*    arrive, all suspended threads are released together and the         */
+/*    barrier starts a new cycle.  Otherwise the caller is suspended      */
+/*    until the barrier is released, if the wait option permits.  A       */
+/*    caller that does not suspend is not counted as arrived.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    barrier_ptr                       Pointer to barrier control block  */
+/*    last_arrival                      Optional destination, set to      */
+/*                                        TX_TRUE for the thread that     */
+/*                                        released the barrier            */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_barrier_wait(TX_BARRIER *barrier_ptr, UINT *last_arrival, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_THREAD       *resume_list;
+UINT            resume_count;
+UINT            suspended_count;
+UINT            status;
+
+
+    /* Default to not being the last arrival.  */
+    if (last_arrival != TX_NULL)
+    {
+
+        /* Clear the last arrival flag.  */
+        *last_arrival =  TX_FALSE;
+    }
+
+    /* Disable interrupts to register the arrival at the barrier.  */
+    TX_DISABLE
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total barrier wait counter.  */
+    _tx_barrier_performance_wait_count++;
+
+    /* Increment the number of waits on this barrier.  */
+    barrier_ptr -> tx_barrier_performance_wait_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BARRIER_WAIT, barrier_ptr, wait_option, barrier_ptr -> tx_barrier_suspended_count, barrier_ptr -> tx_barrier_thread_count, TX_TRACE_BARRIER_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BARRIER_WAIT_INSERT
+
+    /* Determine if the caller is the last thread to arrive.  */
+    if ((barrier_ptr -> tx_barrier_suspended_count + ((UINT) 1)) >= barrier_ptr -> tx_barrier_thread_count)
+    {
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total barrier release counter.  */
+        _tx_barrier_performance_release_count++;
+
+        /* Increment the number of releases of this barrier.  */
+        barrier_ptr -> tx_barrier_performance_release_count++;
+#endif
+
+        /* Pickup the suspension information and clear it, which starts the
+           next cycle of the barrier.  */
+        resume_list =                                   barrier_ptr -> tx_barrier_suspension_list;
+        suspended_count =                               barrier_ptr -> tx_barrier_suspended_count;
+        barrier_ptr -> tx_barrier_suspension_list =     TX_NULL;
+        barrier_ptr -> tx_barrier_suspended_count =     TX_NO_SUSPENSIONS;
+
+        /* Prepare all the suspended threads for resumption in this same
+           critical section.  */
+        thread_ptr =    resume_list;
+        resume_count =  suspended_count;
+        while (resume_count != ((UINT) 0))
+        {
+
+            /* Clear the cleanup pointer, this prevents the timeout from doing
+               anything.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Move to the next thread.  */
+            thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+            resume_count--;
+        }
+
+        /* Pickup the number of threads to resume again.  */
+        resume_count =  suspended_count;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Walk through the resume list.  */
+        while (resume_count != ((UINT) 0))
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  resume_list -> tx_thread_suspended_next;
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(resume_list);
+
+            /* Move to the next thread.  */
+            resume_list =  next_thread;
+            resume_count--;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Disable preemption while the threads are resumed.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Walk through the resume list.  */
+        while (resume_count != ((UINT) 0))
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  resume_list -> tx_thread_suspended_next;
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(resume_list);
+
+            /* Move to the next thread.  */
+            resume_list =  next_thread;
+            resume_count--;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Release thread preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+#endif
+
+        /* Tell the caller it released the barrier.  */
+        if (last_arrival != TX_NULL)
+        {
+
+            /* Set the last arrival flag.  */
+            *last_arrival =  TX_TRUE;
+        }
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_NOT_AVAILABLE;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_BARRIER_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total barrier suspension counter.  */
+            _tx_barrier_performance_suspension_count++;
+
+            /* Increment the number of suspensions on this barrier.  */
+            barrier_ptr -> tx_barrier_performance_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_barrier_cleanup);
+
+            /* Setup cleanup information, i.e. this barrier control
+               block.  */
+            thread_ptr -> tx_thread_suspend_control_block =  (VOID *) barrier_ptr;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (barrier_ptr -> tx_barrier_suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                barrier_ptr -> tx_barrier_suspension_list =     thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   barrier_ptr -> tx_barrier_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            barrier_ptr -> tx_barrier_suspended_count++;
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_BARRIER_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Immediate return, return error completion.  */
+        status =  TX_NOT_AVAILABLE;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
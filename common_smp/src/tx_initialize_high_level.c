@@ -40,6 +40,8 @@
 #include "tx_queue.h"
 #include "tx_event_flags.h"
 #include "tx_mutex.h"
+#include "tx_rwlock.h"
+#include "tx_barrier.h"
 #include "tx_block_pool.h"
 #include "tx_byte_pool.h"
 
@@ -93,6 +95,10 @@ VOID     *_tx_initialize_unused_memory;
 /*                                        component                       */
 /*    _tx_mutex_initialize              Initialize the mutex control      */
 /*                                        component                       */
+/*    _tx_rwlock_initialize             Initialize the reader-writer lock */
+/*                                        control component               */
+/*    _tx_barrier_initialize            Initialize the barrier control    */
+/*                                        component                       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -147,6 +153,12 @@ VOID    _tx_initialize_high_level(VOID)
 
     /* Call the mutex initialization function.  */
     _tx_mutex_initialize();
+
+    /* Call the reader-writer lock initialization function.  */
+    _tx_rwlock_initialize();
+
+    /* Call the barrier initialization function.  */
+    _tx_barrier_initialize();
 #endif
 }
 
@@ -615,6 +615,36 @@ TX_MUTEX  *_tx_misra_void_to_mutex_pointer_convert(VOID *pointer)
 }
 
 
+/********************************************************************************/
+/********************************************************************************/
+/**                                                                             */
+/**  TX_RWLOCK  *_tx_misra_void_to_rwlock_pointer_convert(VOID *pointer);       */
+/**                                                                             */
+/********************************************************************************/
+/********************************************************************************/
+TX_RWLOCK  *_tx_misra_void_to_rwlock_pointer_convert(VOID *pointer)
+{
+
+    /* Return a reader-writer lock pointer.  */
+    return((TX_RWLOCK *) ((VOID *) pointer));
+}
+
+
+/********************************************************************************/
+/********************************************************************************/
+/**                                                                             */
+/**  TX_BARRIER  *_tx_misra_void_to_barrier_pointer_convert(VOID *pointer);     */
+/**                                                                             */
+/********************************************************************************/
+/********************************************************************************/
+TX_BARRIER  *_tx_misra_void_to_barrier_pointer_convert(VOID *pointer)
+{
+
+    /* Return a barrier pointer.  */
+    return((TX_BARRIER *) ((VOID *) pointer));
+}
+
+
 /**************************************************************************/
 /**************************************************************************/
 /**                                                                       */
@@ -44,13 +44,17 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function creates a mutex with optional priority inheritance as */
-/*    specified in this call.                                             */
+/*    specified in this call.  Alternatively, the immediate priority      */
+/*    ceiling protocol is selected with TX_PRIORITY_CEILING(priority), in */
+/*    which case the owner runs at no less than the ceiling priority      */
+/*    while it holds the mutex.                                           */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    mutex_ptr                             Pointer to mutex control block*/
 /*    name_ptr                              Pointer to mutex name         */
-/*    inherit                               Priority inheritance option   */
+/*    inherit                               Priority inheritance or       */
+/*                                            ceiling option              */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -87,7 +91,27 @@ TX_MUTEX        *previous_mutex;
 
     /* Setup the basic mutex fields.  */
     mutex_ptr -> tx_mutex_name =             name_ptr;
-    mutex_ptr -> tx_mutex_inherit =          inherit;
+
+    /* Determine if the priority ceiling protocol is requested.  */
+    if ((inherit & TX_CEILING_PROTOCOL) != ((UINT) 0))
+    {
+
+        /* Yes, setup the ceiling priority.  Priority inheritance is not used.  */
+        mutex_ptr -> tx_mutex_inherit =            TX_CEILING_PROTOCOL;
+        mutex_ptr -> tx_mutex_ceiling_priority =   inherit & ((UINT) (~TX_CEILING_PROTOCOL));
+    }
+    else
+    {
+
+        /* No, setup the priority inheritance option.  */
+        mutex_ptr -> tx_mutex_inherit =            inherit;
+    }
+
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+    /* Setup the default adaptive spin limit.  */
+    mutex_ptr -> tx_mutex_spin_limit =       TX_MUTEX_SPIN_LIMIT;
+#endif
 
     /* Disable interrupts to place the mutex on the created list.  */
     TX_DISABLE
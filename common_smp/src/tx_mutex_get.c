@@ -45,6 +45,8 @@
 /*                                                                        */
 /*    This function gets the specified mutex.  If the calling thread      */
 /*    already owns the mutex, an ownership count is simply increased.     */
+/*    The owner of a priority ceiling mutex is raised to the ceiling      */
+/*    priority when the mutex is obtained.                                */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -57,9 +59,11 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_suspend         Suspend thread service            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
-/*    _tx_mutex_priority_change         Inherit thread priority           */
+/*    _tx_mutex_priority_change         Inherit or ceiling priority       */
+/*    _tx_mutex_spin_wait               Spin while owner is running       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -86,11 +90,40 @@ TX_THREAD       *mutex_owner;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 UINT            status;
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+UINT            spun;
+#endif
+
 
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+    /* Default to not spinning.  */
+    spun =  TX_FALSE;
+
+    /* Determine if the caller is willing to wait.  */
+    if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Spin briefly if the mutex is owned by a thread running on another
+           core, it is likely to be released before a suspension completes.  */
+        spun =  _tx_mutex_spin_wait(mutex_ptr);
+    }
+#endif
 
     /* Disable interrupts to get an instance from the mutex.  */
     TX_DISABLE
 
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+    /* Determine if the caller spun on this mutex.  */
+    if (spun == TX_TRUE)
+    {
+
+        /* Increment the number of gets that spun on this mutex.  */
+        mutex_ptr -> tx_mutex_spin_count++;
+    }
+#endif
+
 #ifdef TX_MUTEX_ENABLE_PERFORMANCE_INFO
 
     /* Increment the total mutex get counter.  */
@@ -116,6 +149,17 @@ UINT            status;
         /* Set the ownership count to 1.  */
         mutex_ptr -> tx_mutex_ownership_count =  ((UINT) 1);
 
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+        /* Determine if the mutex was obtained after spinning.  */
+        if (spun == TX_TRUE)
+        {
+
+            /* Increment the number of successful spins on this mutex.  */
+            mutex_ptr -> tx_mutex_spin_success_count++;
+        }
+#endif
+
         /* Remember that the calling thread owns the mutex.  */
         mutex_ptr -> tx_mutex_owner =  thread_ptr;
 
@@ -165,6 +209,53 @@ UINT            status;
 
             /* Increment the number of mutexes owned counter.  */
             thread_ptr -> tx_thread_owned_mutex_count++;
+
+            /* Determine if the ceiling must be kept while the mutex is owned.  */
+            if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_inherit_priority)
+            {
+
+                /* Yes, remember the ceiling so priority changes cannot drop below it.  */
+                thread_ptr -> tx_thread_inherit_priority =  TX_MUTEX_CEILING_PRIORITY(mutex_ptr);
+            }
+
+            /* Determine if the owner must be raised to the ceiling priority.  */
+            if (TX_MUTEX_CEILING_PRIORITY(mutex_ptr) < thread_ptr -> tx_thread_priority)
+            {
+
+                /* Remember the current priority of thread.  */
+                mutex_ptr -> tx_mutex_original_priority =   thread_ptr -> tx_thread_priority;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Raise the owner to the ceiling priority.  */
+                _tx_mutex_priority_change(thread_ptr, TX_MUTEX_CEILING_PRIORITY(mutex_ptr));
+#else
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Raise the owner to the ceiling priority.  */
+                _tx_mutex_priority_change(thread_ptr, TX_MUTEX_CEILING_PRIORITY(mutex_ptr));
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Release the temporary preemption disable.  */
+                _tx_thread_preempt_disable--;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Check for preemption.  */
+                _tx_thread_system_preempt_check();
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+            }
         }
 
         /* Restore interrupts.  */
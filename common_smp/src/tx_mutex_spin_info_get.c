@@ -0,0 +1,175 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Mutex                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_spin_info_get                            PORTABLE SMP     */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the adaptive spin limit and the contention  */
+/*    statistics of the specified mutex.  Gets that spun and did not      */
+/*    succeed went on to suspend, or returned an error.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*    spin_limit                        Destination for the spin limit    */
+/*    spins                             Destination for the number of     */
+/*                                        gets that spun                  */
+/*    spin_successes                    Destination for the number of     */
+/*                                        gets that obtained the mutex    */
+/*                                        after spinning                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_mutex_spin_info_get(TX_MUTEX *mutex_ptr, ULONG *spin_limit, ULONG *spins, ULONG *spin_successes)
+{
+
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+TX_INTERRUPT_SAVE_AREA
+UINT                status;
+
+
+    /* Determine if this is a legal request.  */
+    if (mutex_ptr == TX_NULL)
+    {
+
+        /* Mutex pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the mutex ID is invalid.  */
+    else if (mutex_ptr -> tx_mutex_id != TX_MUTEX_ID)
+    {
+
+        /* Mutex pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Retrieve the spin limit of this mutex.  */
+        if (spin_limit != TX_NULL)
+        {
+
+            *spin_limit =  mutex_ptr -> tx_mutex_spin_limit;
+        }
+
+        /* Retrieve the number of gets that spun on this mutex.  */
+        if (spins != TX_NULL)
+        {
+
+            *spins =  mutex_ptr -> tx_mutex_spin_count;
+        }
+
+        /* Retrieve the number of gets that obtained this mutex after spinning.  */
+        if (spin_successes != TX_NULL)
+        {
+
+            *spin_successes =  mutex_ptr -> tx_mutex_spin_success_count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return successful completion.  */
+        status =  TX_SUCCESS;
+    }
+#else
+UINT                status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (mutex_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (spin_limit != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (spins != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (spin_successes != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
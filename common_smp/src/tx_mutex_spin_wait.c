@@ -0,0 +1,178 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Mutex                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+
+
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_spin_wait                                PORTABLE SMP     */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function spins while the specified mutex is owned by a thread  */
+/*    that is currently mapped to another core, up to the spin limit of   */
+/*    the mutex.  The protection is not held while spinning, all reads    */
+/*    are only hints and the caller must examine the mutex again after    */
+/*    disabling interrupts.  Spinning stops as soon as the mutex appears  */
+/*    free, or the owner is no longer running, since waiting is then      */
+/*    unlikely to be short.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Caller spun on the mutex          */
+/*    TX_FALSE                          Caller did not spin               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_get                     Get mutex                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_mutex_spin_wait(TX_MUTEX *mutex_ptr)
+{
+
+TX_MUTEX volatile   *spin_mutex;
+TX_THREAD volatile  *owner;
+TX_THREAD * volatile *execute_list;
+TX_THREAD           *thread_ptr;
+ULONG               spins;
+ULONG               spin_limit;
+UINT                core;
+UINT                spun;
+
+
+    /* Default to not spinning.  */
+    spun =  TX_FALSE;
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Only threads may spin.  */
+    if ((thread_ptr != TX_NULL) && (TX_THREAD_GET_SYSTEM_STATE() == ((ULONG) 0)))
+    {
+
+        /* Access the mutex through a volatile pointer, since its owner is
+           changed by other cores while we spin.  */
+        spin_mutex =  mutex_ptr;
+
+        /* Likewise access the execute list through a volatile pointer, since
+           the other cores remap their threads while we spin.  */
+        execute_list =  _tx_thread_execute_ptr;
+
+        /* Pickup the spin limit of this mutex.  */
+        spin_limit =  spin_mutex -> tx_mutex_spin_limit;
+
+        /* Spin while the owner is running on another core.  */
+        spins =  ((ULONG) 0);
+        while (spins < spin_limit)
+        {
+
+            /* Determine if the mutex appears to be available.  */
+            if (spin_mutex -> tx_mutex_ownership_count == ((UINT) 0))
+            {
+
+                /* Yes, stop spinning and try to get it.  */
+                break;
+            }
+
+            /* Pickup the current owner.  */
+            owner =  spin_mutex -> tx_mutex_owner;
+
+            /* Determine if there is a valid owner other than the caller.  */
+            if ((owner == TX_NULL) || (owner == thread_ptr))
+            {
+
+                /* No, let the regular processing handle the mutex.  */
+                break;
+            }
+
+            /* Determine if the owner is still ready.  */
+            if (owner -> tx_thread_state != TX_READY)
+            {
+
+                /* The owner is suspended, it will not release the mutex soon.  */
+                break;
+            }
+
+            /* Determine if the owner is actually mapped to a core.  */
+            core =  owner -> tx_thread_smp_core_mapped;
+            if (core >= ((UINT) TX_THREAD_SMP_MAX_CORES))
+            {
+
+                /* Not mapped to any core.  */
+                break;
+            }
+            if (execute_list[core] != owner)
+            {
+
+                /* The owner is ready but not scheduled, it will not release
+                   the mutex soon.  */
+                break;
+            }
+
+            /* Delay for a short period, typically a pause instruction.  */
+            TX_MUTEX_SPIN_PAUSE
+
+            /* Ensure the mutex and execute list are read again.  */
+            TX_MUTEX_SPIN_BARRIER
+
+            /* Indicate the caller has spun.  */
+            spun =  TX_TRUE;
+
+            /* Increment the number of spins.  */
+            spins++;
+        }
+    }
+
+    /* Return whether the caller spun.  */
+    return(spun);
+}
+#endif
+
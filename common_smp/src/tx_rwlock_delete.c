@@ -0,0 +1,280 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_delete                                   PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified reader-writer lock.  All        */
+/*    threads waiting for the lock are resumed with the TX_DELETED        */
+/*    status, and any priority inherited by the writer is given up.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                            Pointer to rwlock control blk */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                            Successful completion status  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_mutex_priority_change             Restore previous priority     */
+/*    _tx_thread_system_preempt_check       Check for preemption          */
+/*    _tx_thread_system_resume              Resume thread service         */
+/*    _tx_thread_system_ni_resume           Non-interruptable resume      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_delete(TX_RWLOCK *rwlock_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *read_list;
+TX_THREAD       *write_list;
+TX_THREAD       *writer_thread;
+UINT            read_count;
+UINT            write_count;
+UINT            suspended_count;
+UINT            restore_priority;
+TX_RWLOCK       *next_rwlock;
+TX_RWLOCK       *previous_rwlock;
+
+
+    /* Disable interrupts to remove the reader-writer lock from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_DELETE, rwlock_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_RWLOCK_EVENTS)
+
+    /* Optional reader-writer lock delete extended processing.  */
+    TX_RWLOCK_DELETE_EXTENSION(rwlock_ptr)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(rwlock_ptr)
+
+    /* Log this kernel call.  */
+    TX_EL_RWLOCK_DELETE_INSERT
+
+    /* Clear the reader-writer lock ID to make it invalid.  */
+    rwlock_ptr -> tx_rwlock_id =  TX_CLEAR_ID;
+
+    /* Decrement the created count.  */
+    _tx_rwlock_created_count--;
+
+    /* See if the reader-writer lock is the only one on the list.  */
+    if (_tx_rwlock_created_count == TX_EMPTY)
+    {
+
+        /* Only created reader-writer lock, just set the created list to NULL.  */
+        _tx_rwlock_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_rwlock =                                rwlock_ptr -> tx_rwlock_created_next;
+        previous_rwlock =                            rwlock_ptr -> tx_rwlock_created_previous;
+        next_rwlock -> tx_rwlock_created_previous =  previous_rwlock;
+        previous_rwlock -> tx_rwlock_created_next =  next_rwlock;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_rwlock_created_ptr == rwlock_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_rwlock_created_ptr =  next_rwlock;
+        }
+    }
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+
+    /* Pickup the suspension information.  */
+    read_list =                                        rwlock_ptr -> tx_rwlock_read_suspension_list;
+    read_count =                                       rwlock_ptr -> tx_rwlock_read_suspended_count;
+    write_list =                                       rwlock_ptr -> tx_rwlock_write_suspension_list;
+    write_count =                                      rwlock_ptr -> tx_rwlock_write_suspended_count;
+    rwlock_ptr -> tx_rwlock_read_suspension_list =     TX_NULL;
+    rwlock_ptr -> tx_rwlock_read_suspended_count =     TX_NO_SUSPENSIONS;
+    rwlock_ptr -> tx_rwlock_write_suspension_list =    TX_NULL;
+    rwlock_ptr -> tx_rwlock_write_suspended_count =    TX_NO_SUSPENSIONS;
+
+    /* Determine if the writer may have inherited a higher priority.  */
+    writer_thread =     rwlock_ptr -> tx_rwlock_writer;
+    restore_priority =  ((UINT) TX_MAX_PRIORITIES);
+    if ((writer_thread != TX_NULL) && (rwlock_ptr -> tx_rwlock_inherit == TX_TRUE) &&
+        (rwlock_ptr -> tx_rwlock_highest_priority_waiting != ((UINT) TX_MAX_PRIORITIES)))
+    {
+
+        /* Restore to the user priority, unless a mutex owned by the writer
+           still requires a higher inherited priority.  */
+        restore_priority =  writer_thread -> tx_thread_user_priority;
+        if (writer_thread -> tx_thread_inherit_priority < restore_priority)
+        {
+
+            /* Keep the mutex inherited priority.  */
+            restore_priority =  writer_thread -> tx_thread_inherit_priority;
+        }
+
+        /* Determine if the priority is actually raised.  */
+        if (writer_thread -> tx_thread_priority >= restore_priority)
+        {
+
+            /* Nothing to restore.  */
+            restore_priority =  ((UINT) TX_MAX_PRIORITIES);
+        }
+    }
+
+    /* Clear the ownership information.  */
+    rwlock_ptr -> tx_rwlock_writer =                    TX_NULL;
+    rwlock_ptr -> tx_rwlock_writer_count =              ((UINT) 0);
+    rwlock_ptr -> tx_rwlock_reader_count =              ((ULONG) 0);
+    rwlock_ptr -> tx_rwlock_highest_priority_waiting =  ((UINT) TX_MAX_PRIORITIES);
+
+    /* Determine if the writer's priority must be restored.  */
+    if (restore_priority != ((UINT) TX_MAX_PRIORITIES))
+    {
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#endif
+
+        /* Restore the priority of the writer.  */
+        _tx_mutex_priority_change(writer_thread, restore_priority);
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+#endif
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through both suspension lists to resume any and all threads
+       suspended on this reader-writer lock.  */
+    thread_ptr =       read_list;
+    suspended_count =  read_count;
+    while ((suspended_count != ((UINT) 0)) || (write_count != ((UINT) 0)))
+    {
+
+        /* Determine if the read list has been exhausted.  */
+        if (suspended_count == ((UINT) 0))
+        {
+
+            /* Yes, move on to the write list.  */
+            thread_ptr =       write_list;
+            suspended_count =  write_count;
+            write_count =      ((UINT) 0);
+        }
+
+        /* Decrement the suspension count.  */
+        suspended_count--;
+
+        /* Lockout interrupts.  */
+        TX_DISABLE
+
+        /* Clear the cleanup pointer, this prevents the timeout from doing
+           anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Set the return status in the thread to TX_DELETED.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+        /* Move the thread pointer ahead.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption again.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+        /* Move to next thread.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release previous preempt disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,169 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_info_get                                 PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified              */
+/*    reader-writer lock.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                        Pointer to rwlock control block   */
+/*    name                              Destination for the lock name     */
+/*    reader_count                      Destination for the number of     */
+/*                                        read holds                      */
+/*    writer                            Destination for the writer's      */
+/*                                        thread control block pointer    */
+/*    first_read_suspended              Destination for pointer of first  */
+/*                                        thread waiting to read          */
+/*    read_suspended_count              Destination for number of threads */
+/*                                        waiting to read                 */
+/*    first_write_suspended             Destination for pointer of first  */
+/*                                        thread waiting to write         */
+/*    write_suspended_count             Destination for number of threads */
+/*                                        waiting to write                */
+/*    next_rwlock                       Destination for pointer to next   */
+/*                                        lock on the created list        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_info_get(TX_RWLOCK *rwlock_ptr, CHAR **name, ULONG *reader_count, TX_THREAD **writer,
+                    TX_THREAD **first_read_suspended, ULONG *read_suspended_count,
+                    TX_THREAD **first_write_suspended, ULONG *write_suspended_count,
+                    TX_RWLOCK **next_rwlock)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_INFO_GET, rwlock_ptr, 0, 0, 0, TX_TRACE_RWLOCK_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_RWLOCK_INFO_GET_INSERT
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the lock.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  rwlock_ptr -> tx_rwlock_name;
+    }
+
+    /* Retrieve the current number of read holds.  */
+    if (reader_count != TX_NULL)
+    {
+
+        *reader_count =  rwlock_ptr -> tx_rwlock_reader_count;
+    }
+
+    /* Retrieve the current writer.  */
+    if (writer != TX_NULL)
+    {
+
+        *writer =  rwlock_ptr -> tx_rwlock_writer;
+    }
+
+    /* Retrieve the first thread waiting to read.  */
+    if (first_read_suspended != TX_NULL)
+    {
+
+        *first_read_suspended =  rwlock_ptr -> tx_rwlock_read_suspension_list;
+    }
+
+    /* Retrieve the number of threads waiting to read.  */
+    if (read_suspended_count != TX_NULL)
+    {
+
+        *read_suspended_count =  (ULONG) rwlock_ptr -> tx_rwlock_read_suspended_count;
+    }
+
+    /* Retrieve the first thread waiting to write.  */
+    if (first_write_suspended != TX_NULL)
+    {
+
+        *first_write_suspended =  rwlock_ptr -> tx_rwlock_write_suspension_list;
+    }
+
+    /* Retrieve the number of threads waiting to write.  */
+    if (write_suspended_count != TX_NULL)
+    {
+
+        *write_suspended_count =  (ULONG) rwlock_ptr -> tx_rwlock_write_suspended_count;
+    }
+
+    /* Retrieve the pointer to the next lock created.  */
+    if (next_rwlock != TX_NULL)
+    {
+
+        *next_rwlock =  rwlock_ptr -> tx_rwlock_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_rwlock.h"
+
+
+#ifndef TX_INLINE_INITIALIZATION
+
+/* Locate reader-writer lock component data in this file.  */
+
+/* Define the head pointer of the created reader-writer lock list.  */
+
+TX_RWLOCK *  _tx_rwlock_created_ptr;
+
+
+/* Define the variable that holds the number of created reader-writer locks. */
+
+ULONG        _tx_rwlock_created_count;
+
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+/* Define the total number of reader-writer lock read gets.  */
+
+ULONG        _tx_rwlock_performance_read_get_count;
+
+
+/* Define the total number of reader-writer lock write gets.  */
+
+ULONG        _tx_rwlock_performance_write_get_count;
+
+
+/* Define the total number of reader-writer lock puts.  */
+
+ULONG        _tx_rwlock_performance_put_count;
+
+
+/* Define the total number of reader-writer lock suspensions.  */
+
+ULONG        _tx_rwlock_performance_suspension_count;
+
+
+/* Define the total number of reader-writer lock timeouts.  */
+
+ULONG        _tx_rwlock_performance_timeout_count;
+
+
+/* Define the total number of writer priority inheritance conditions.  */
+
+ULONG        _tx_rwlock_performance_priority_inheritance_count;
+
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_initialize                               PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the various control data structures for   */
+/*    the reader-writer lock component.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_high_level         High level initialization         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_rwlock_initialize(VOID)
+{
+
+#ifndef TX_DISABLE_REDUNDANT_CLEARING
+
+    /* Initialize the head pointer of the created reader-writer locks list
+       and the number of reader-writer locks created.  */
+    _tx_rwlock_created_ptr =       TX_NULL;
+    _tx_rwlock_created_count =     TX_EMPTY;
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+    /* Initialize the reader-writer lock performance counters.  */
+    _tx_rwlock_performance_read_get_count =             ((ULONG) 0);
+    _tx_rwlock_performance_write_get_count =            ((ULONG) 0);
+    _tx_rwlock_performance_put_count =                  ((ULONG) 0);
+    _tx_rwlock_performance_suspension_count =           ((ULONG) 0);
+    _tx_rwlock_performance_timeout_count =              ((ULONG) 0);
+    _tx_rwlock_performance_priority_inheritance_count = ((ULONG) 0);
+#endif
+#endif
+}
+#endif
@@ -0,0 +1,230 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_rwlock.h"
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+#include "tx_trace.h"
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_performance_info_get                     PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves performance information from the specified  */
+/*    reader-writer lock.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                        Pointer to rwlock control block   */
+/*    read_gets                         Destination for the number of     */
+/*                                        read gets on this lock          */
+/*    write_gets                        Destination for the number of     */
+/*                                        write gets on this lock         */
+/*    puts                              Destination for the number of     */
+/*                                        puts on this lock               */
+/*    suspensions                       Destination for the number of     */
+/*                                        suspensions on this lock        */
+/*    timeouts                          Destination for number of timeouts*/
+/*                                        on this lock                    */
+/*    inheritances                      Destination for number of priority*/
+/*                                        inheritances on this lock       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_performance_info_get(TX_RWLOCK *rwlock_ptr, ULONG *read_gets, ULONG *write_gets,
+                    ULONG *puts, ULONG *suspensions, ULONG *timeouts, ULONG *inheritances)
+{
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+TX_INTERRUPT_SAVE_AREA
+UINT                    status;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Determine if this is a legal request.  */
+    if (rwlock_ptr == TX_NULL)
+    {
+
+        /* Reader-writer lock pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the reader-writer lock ID is invalid.  */
+    else if (rwlock_ptr -> tx_rwlock_id != TX_RWLOCK_ID)
+    {
+
+        /* Reader-writer lock pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_PERFORMANCE_INFO_GET, rwlock_ptr, 0, 0, 0, TX_TRACE_RWLOCK_EVENTS)
+
+        /* Log this kernel call.  */
+        TX_EL_RWLOCK_PERFORMANCE_INFO_GET_INSERT
+
+        /* Retrieve all the pertinent information and return it in the supplied
+           destinations.  */
+
+        /* Retrieve the number of read gets on this lock.  */
+        if (read_gets != TX_NULL)
+        {
+
+            *read_gets =  rwlock_ptr -> tx_rwlock_performance_read_get_count;
+        }
+
+        /* Retrieve the number of write gets on this lock.  */
+        if (write_gets != TX_NULL)
+        {
+
+            *write_gets =  rwlock_ptr -> tx_rwlock_performance_write_get_count;
+        }
+
+        /* Retrieve the number of puts on this lock.  */
+        if (puts != TX_NULL)
+        {
+
+            *puts =  rwlock_ptr -> tx_rwlock_performance_put_count;
+        }
+
+        /* Retrieve the number of suspensions on this lock.  */
+        if (suspensions != TX_NULL)
+        {
+
+            *suspensions =  rwlock_ptr -> tx_rwlock_performance_suspension_count;
+        }
+
+        /* Retrieve the number of timeouts on this lock.  */
+        if (timeouts != TX_NULL)
+        {
+
+            *timeouts =  rwlock_ptr -> tx_rwlock_performance_timeout_count;
+        }
+
+        /* Retrieve the number of priority inheritances on this lock.  */
+        if (inheritances != TX_NULL)
+        {
+
+            *inheritances =  rwlock_ptr -> tx_rwlock_performance_priority_inheritance_count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+#else
+UINT                    status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (rwlock_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (read_gets != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (write_gets != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (puts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (timeouts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (inheritances != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
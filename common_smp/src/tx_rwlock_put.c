@@ -0,0 +1,316 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Reader-Writer Lock                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+#include "tx_rwlock.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_rwlock_put                                      PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases one hold on the specified reader-writer      */
+/*    lock.  If the calling thread is the writer, its ownership count is  */
+/*    decremented; otherwise a read hold is released.  When the lock      */
+/*    becomes free, any priority inherited by the writer is given up and  */
+/*    the lock is handed to the next waiting writer or, if none, to all   */
+/*    waiting readers.  Read holds are counted rather than tracked per    */
+/*    thread, so each thread must only release holds it obtained.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    rwlock_ptr                            Pointer to rwlock control blk */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_mutex_priority_change             Restore previous priority     */
+/*    _tx_rwlock_waiters_grant              Hand lock to waiting threads  */
+/*    _tx_thread_system_preempt_check       Check for preemption          */
+/*    _tx_thread_system_resume              Resume thread service         */
+/*    _tx_thread_system_ni_resume           Non-interruptable resume      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_rwlock_put(TX_RWLOCK *rwlock_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *current_thread;
+TX_THREAD       *granted_list;
+TX_THREAD       *next_thread;
+UINT            restore_priority;
+UINT            status;
+
+
+    /* Setup status to indicate the processing is not complete.  */
+    status =  TX_NOT_DONE;
+
+    /* Default to no priority restoration.  */
+    restore_priority =  ((UINT) TX_MAX_PRIORITIES);
+
+    /* Disable interrupts to release the lock.  */
+    TX_DISABLE
+
+#ifdef TX_RWLOCK_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total reader-writer lock put counter.  */
+    _tx_rwlock_performance_put_count++;
+
+    /* Increment the number of puts on this lock.  */
+    rwlock_ptr -> tx_rwlock_performance_put_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_RWLOCK_PUT, rwlock_ptr, TX_POINTER_TO_ULONG_CONVERT(rwlock_ptr -> tx_rwlock_writer), rwlock_ptr -> tx_rwlock_reader_count, TX_POINTER_TO_ULONG_CONVERT(&status), TX_TRACE_RWLOCK_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_RWLOCK_PUT_INSERT
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(current_thread)
+
+    /* Determine if the lock is held for writing.  */
+    if (rwlock_ptr -> tx_rwlock_writer != TX_NULL)
+    {
+
+        /* Check to see if the lock is owned by the calling thread.  */
+        if (rwlock_ptr -> tx_rwlock_writer != current_thread)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Caller does not own the lock.  */
+            status =  TX_NOT_OWNED;
+        }
+        else
+        {
+
+            /* Decrement the ownership count.  */
+            rwlock_ptr -> tx_rwlock_writer_count--;
+
+            /* Determine if the lock is still owned by the current thread.  */
+            if (rwlock_ptr -> tx_rwlock_writer_count != ((UINT) 0))
+            {
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Lock is still owned, just return successful status.  */
+                status =  TX_SUCCESS;
+            }
+            else
+            {
+
+                /* The writer is releasing the lock.  */
+                rwlock_ptr -> tx_rwlock_writer =  TX_NULL;
+
+                /* Determine if the writer may have inherited a higher priority.  */
+                if ((rwlock_ptr -> tx_rwlock_inherit == TX_TRUE) &&
+                    (rwlock_ptr -> tx_rwlock_highest_priority_waiting != ((UINT) TX_MAX_PRIORITIES)))
+                {
+
+                    /* Restore to the user priority, unless a mutex owned by this thread
+                       still requires a higher inherited priority.  */
+                    restore_priority =  current_thread -> tx_thread_user_priority;
+                    if (current_thread -> tx_thread_inherit_priority < restore_priority)
+                    {
+
+                        /* Keep the mutex inherited priority.  */
+                        restore_priority =  current_thread -> tx_thread_inherit_priority;
+                    }
+
+                    /* Determine if the priority is actually raised.  */
+                    if (current_thread -> tx_thread_priority >= restore_priority)
+                    {
+
+                        /* Nothing to restore.  */
+                        restore_priority =  ((UINT) TX_MAX_PRIORITIES);
+                    }
+
+                    /* Reset the highest priority waiting.  */
+                    rwlock_ptr -> tx_rwlock_highest_priority_waiting =  ((UINT) TX_MAX_PRIORITIES);
+                }
+            }
+        }
+    }
+
+    /* Determine if the lock is held for reading.  */
+    else if (rwlock_ptr -> tx_rwlock_reader_count != ((ULONG) 0))
+    {
+
+        /* Release one read hold.  */
+        rwlock_ptr -> tx_rwlock_reader_count--;
+
+        /* Determine if other readers still hold the lock.  */
+        if (rwlock_ptr -> tx_rwlock_reader_count != ((ULONG) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Lock is still held, just return successful status.  */
+            status =  TX_SUCCESS;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The lock is not held at all.  */
+        status =  TX_NOT_OWNED;
+    }
+
+    /* Determine if the lock has become free.  */
+    if (status == TX_NOT_DONE)
+    {
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Determine if the previous writer's priority must be restored.  */
+        if (restore_priority != ((UINT) TX_MAX_PRIORITIES))
+        {
+
+            /* Restore the priority of the previous writer.  */
+            _tx_mutex_priority_change(current_thread, restore_priority);
+        }
+
+        /* Hand the lock to the waiting threads, if any.  */
+        granted_list =  _tx_rwlock_waiters_grant(rwlock_ptr);
+
+        /* Walk through the granted list.  */
+        while (granted_list != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  granted_list -> tx_thread_suspended_next;
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(granted_list);
+
+            /* Move to the next thread.  */
+            granted_list =  next_thread;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Disable preemption while the lock is handed off.  */
+        _tx_thread_preempt_disable++;
+
+        /* Determine if the previous writer's priority must be restored.  */
+        if (restore_priority != ((UINT) TX_MAX_PRIORITIES))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Restore the priority of the previous writer.  */
+            _tx_mutex_priority_change(current_thread, restore_priority);
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+        }
+
+        /* Hand the lock to the waiting threads, if any.  */
+        granted_list =  _tx_rwlock_waiters_grant(rwlock_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Walk through the granted list.  */
+        while (granted_list != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  granted_list -> tx_thread_suspended_next;
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupt posture.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(granted_list);
+
+            /* Move to the next thread.  */
+            granted_list =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Release thread preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+#endif
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
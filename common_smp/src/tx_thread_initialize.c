@@ -178,6 +178,13 @@ volatile UINT               _tx_thread_preempt_disable;
 VOID            (*_tx_thread_mutex_release)(TX_THREAD *thread_ptr);
 
 
+/* Define the global function pointer for reader-writer lock cleanup on thread
+   completion or termination. This pointer is setup during reader-writer lock
+   creation.  */
+
+VOID            (*_tx_thread_rwlock_release)(TX_THREAD *thread_ptr);
+
+
 /* Define the global build options variable.  This contains a bit map representing
    how the ThreadX library was built. The following are the bit field definitions:
 
@@ -392,6 +399,9 @@ VOID  _tx_thread_initialize(VOID)
     /* Initialize the thread mutex release function pointer.  */
     _tx_thread_mutex_release =      TX_NULL;
 
+    /* Initialize the thread reader-writer lock release function pointer.  */
+    _tx_thread_rwlock_release =     TX_NULL;
+
 #ifdef TX_ENABLE_STACK_CHECKING
 
     /* Clear application registered stack error handler.  */
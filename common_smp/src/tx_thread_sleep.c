@@ -113,7 +113,7 @@ TX_THREAD       *thread_ptr;
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
     /* Is the caller the system timer thread?  */
-    else if (thread_ptr == &_tx_timer_thread)
+    else if (TX_TIMER_THREAD_CHECK(thread_ptr))
     {
 
         /* Restore interrupts.  */
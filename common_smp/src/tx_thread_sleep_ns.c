@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_sleep_ns                                 PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function handles application thread sleep requests in          */
+/*    nanoseconds.  The thread timer is placed on the high-resolution     */
+/*    timer list, so the thread is resumed by the high-resolution timer   */
+/*    interrupt rather than on a timer tick.  If the sleep request was    */
+/*    called from a non-thread, an error is returned.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    nanoseconds                       Number of nanoseconds to sleep    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Actual thread suspension          */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_timer_high_resolution_system_activate                           */
+/*                                        Place timer on the list         */
+/*    TX_TIMER_HIGH_RESOLUTION_TIME_GET Get high-resolution time          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_sleep_ns(ULONG64 nanoseconds)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+TX_THREAD       *thread_ptr;
+
+
+    /* Lockout interrupts while the thread is being resumed.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Determine if this is a legal request.  */
+
+    /* Is there a current thread?  */
+    if (thread_ptr == TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Illegal caller of this service.  */
+        status =  TX_CALLER_ERROR;
+    }
+
+    /* Is the caller an ISR or Initialization?  */
+    else if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Illegal caller of this service.  */
+        status =  TX_CALLER_ERROR;
+    }
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+    /* Is the caller the system timer thread?  */
+    else if (TX_TIMER_THREAD_CHECK(thread_ptr))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Illegal caller of this service.  */
+        status =  TX_CALLER_ERROR;
+    }
+#endif
+
+    /* Determine if the requested number of nanoseconds is zero.  */
+    else if (nanoseconds == ((ULONG64) 0))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Just return with a successful status.  */
+        status =  TX_SUCCESS;
+    }
+    else
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_CALLER_ERROR;
+        }
+        else
+        {
+
+            /* Suspend the current thread.  */
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_SLEEP;
+
+            /* Setup the wake up time of the thread and place its timer on the
+               high-resolution timer list.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_expiration_time =  TX_TIMER_HIGH_RESOLUTION_TIME_GET() + nanoseconds;
+            thread_ptr -> tx_thread_timer.tx_timer_internal_reschedule_time =  ((ULONG64) 0);
+            _tx_timer_high_resolution_system_activate(&(thread_ptr -> tx_thread_timer));
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, TX_NO_WAIT);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag. */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Initialize the status to successful.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Clear the timeout period, the thread timer is already active.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  TX_NO_WAIT;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return status to the caller.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
@@ -73,6 +73,7 @@
 /*    _tx_thread_smp_schedule_list_setup    Inherit schedule list from    */
 /*                                            execute list                */
 /*    _tx_thread_system_return              Return to system              */
+/*    _tx_timer_cascade_list_get            Get cascade list for timer    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -220,6 +221,25 @@ UINT                        processing_complete;
                     timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
                 }
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+                /* The timeout expires on the core the thread suspends on, move to
+                   the timer list of this core.  */
+                timer_ptr -> tx_timer_internal_smp_core =  core_index;
+                timer_list =  TX_TIMER_POINTER_ADD(timer_list, TX_TIMER_SMP_LIST_OFFSET(core_index));
+#endif
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+                /* Determine if the timer expires beyond the timer list.  */
+                if (timeout > TX_TIMER_ENTRIES)
+                {
+
+                    /* Use the cascade list that covers the expiration instead.  */
+                    timer_list =  _tx_timer_cascade_list_get(timer_ptr);
+                }
+#endif
+
                 /* Now put the timer on this list.  */
                 if ((*timer_list) == TX_NULL)
                 {
@@ -232,6 +252,9 @@ UINT                        processing_complete;
 
                     /* Setup the list head pointer.  */
                     *timer_list =  timer_ptr;
+
+                    /* Mark the list entry as in use.  */
+                    TX_TIMER_LIST_MAP_SET(timer_list)
                 }
                 else
                 {
@@ -56,6 +56,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_timer_slack_apply             Move expiration within slack      */
 /*    _tx_timer_system_activate         Actual timer activation function  */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -121,6 +122,17 @@ UINT        status;
         timer_ptr -> tx_timer_performance_activate_count++;
 #endif
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+        /* Determine if the timer has a slack.  */
+        if (timer_ptr -> tx_timer_internal.tx_timer_internal_slack != ((ULONG) 0))
+        {
+
+            /* Move the expiration within the slack.  */
+            _tx_timer_slack_apply(&(timer_ptr -> tx_timer_internal));
+        }
+#endif
+
         /* Call actual activation function.  */
         _tx_timer_system_activate(&(timer_ptr -> tx_timer_internal));
 
@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_cascade_list_get                          PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the cascade list for an internal timer that   */
+/*    expires beyond the timer list.  The remaining ticks of the timer    */
+/*    are converted into its expiration time on the cascade clock, which  */
+/*    is the system clock less the adjustments made by tx_time_set, and   */
+/*    the lowest cascade level that covers this time is selected.         */
+/*    Expiration times beyond the last level are placed at its furthest   */
+/*    entry and cascaded again from there.  The cascade timer is started  */
+/*    if it is not already in use.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    list_head                         Cascade list for the timer        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_system_activate         Activate the cascade timer        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Thread suspend function           */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_timer_system_activate         Timer activate function           */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+TX_TIMER_INTERNAL  **_tx_timer_cascade_list_get(TX_TIMER_INTERNAL *timer_ptr)
+{
+
+TX_TIMER_INTERNAL           *cascade_timer;
+ULONG                       current_time;
+ULONG                       expiration_time;
+ULONG                       delta;
+ULONG                       entry;
+UINT                        level;
+UINT                        shift;
+
+
+    /* Pickup the cascade clock.  */
+    current_time =  _tx_timer_system_clock - _tx_timer_cascade_offset;
+
+    /* Determine if the cascade timer needs to be started.  */
+    if (_tx_timer_cascade_active == TX_FALSE)
+    {
+
+        /* Yes, the cascade lists are empty.  Align the next pass through the
+           timer list with the system clock, such that the cascade timer
+           expires on the last tick before the pass starts.  */
+        _tx_timer_cascade_time =  ((current_time + ((ULONG) 1)) & (~(TX_TIMER_ENTRIES - ((ULONG) 1)))) + TX_TIMER_ENTRIES;
+
+        /* Activate the cascade timer.  */
+        cascade_timer =  &(_tx_timer_cascade_timer.tx_timer_internal);
+        cascade_timer -> tx_timer_internal_remaining_ticks =  (_tx_timer_cascade_time - ((ULONG) 1)) - current_time;
+        _tx_timer_system_activate(cascade_timer);
+
+        /* Mark the cascade timer as in use.  */
+        _tx_timer_cascade_active =  TX_TRUE;
+    }
+
+    /* Convert the remaining ticks into the expiration time on the cascade clock.  */
+    expiration_time =  current_time + timer_ptr -> tx_timer_internal_remaining_ticks;
+    timer_ptr -> tx_timer_internal_remaining_ticks =  expiration_time;
+
+    /* Calculate the ticks from the start of the next pass to the expiration.  */
+    delta =  expiration_time - _tx_timer_cascade_time;
+
+    /* Find the lowest level that covers the expiration time.  Each entry of a
+       level spans the entire level below it.  */
+    level =  ((UINT) 0);
+    shift =  TX_TIMER_CASCADE_SHIFT + TX_TIMER_CASCADE_SHIFT;
+    while ((level < (((UINT) TX_TIMER_CASCADE_LEVELS) - ((UINT) 1))) && ((delta >> shift) != ((ULONG) 0)))
+    {
+
+        /* Move to the next level.  */
+        level++;
+        shift =  shift + TX_TIMER_CASCADE_SHIFT;
+    }
+
+    /* Determine if the expiration time is beyond the last level.  */
+    if ((delta >> shift) != ((ULONG) 0))
+    {
+
+        /* Use the furthest entry of the last level.  The actual expiration
+           time is kept in the timer.  */
+        expiration_time =  _tx_timer_cascade_time + ((((ULONG) 1) << shift) - ((ULONG) 1));
+    }
+
+    /* Calculate the cascade list entry for the expiration time.  */
+    entry =  (expiration_time >> (shift - TX_TIMER_CASCADE_SHIFT)) & (TX_TIMER_ENTRIES - ((ULONG) 1));
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Mark the cascade list entry as in use.  */
+    _tx_timer_cascade_map[level] =  _tx_timer_cascade_map[level] | (((ULONG) 1) << entry);
+#endif
+
+    /* Return the cascade list entry.  */
+    return(&_tx_timer_cascade_list[level][entry]);
+}
+#endif
+#endif
+
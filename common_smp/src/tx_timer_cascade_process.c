@@ -0,0 +1,241 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_cascade_process                           PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the expiration routine of the cascade timer, which */
+/*    expires on the last tick before each pass through the timer list.   */
+/*    For every pass that has started, the higher level cascade lists     */
+/*    that are due are moved down one level, and the timers of the first  */
+/*    level that expire during the pass are placed in the timer list.     */
+/*    This way a long timer is only moved once per cascade level instead  */
+/*    of once per pass through the timer list.  The cascade timer is      */
+/*    rescheduled as long as any timer remains on the cascade lists.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timeout_input                     Unused timeout input              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_cascade_remaining_get   Get ticks left of cascaded timer  */
+/*    _tx_timer_system_activate         Timer activate function           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_cascade_process(ULONG timeout_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **list_head;
+TX_TIMER_INTERNAL           *current_timer;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *cascade_timer;
+ULONG                       pass;
+ULONG                       ticks_left;
+UINT                        level;
+UINT                        shift;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+TX_TIMER                    *timer_ptr;
+#endif
+
+
+    /* Not used.  */
+    TX_PARAMETER_NOT_USED(timeout_input);
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Calculate the ticks before the next pass through the timer list starts.  */
+    ticks_left =  (_tx_timer_cascade_time - ((ULONG) 1)) - (_tx_timer_system_clock - _tx_timer_cascade_offset);
+
+    /* Process every pass that has started.  More than one pass is processed
+       if the cascade timer expired late.  */
+    while ((ticks_left == ((ULONG) 0)) || (ticks_left > TX_TIMER_ENTRIES))
+    {
+
+        /* Pickup the number of this pass.  */
+        pass =  _tx_timer_cascade_time >> TX_TIMER_CASCADE_SHIFT;
+
+        /* Find the highest level due on this pass.  A level is due when all of
+           the lower levels have completed a full pass.  */
+        level =  ((UINT) 1);
+        shift =  TX_TIMER_CASCADE_SHIFT;
+        while ((level < ((UINT) TX_TIMER_CASCADE_LEVELS)) && ((pass & ((((ULONG) 1) << shift) - ((ULONG) 1))) == ((ULONG) 0)))
+        {
+
+            /* Move to the next level.  */
+            level++;
+            shift =  shift + TX_TIMER_CASCADE_SHIFT;
+        }
+
+        /* Loop to move the due lists down, starting with the highest level.  The
+           first level is moved into the timer list.  */
+        do
+        {
+
+            /* Move to the next lower level.  */
+            level--;
+            shift =  shift - TX_TIMER_CASCADE_SHIFT;
+
+            /* Pickup the list of this level that is due.  */
+            list_head =  &_tx_timer_cascade_list[level][(pass >> shift) & (TX_TIMER_ENTRIES - ((ULONG) 1))];
+            current_timer =  *list_head;
+
+            /* Determine if there are any timers on this list.  */
+            if (current_timer != TX_NULL)
+            {
+
+                /* Remove the entire list from the cascade lists.  */
+                *list_head =  TX_NULL;
+
+                /* NULL terminate the list.  */
+                (current_timer -> tx_timer_internal_active_previous) -> tx_timer_internal_active_next =  TX_NULL;
+
+                /* Loop to place each timer again.  */
+                do
+                {
+
+                    /* Pickup the next timer first.  */
+                    next_timer =  current_timer -> tx_timer_internal_active_next;
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the total expiration adjustments counter.  */
+                    _tx_timer_performance__expiration_adjust_count++;
+
+                    /* Determine if this is an application timer.  */
+                    if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+                    {
+
+                        /* Derive the application timer pointer.  */
+
+                        /* Pickup the application timer pointer.  */
+                        TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                        /* Increment the number of expiration adjustments on this timer.  */
+                        if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                        {
+
+                            timer_ptr -> tx_timer_performance__expiration_adjust_count++;
+                        }
+                    }
+#endif
+
+                    /* Convert the expiration time back into the ticks left.  */
+                    current_timer -> tx_timer_internal_remaining_ticks =  _tx_timer_cascade_remaining_get(current_timer);
+
+                    /* Clear the list head for the timer activate call.  */
+                    current_timer -> tx_timer_internal_list_head =  TX_NULL;
+
+                    /* Place the timer on a lower level or in the timer list.  */
+                    _tx_timer_system_activate(current_timer);
+
+                    /* Move to the next timer.  */
+                    current_timer =  next_timer;
+
+                } while (current_timer != TX_NULL);
+            }
+
+        } while (level != ((UINT) 0));
+
+        /* Advance to the next pass.  */
+        _tx_timer_cascade_time =  _tx_timer_cascade_time + TX_TIMER_ENTRIES;
+
+        /* Restore interrupts temporarily.  */
+        TX_RESTORE
+
+        /* Disable interrupts again.  */
+        TX_DISABLE
+
+        /* Calculate the ticks before the next pass starts.  */
+        ticks_left =  (_tx_timer_cascade_time - ((ULONG) 1)) - (_tx_timer_system_clock - _tx_timer_cascade_offset);
+    }
+
+    /* Determine if any timer remains on the cascade lists.  */
+    list_head =  _tx_timer_cascade_list_start;
+    while ((list_head != _tx_timer_cascade_list_end) && (*list_head == TX_NULL))
+    {
+
+        /* Move to the next cascade list.  */
+        list_head =  TX_TIMER_POINTER_ADD(list_head, ((ULONG) 1));
+    }
+
+    /* Determine if a timer was found.  */
+    if (list_head != _tx_timer_cascade_list_end)
+    {
+
+        /* Yes, reschedule the cascade timer for the next pass.  */
+        cascade_timer =  &(_tx_timer_cascade_timer.tx_timer_internal);
+        cascade_timer -> tx_timer_internal_remaining_ticks =  ticks_left;
+        _tx_timer_system_activate(cascade_timer);
+    }
+    else
+    {
+
+        /* No, the cascade timer is no longer in use.  */
+        _tx_timer_cascade_active =  TX_FALSE;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+#endif
+#endif
+
@@ -83,6 +83,9 @@ TX_INTERRUPT_SAVE_AREA
 
 TX_TIMER        *next_timer;
 TX_TIMER        *previous_timer;
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+UINT            core_index;
+#endif
 
 
     /* Initialize timer control block to all zeros.  */
@@ -101,6 +104,14 @@ TX_TIMER        *previous_timer;
     timer_ptr -> tx_timer_internal.tx_timer_internal_smp_cores_excluded =  (TX_THREAD_SMP_CORE_MASK & 0xFFFFFFFE);
 #endif
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+    /* Pin the timer to the core that creates it.  */
+    core_index =  TX_SMP_CORE_ID;
+    timer_ptr -> tx_timer_internal.tx_timer_internal_smp_core =            core_index;
+    timer_ptr -> tx_timer_internal.tx_timer_internal_smp_cores_excluded =  (TX_THREAD_SMP_CORE_MASK & ~(((ULONG) 1) << core_index));
+#endif
+
     /* Disable interrupts to put the timer on the created list.  */
     TX_DISABLE
 
@@ -54,7 +54,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_cascade_remaining_get   Get ticks left of cascaded timer  */
+/*    _tx_timer_service_cancel          Discard pending expiration        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -75,6 +76,7 @@ TX_INTERRUPT_SAVE_AREA
 
 TX_TIMER_INTERNAL   *internal_ptr;
 TX_TIMER_INTERNAL   **list_head;
+TX_TIMER_INTERNAL   **list_entry;
 TX_TIMER_INTERNAL   *next_timer;
 TX_TIMER_INTERNAL   *previous_timer;
 ULONG               ticks_left;
@@ -117,8 +119,16 @@ UINT                active_timer_list;
         if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_start))
         {
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+
             /* Now check to make sure the list head is before the end of the list.  */
             if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+#else
+
+            /* Now check to make sure the list head is before the end of the timer list
+               of the last core.  */
+            if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(TX_TIMER_POINTER_ADD(_tx_timer_list_start, TX_TIMER_SMP_LIST_ENTRIES)))
+#endif
             {
 
                 /* Set the active timer list flag to true.  */
@@ -135,19 +145,30 @@ UINT                active_timer_list;
             /* Calculate the amount of time that has elapsed since the timer
                was activated.  */
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+
+            /* Use the timer's entry directly.  */
+            list_entry =  list_head;
+#else
+
+            /* Find the same entry in the timer list of core 0, which the current
+               timer pointer points into.  */
+            list_entry =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, (TX_TIMER_POINTER_DIF(list_head, _tx_timer_list_start) % TX_TIMER_ENTRIES));
+#endif
+
             /* Is this timer's entry after the current timer pointer?  */
-            if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_current_ptr))
+            if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_entry) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_current_ptr))
             {
 
                 /* Calculate ticks left to expiration - just the difference between this
                    timer's entry and the current timer pointer.  */
-                ticks_left =  (ULONG) (TX_TIMER_POINTER_DIF(list_head,_tx_timer_current_ptr)) + ((ULONG) 1);
+                ticks_left =  (ULONG) (TX_TIMER_POINTER_DIF(list_entry,_tx_timer_current_ptr)) + ((ULONG) 1);
             }
             else
             {
 
                 /* Calculate the ticks left with a wrapped list condition.  */
-                ticks_left =  (ULONG) (TX_TIMER_POINTER_DIF(list_head,_tx_timer_list_start));
+                ticks_left =  (ULONG) (TX_TIMER_POINTER_DIF(list_entry,_tx_timer_list_start));
 
                 ticks_left =  ticks_left + (ULONG) ((TX_TIMER_POINTER_DIF(_tx_timer_list_end, _tx_timer_current_ptr)) + ((ULONG) 1));
             }
@@ -168,11 +189,41 @@ UINT                active_timer_list;
                 internal_ptr -> tx_timer_internal_remaining_ticks =  ticks_left;
             }
         }
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+        /* Determine if the timer is on one of the cascade lists.  */
+        else if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_cascade_list_start)) &&
+                 (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_cascade_list_end)))
+        {
+
+            /* Convert the expiration time of the timer back into the ticks left.  */
+            internal_ptr -> tx_timer_internal_remaining_ticks =  _tx_timer_cascade_remaining_get(internal_ptr);
+        }
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+        /* Determine if the timer is on the high-resolution timer list.  */
+        else if (list_head == &_tx_timer_high_resolution_list)
+        {
+
+            /* High-resolution timers do not use the remaining ticks, nothing
+               to adjust.  The one-shot timer of the port is left as is, an
+               early expiration just finds nothing to do.  */
+        }
+#endif
         else
         {
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+
             /* Determine if this is timer has just expired.  */
             if (_tx_timer_expired_timer_ptr != internal_ptr)
+#else
+
+            /* Determine if this timer is still on the expired timer list of a core.  */
+            if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(&_tx_timer_smp_expired_list[0])) &&
+                (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(&_tx_timer_smp_expired_list[TX_THREAD_SMP_MAX_CORES])))
+#endif
             {
 
                 /* No, it hasn't expired. Now check for remaining time greater than the list
@@ -243,6 +294,17 @@ UINT                active_timer_list;
         internal_ptr -> tx_timer_internal_list_head =  TX_NULL;
     }
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+    /* Determine if an expiration of the timer is waiting for its timer service.  */
+    if (timer_ptr -> tx_timer_service_pending == TX_TRUE)
+    {
+
+        /* Yes, discard the expiration.  */
+        _tx_timer_service_cancel(timer_ptr);
+    }
+#endif
+
     /* Restore interrupts to previous posture.  */
     TX_RESTORE
 
@@ -55,6 +55,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _tx_timer_system_deactivate       Timer deactivation function       */
+/*    _tx_timer_service_cancel          Discard pending expiration        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -89,6 +90,17 @@ TX_TIMER        *previous_timer;
         _tx_timer_system_deactivate(&(timer_ptr -> tx_timer_internal));
     }
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+    /* Determine if an expiration of the timer is waiting for its timer service.  */
+    if (timer_ptr -> tx_timer_service_pending == TX_TRUE)
+    {
+
+        /* Yes, discard the expiration.  */
+        _tx_timer_service_cancel(timer_ptr);
+    }
+#endif
+
     /* If trace is enabled, insert this event into the trace buffer.  */
     TX_TRACE_IN_LINE_INSERT(TX_TRACE_TIMER_DELETE, timer_ptr, 0, 0, 0, TX_TRACE_TIMER_EVENTS)
 
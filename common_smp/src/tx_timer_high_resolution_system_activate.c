@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_high_resolution_system_activate           PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a timer on the high-resolution timer list,     */
+/*    which is sorted by expiration time.  If the timer becomes the       */
+/*    first one to expire, the one-shot timer of the port is programmed   */
+/*    for its expiration.  This function must be called with interrupts   */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    TX_TIMER_HIGH_RESOLUTION_SET      Program one-shot timer            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_sleep_ns               Thread sleep in nanoseconds       */
+/*    _tx_timer_high_resolution_expiration_process                        */
+/*                                        High-resolution timer expiration*/
+/*    _tx_timer_high_resolution_activate                                  */
+/*                                        Start high-resolution timer     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_high_resolution_system_activate(TX_TIMER_INTERNAL *timer_ptr)
+{
+
+TX_TIMER_INTERNAL           *first_timer;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *previous_timer;
+ULONG64                     expiration;
+
+
+    /* Pickup the expiration time of the timer.  */
+    expiration =  timer_ptr -> tx_timer_internal_expiration_time;
+
+    /* Pickup the first timer on the list.  */
+    first_timer =  _tx_timer_high_resolution_list;
+
+    /* Determine if the list is empty.  */
+    if (first_timer == TX_NULL)
+    {
+
+        /* Yes, this is the only timer on the list.  */
+        timer_ptr -> tx_timer_internal_active_next =      timer_ptr;
+        timer_ptr -> tx_timer_internal_active_previous =  timer_ptr;
+        _tx_timer_high_resolution_list =                  timer_ptr;
+
+        /* Program the one-shot timer for this expiration.  */
+        TX_TIMER_HIGH_RESOLUTION_SET(expiration);
+    }
+    else
+    {
+
+        /* Find the first timer that expires after this timer, timers with the
+           same expiration time expire in the order of activation.  */
+        next_timer =  first_timer;
+        while ((next_timer -> tx_timer_internal_expiration_time <= expiration) &&
+               (next_timer -> tx_timer_internal_active_next != first_timer))
+        {
+
+            /* Move to the next timer.  */
+            next_timer =  next_timer -> tx_timer_internal_active_next;
+        }
+
+        /* Determine if the timer goes at the end of the list.  */
+        if (next_timer -> tx_timer_internal_expiration_time <= expiration)
+        {
+
+            /* Yes, insert the timer before the first timer of the circular list.  */
+            next_timer =  first_timer;
+        }
+
+        /* Place the timer before the next timer.  */
+        previous_timer =                                    next_timer -> tx_timer_internal_active_previous;
+        previous_timer -> tx_timer_internal_active_next =   timer_ptr;
+        next_timer -> tx_timer_internal_active_previous =   timer_ptr;
+        timer_ptr -> tx_timer_internal_active_next =        next_timer;
+        timer_ptr -> tx_timer_internal_active_previous =    previous_timer;
+
+        /* Determine if the timer is now the first one to expire.  */
+        if (expiration < first_timer -> tx_timer_internal_expiration_time)
+        {
+
+            /* Yes, make it the head of the list.  */
+            _tx_timer_high_resolution_list =  timer_ptr;
+
+            /* Program the one-shot timer for the new first expiration.  */
+            TX_TIMER_HIGH_RESOLUTION_SET(expiration);
+        }
+    }
+
+    /* Setup the list head pointer.  */
+    timer_ptr -> tx_timer_internal_list_head =  &_tx_timer_high_resolution_list;
+}
+#endif
+
@@ -61,7 +61,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_cascade_remaining_get   Get ticks left of cascaded timer  */
+/*    TX_TIMER_HIGH_RESOLUTION_TIME_GET Get high-resolution time          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -87,6 +88,9 @@ TX_TIMER_INTERNAL   **list_head;
 ULONG               ticks_left;
 UINT                timer_active;
 UINT                active_timer_list;
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+ULONG64             current_time;
+#endif
 
 
     /* Disable interrupts.  */
@@ -131,8 +135,16 @@ UINT                active_timer_list;
         if (internal_ptr -> tx_timer_internal_list_head >= _tx_timer_list_start)
         {
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+
             /* Determine if the list head is before the end of the list.  */
             if (internal_ptr -> tx_timer_internal_list_head < _tx_timer_list_end)
+#else
+
+            /* Determine if the list head is before the end of the timer list of
+               the last core.  */
+            if (internal_ptr -> tx_timer_internal_list_head < TX_TIMER_POINTER_ADD(_tx_timer_list_start, TX_TIMER_SMP_LIST_ENTRIES))
+#endif
             {
 
                 /* This timer is active and has not yet expired.  */
@@ -150,8 +162,15 @@ UINT                active_timer_list;
             /* Setup the list head pointer.  */
             list_head =  internal_ptr -> tx_timer_internal_list_head;
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+            /* Find the same entry in the timer list of core 0, which the current
+               timer pointer points into.  */
+            list_head =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, (TX_TIMER_POINTER_DIF(list_head, _tx_timer_list_start) % TX_TIMER_ENTRIES));
+#endif
+
             /* Is this timer's entry after the current timer pointer?  */
-            if (internal_ptr -> tx_timer_internal_list_head >= _tx_timer_current_ptr)
+            if (list_head >= _tx_timer_current_ptr)
             {
 
                 /* Calculate ticks left to expiration - just the difference between this
@@ -177,14 +196,53 @@ UINT                active_timer_list;
             }
 
         }
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+        /* Determine if the timer is on one of the cascade lists.  */
+        else if ((internal_ptr -> tx_timer_internal_list_head >= _tx_timer_cascade_list_start) &&
+                 (internal_ptr -> tx_timer_internal_list_head < _tx_timer_cascade_list_end))
+        {
+
+            /* Convert the expiration time of the timer into the ticks left.  */
+            ticks_left =  _tx_timer_cascade_remaining_get(internal_ptr);
+        }
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+        /* Determine if the timer is on the high-resolution timer list.  */
+        else if (internal_ptr -> tx_timer_internal_list_head == &_tx_timer_high_resolution_list)
+        {
+
+            /* Pickup the current high-resolution time.  */
+            current_time =  TX_TIMER_HIGH_RESOLUTION_TIME_GET();
+
+            /* Convert the time left before expiration into ticks, rounded up.  */
+            ticks_left =  ((ULONG) 0);
+            if (internal_ptr -> tx_timer_internal_expiration_time > current_time)
+            {
+
+                ticks_left =  (ULONG) (((internal_ptr -> tx_timer_internal_expiration_time - current_time) +
+                                        (TX_TIMER_HIGH_RESOLUTION_TICK_NANOSECONDS - ((ULONG64) 1))) / TX_TIMER_HIGH_RESOLUTION_TICK_NANOSECONDS);
+            }
+        }
+#endif
         else
         {
 
             /* The timer is not on the actual timer list so it must either be being processed
                or on a temporary list to be processed.   */
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
+
             /* Check to see if this timer is the timer currently being processed.  */
             if (_tx_timer_expired_timer_ptr == internal_ptr)
+#else
+
+            /* Check to see if this timer is no longer on the expired timer list of a core,
+               which means it is currently being processed.  */
+            if ((internal_ptr -> tx_timer_internal_list_head < &_tx_timer_smp_expired_list[0]) ||
+                (internal_ptr -> tx_timer_internal_list_head >= &_tx_timer_smp_expired_list[TX_THREAD_SMP_MAX_CORES]))
+#endif
             {
 
                 /* Timer dispatch routine is executing, waiting to execute, or just finishing. No more remaining ticks for this expiration.  */
@@ -43,6 +43,14 @@
 volatile ULONG    _tx_timer_system_clock;
 
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+/* Define the upper 32 bits of the 64-bit system clock.  */
+
+ULONG             _tx_timer_system_clock_upper;
+#endif
+
+
 /* Define count to detect when timer interrupt is active.  */
 
 ULONG             _tx_timer_interrupt_active;
@@ -57,7 +65,11 @@ UINT              _tx_timer_expired_time_slice;
 /* Define the thread and application timer entry list.  This list provides a direct access
    method for insertion of times less than TX_TIMER_ENTRIES.  */
 
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
 TX_TIMER_INTERNAL *_tx_timer_list[TX_TIMER_ENTRIES];
+#else
+TX_TIMER_INTERNAL *_tx_timer_list[TX_TIMER_SMP_LIST_ENTRIES];
+#endif
 
 
 /* Define the boundary pointers to the list.  These are setup to easily manage
@@ -73,6 +85,22 @@ TX_TIMER_INTERNAL **_tx_timer_list_end;
 TX_TIMER_INTERNAL **_tx_timer_current_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the map of timer list entries in use.  */
+
+ULONG             _tx_timer_list_map;
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define the high-resolution timer list.  */
+
+TX_TIMER_INTERNAL *_tx_timer_high_resolution_list;
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer
    has expired.  */
 
@@ -89,10 +117,77 @@ TX_TIMER          *_tx_timer_created_ptr;
 ULONG             _tx_timer_created_count;
 
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+/* Define the created timer service list head pointer.  */
+
+TX_TIMER_SERVICE  *_tx_timer_service_created_ptr;
+
+
+/* Define the created timer service count.  */
+
+ULONG             _tx_timer_service_created_count;
+#endif
+
+
 /* Define the pointer to the timer that has expired and is being processed.  */
 
 TX_TIMER_INTERNAL *_tx_timer_expired_timer_ptr;
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+/* Define the pointers to the timer that has expired and is being processed by the timer
+   thread of each core.  */
+
+TX_TIMER_INTERNAL *_tx_timer_smp_expired_timer_ptr[TX_THREAD_SMP_MAX_CORES];
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+/* Define the cascade lists for timers that expire beyond the timer list.  */
+
+TX_TIMER_INTERNAL *_tx_timer_cascade_list[TX_TIMER_CASCADE_LEVELS][TX_TIMER_ENTRIES];
+
+
+/* Define the boundary pointers to the cascade lists.  */
+
+TX_TIMER_INTERNAL **_tx_timer_cascade_list_start;
+TX_TIMER_INTERNAL **_tx_timer_cascade_list_end;
+
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+/* Define the maps of cascade list entries in use.  */
+
+ULONG             _tx_timer_cascade_map[TX_TIMER_CASCADE_LEVELS];
+#endif
+
+
+/* Define the cascade clock value at which the next pass through the timer list
+   starts.  */
+
+ULONG             _tx_timer_cascade_time;
+
+
+/* Define the flag that indicates the cascade timer is in use.  */
+
+UINT              _tx_timer_cascade_active;
+
+
+/* Define the offset of the system clock from the clock used by the cascade
+   lists.  */
+
+ULONG             _tx_timer_cascade_offset;
+
+
+/* Define the internal timer that moves timers from the cascade lists into the
+   timer list.  */
+
+TX_TIMER          _tx_timer_cascade_timer;
+
+#endif
+
 
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
@@ -120,6 +215,25 @@ UINT              _tx_timer_priority;
 
 ULONG             _tx_timer_thread_stack_area[(((UINT) TX_TIMER_THREAD_STACK_SIZE)+((sizeof(ULONG)) - ((UINT) 1)))/sizeof(ULONG)];
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+/* Define the timer threads of the other cores.  The timer thread of core 0 is the
+   system timer thread.  */
+
+TX_THREAD         _tx_timer_smp_thread[TX_THREAD_SMP_MAX_CORES - 1];
+
+
+/* Define the stacks of the timer threads of the other cores.  */
+
+ULONG             _tx_timer_smp_thread_stack_area[TX_THREAD_SMP_MAX_CORES - 1][(((UINT) TX_TIMER_THREAD_STACK_SIZE)+((sizeof(ULONG)) - ((UINT) 1)))/sizeof(ULONG)];
+
+
+/* Define the lists of expired timers waiting for the timer thread of each core.  */
+
+TX_TIMER_INTERNAL *_tx_timer_smp_expired_list[TX_THREAD_SMP_MAX_CORES];
+
+#endif
+
 #else
 
 
@@ -129,6 +243,20 @@ UINT              _tx_timer_processing_active;
 
 #endif
 
+#ifdef TX_TIMER_ENABLE_SLACK
+
+/* Define the total number of expirations moved within the slack of a timer.  */
+
+ULONG               _tx_timer_slack_deferral_count;
+
+
+/* Define the total number of expirations placed on a timer list entry that
+   already holds a timer, which saves a timer wakeup.  */
+
+ULONG               _tx_timer_slack_coalesce_count;
+
+#endif
+
 #ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of timer activations.  */
@@ -195,6 +323,7 @@ ULONG             _tx_timer_time_slice[TX_THREAD_SMP_MAX_CORES];
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _tx_thread_create                 Create the system timer thread    */
+/*    _tx_thread_smp_core_exclude       Pin timer threads to their cores  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -212,6 +341,10 @@ VOID  _tx_timer_initialize(VOID)
 #ifndef TX_NO_TIMER
 #ifndef TX_TIMER_PROCESS_IN_ISR
 UINT    status;
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+UINT    core_index;
+VOID    *stack_start;
+#endif
 #endif
 
 #ifndef TX_DISABLE_REDUNDANT_CLEARING
@@ -220,6 +353,12 @@ UINT    status;
     /* Initialize the system clock to 0.  */
     _tx_timer_system_clock =      ((ULONG) 0);
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+    /* Initialize the upper 32 bits of the 64-bit system clock to 0.  */
+    _tx_timer_system_clock_upper =  ((ULONG) 0);
+#endif
+
     /* Initialize timer interrupt active count.  */
     _tx_timer_interrupt_active =  ((ULONG) 0);
 
@@ -237,6 +376,18 @@ UINT    status;
 
     /* First, initialize the timer list.  */
     TX_MEMSET(&_tx_timer_list[0], 0, sizeof(_tx_timer_list));
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Clear the map of timer list entries in use.  */
+    _tx_timer_list_map =  ((ULONG) 0);
+#endif
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+    /* Clear the high-resolution timer list.  */
+    _tx_timer_high_resolution_list =  TX_NULL;
+#endif
 #endif
 
     /* Initialize all of the list pointers.  */
@@ -248,6 +399,34 @@ UINT    status;
     _tx_timer_list_end =     &_tx_timer_list[TX_TIMER_ENTRIES-((ULONG) 1)];
     _tx_timer_list_end =     TX_TIMER_POINTER_ADD(_tx_timer_list_end, ((ULONG) 1));
 
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+#ifndef TX_DISABLE_REDUNDANT_CLEARING
+
+    /* Initialize the cascade lists and mark the cascade timer as not in use.  */
+    TX_MEMSET(&_tx_timer_cascade_list[0][0], 0, (sizeof(_tx_timer_cascade_list)));
+    TX_MEMSET(&_tx_timer_cascade_timer, 0, (sizeof(TX_TIMER)));
+    _tx_timer_cascade_time =    ((ULONG) 0);
+    _tx_timer_cascade_active =  TX_FALSE;
+    _tx_timer_cascade_offset =  ((ULONG) 0);
+
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Clear the maps of cascade list entries in use.  */
+    TX_MEMSET(&_tx_timer_cascade_map[0], 0, (sizeof(_tx_timer_cascade_map)));
+#endif
+#endif
+
+    /* Setup the boundary pointers of the cascade lists.  */
+    _tx_timer_cascade_list_start =  &_tx_timer_cascade_list[0][0];
+    _tx_timer_cascade_list_end =    &_tx_timer_cascade_list[TX_TIMER_CASCADE_LEVELS-((UINT) 1)][TX_TIMER_ENTRIES-((ULONG) 1)];
+    _tx_timer_cascade_list_end =    TX_TIMER_POINTER_ADD(_tx_timer_cascade_list_end, ((ULONG) 1));
+
+    /* Setup the cascade timer.  It is a one-shot timer that is rescheduled by
+       its own expiration routine.  */
+    _tx_timer_cascade_timer.tx_timer_internal.tx_timer_internal_timeout_function =  &(_tx_timer_cascade_process);
+#endif
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
     /* Setup the variables associated with the system timer thread's stack and
@@ -259,6 +438,7 @@ UINT    status;
     /* Create the system timer thread.  This thread processes all of the timer
        expirations and reschedules.  Its stack and priority are defined in the
        low-level initialization component.  */
+#ifndef TX_TIMER_ENABLE_SMP_PER_CORE
     do
     {
 
@@ -273,6 +453,51 @@ UINT    status;
         TX_TIMER_INITIALIZE_EXTENSION(status)
 
     } while (status != TX_SUCCESS);
+#else
+
+    /* With per-core timer lists, create a timer thread for each core and pin it to
+       that core.  The system timer thread is the timer thread of core 0.  */
+    for (core_index =  ((UINT) 0); core_index < ((UINT) TX_THREAD_SMP_MAX_CORES); core_index++)
+    {
+
+        /* Pickup the stack of the timer thread of this core.  */
+        if (core_index == ((UINT) 0))
+        {
+
+            stack_start =  _tx_timer_stack_start;
+        }
+        else
+        {
+
+            stack_start =  (VOID *) &_tx_timer_smp_thread_stack_area[core_index - ((UINT) 1)][0];
+        }
+
+        do
+        {
+
+            /* Create the timer thread of this core.  */
+            status =  _tx_thread_create(TX_TIMER_SMP_THREAD(core_index),
+                                        TX_CONST_CHAR_TO_CHAR_POINTER_CONVERT("System Timer Thread"),
+                                        _tx_timer_smp_thread_entry,
+                                        (ULONG) core_index,  stack_start, _tx_timer_stack_size,
+                                        _tx_timer_priority, _tx_timer_priority, TX_NO_TIME_SLICE, TX_DONT_START);
+
+            /* Define timer initialize extension.  */
+            TX_TIMER_INITIALIZE_EXTENSION(status)
+
+        } while (status != TX_SUCCESS);
+
+        /* Pin the timer thread to its core.  */
+        (VOID) _tx_thread_smp_core_exclude(TX_TIMER_SMP_THREAD(core_index), (((ULONG) TX_THREAD_SMP_CORE_MASK) & ~(((ULONG) 1) << core_index)));
+    }
+
+#ifndef TX_DISABLE_REDUNDANT_CLEARING
+
+    /* Clear the expired timer lists and the timers being processed.  */
+    TX_MEMSET(&_tx_timer_smp_expired_list[0], 0, (sizeof(_tx_timer_smp_expired_list)));
+    TX_MEMSET(&_tx_timer_smp_expired_timer_ptr[0], 0, (sizeof(_tx_timer_smp_expired_timer_ptr)));
+#endif
+#endif
 
 #else
 
@@ -288,6 +513,22 @@ UINT    status;
     /* Set the created count to zero.  */
     _tx_timer_created_count =  TX_EMPTY;
 
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+
+    /* Initialize the head pointer of the created timer service list.  */
+    _tx_timer_service_created_ptr =    TX_NULL;
+
+    /* Set the created timer service count to zero.  */
+    _tx_timer_service_created_count =  TX_EMPTY;
+#endif
+
+#ifdef TX_TIMER_ENABLE_SLACK
+
+    /* Initialize the timer slack counters.  */
+    _tx_timer_slack_deferral_count =  ((ULONG) 0);
+    _tx_timer_slack_coalesce_count =  ((ULONG) 0);
+#endif
+
 #ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
 
     /* Initialize timer performance counters.  */
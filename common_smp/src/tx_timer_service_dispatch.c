@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_service_dispatch                          PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the expiration function of every timer bound to a  */
+/*    timer service.  It places the expired timer at the end of the       */
+/*    pending list of its timer service and resumes the timer service     */
+/*    thread.  If the previous expiration of the timer is still pending,  */
+/*    the expiration is counted as an overrun instead.  The expired       */
+/*    timer is found through the expired timer pointer, which is setup    */
+/*    by both the timer thread and the timer interrupt before the         */
+/*    expiration function is called.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timeout_input                     Not used                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume timer service thread       */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_timer_high_resolution_expiration_process                        */
+/*                                        High-resolution processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_service_dispatch(ULONG timeout_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER            *timer_ptr;
+TX_TIMER_SERVICE    *service_ptr;
+TX_THREAD           *thread_ptr;
+VOID                (*timeout_function)(ULONG id);
+ULONG               timeout_param;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the application timer that expired.  */
+    TX_USER_TIMER_POINTER_GET(TX_TIMER_EXPIRED_TIMER_PTR, timer_ptr)
+
+    /* Pickup the timer service of the timer.  */
+    service_ptr =  timer_ptr -> tx_timer_service;
+
+    /* Determine if the timer was unbound after it expired.  */
+    if (service_ptr == TX_NULL)
+    {
+
+        /* Yes, pickup the restored expiration function of the timer.  */
+        timeout_function =  timer_ptr -> tx_timer_internal.tx_timer_internal_timeout_function;
+        timeout_param =     timer_ptr -> tx_timer_internal.tx_timer_internal_timeout_param;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Call the expiration function directly.  */
+        (timeout_function) (timeout_param);
+    }
+
+    /* Determine if the previous expiration is still pending.  */
+    else if (timer_ptr -> tx_timer_service_pending == TX_TRUE)
+    {
+
+        /* Yes, this expiration is lost.  Increment the overrun counter.  */
+        service_ptr -> tx_timer_service_overrun_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Remember the time of the expiration for the lag statistics.  */
+        timer_ptr -> tx_timer_service_expiration_time =  _tx_timer_system_clock;
+
+        /* Place the timer at the end of the pending list.  */
+        timer_ptr -> tx_timer_service_pending =       TX_TRUE;
+        timer_ptr -> tx_timer_service_pending_next =  TX_NULL;
+        if (service_ptr -> tx_timer_service_pending_head == TX_NULL)
+        {
+
+            /* The pending list is empty, the timer is the only entry.  */
+            service_ptr -> tx_timer_service_pending_head =  timer_ptr;
+        }
+        else
+        {
+
+            /* Add the timer after the last entry.  */
+            (service_ptr -> tx_timer_service_pending_tail) -> tx_timer_service_pending_next =  timer_ptr;
+        }
+        service_ptr -> tx_timer_service_pending_tail =  timer_ptr;
+
+        /* Build pointer to the timer service thread.  */
+        thread_ptr =  &(service_ptr -> tx_timer_service_thread);
+
+        /* Determine if the timer service thread is waiting for an expiration.  */
+        if (thread_ptr -> tx_thread_state == TX_SUSPENDED)
+        {
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Increment the preempt disable flag.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call the system resume function to activate the timer service
+               thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+    }
+
+    /* Access input argument just for the sake of lint, MISRA, etc.  */
+    if (timeout_input != ((ULONG) 0))
+    {
+
+        /* The input is not used.  */
+    }
+}
+#endif
+
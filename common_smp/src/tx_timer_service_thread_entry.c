@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_SERVICE_THREADS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_service_thread_entry                      PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry of every timer service thread.  It       */
+/*    calls the expiration functions of the timers on the pending list    */
+/*    of its timer service in the order they expired, and updates the     */
+/*    expiration lag statistics.  When the pending list is empty, the     */
+/*    thread suspends until the next expiration of a bound timer.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    service_thread_input              Not used                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Suspend timer service thread      */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    Timer Expiration Function                                           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX Scheduler                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_service_thread_entry(ULONG service_thread_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_SERVICE    *service_ptr;
+TX_TIMER            *timer_ptr;
+TX_THREAD           *thread_ptr;
+VOID                (*timeout_function)(ULONG id);
+ULONG               timeout_param;
+ULONG               lag;
+
+
+    /* Pickup the current thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Find the timer service of this thread.  The created list is only
+       added to at the front, so it can be searched with interrupts enabled.  */
+    service_ptr =  _tx_timer_service_created_ptr;
+    while (&(service_ptr -> tx_timer_service_thread) != thread_ptr)
+    {
+
+        /* Move to the next timer service.  */
+        service_ptr =  service_ptr -> tx_timer_service_created_next;
+    }
+
+    /* Access input argument just for the sake of lint, MISRA, etc.  */
+    if (service_thread_input != ((ULONG) 0))
+    {
+
+        /* The input is not used.  */
+    }
+
+    /* Now go into an infinite loop to call expiration functions.  */
+    while (TX_LOOP_FOREVER)
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Pickup the first pending timer.  */
+        timer_ptr =  service_ptr -> tx_timer_service_pending_head;
+
+        /* Determine if an expiration is pending.  */
+        if (timer_ptr != TX_NULL)
+        {
+
+            /* Remove the timer from the pending list.  */
+            service_ptr -> tx_timer_service_pending_head =  timer_ptr -> tx_timer_service_pending_next;
+            if (service_ptr -> tx_timer_service_pending_head == TX_NULL)
+            {
+
+                /* The pending list is now empty.  */
+                service_ptr -> tx_timer_service_pending_tail =  TX_NULL;
+            }
+            timer_ptr -> tx_timer_service_pending_next =  TX_NULL;
+            timer_ptr -> tx_timer_service_pending =       TX_FALSE;
+
+            /* Update the expiration lag statistics.  */
+            lag =  _tx_timer_system_clock - timer_ptr -> tx_timer_service_expiration_time;
+            service_ptr -> tx_timer_service_expiration_count++;
+            service_ptr -> tx_timer_service_lag_total =  service_ptr -> tx_timer_service_lag_total + lag;
+            if (lag > service_ptr -> tx_timer_service_lag_maximum)
+            {
+
+                /* Remember the new maximum lag.  */
+                service_ptr -> tx_timer_service_lag_maximum =  lag;
+            }
+
+            /* Copy the expiration function and its input into local variables
+               before interrupts are re-enabled.  */
+            timeout_function =  timer_ptr -> tx_timer_service_function;
+            timeout_param =     timer_ptr -> tx_timer_internal.tx_timer_internal_timeout_param;
+
+            /* Restore interrupts for the expiration function call.  */
+            TX_RESTORE
+
+            /* Call the expiration function of the timer.  */
+            (timeout_function) (timeout_param);
+        }
+        else
+        {
+
+            /* No expiration is pending, suspend the thread until the next
+               expiration of a bound timer.  */
+
+            /* Set the status to suspending, in order to indicate the
+               suspension is in progress.  */
+            thread_ptr -> tx_thread_state =  TX_SUSPENDED;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, ((ULONG) 0));
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag. */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Increment the preempt disable count prior to suspending.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+        }
+    }
+
+#ifdef TX_SAFETY_CRITICAL
+
+    /* If we ever get here, raise safety critical exception.  */
+    TX_SAFETY_CRITICAL_EXCEPTION(__FILE__, __LINE__, 0);
+#endif
+}
+#endif
+
@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_SLACK
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_slack_apply                               PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function moves the next expiration of a timer within its       */
+/*    slack, such that it shares a tick with other timers.  A tick of     */
+/*    the timer list that already holds a timer is preferred.  Otherwise  */
+/*    the tick with the most trailing zero bits is used, which lines up   */
+/*    timers with different periods on the same ticks.  This function     */
+/*    must be called with interrupts disabled, before the timer is        */
+/*    placed on a timer list.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_activate                Application timer activate        */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_slack_apply(TX_TIMER_INTERNAL *timer_ptr)
+{
+
+TX_TIMER_INTERNAL           **timer_list;
+ULONG                       earliest;
+ULONG                       latest;
+ULONG                       slack;
+ULONG                       ticks;
+ULONG                       latest_time;
+ULONG                       aligned_time;
+ULONG                       candidate;
+ULONG                       mask;
+ULONG                       search;
+ULONG                       delta;
+
+
+    /* Pickup the earliest expiration and the slack of the timer.  */
+    earliest =  timer_ptr -> tx_timer_internal_remaining_ticks;
+    slack =     timer_ptr -> tx_timer_internal_slack;
+
+    /* Make sure the remaining ticks can not overflow.  */
+    if (slack > ((~((ULONG) 0)) - earliest))
+    {
+
+        /* Limit the slack.  */
+        slack =  (~((ULONG) 0)) - earliest;
+    }
+
+    /* Calculate the latest expiration.  */
+    latest =       earliest + slack;
+    latest_time =  _tx_timer_system_clock + latest;
+
+    /* Clear the low bits of the latest expiration time, as long as the
+       result is not before the earliest expiration time.  */
+    aligned_time =  latest_time;
+    mask =          ~((ULONG) 1);
+    candidate =     latest_time & mask;
+    while ((mask != ((ULONG) 0)) && ((latest_time - candidate) <= slack))
+    {
+
+        /* This time is within the slack, remember it.  */
+        aligned_time =  candidate;
+
+        /* Clear the next bit.  */
+        mask =       mask << 1;
+        candidate =  latest_time & mask;
+    }
+
+    /* Calculate the remaining ticks of the aligned expiration.  */
+    ticks =  aligned_time - _tx_timer_system_clock;
+
+    /* Determine if the aligned expiration is on the timer list.  */
+    if (ticks <= TX_TIMER_ENTRIES)
+    {
+
+        /* Calculate the timer list entry of the aligned expiration.  */
+        timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, (ticks - ((ULONG) 1)));
+        if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(timer_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+        {
+
+            /* Wrap from the beginning of the list.  */
+            delta =  TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end);
+            timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
+        }
+
+        /* Determine if the entry is empty and the whole slack is on the
+           timer list.  */
+        if (((*timer_list) == TX_NULL) && (latest <= TX_TIMER_ENTRIES))
+        {
+
+            /* Look for the first entry within the slack that holds a timer.  */
+            search =      earliest;
+            timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, (earliest - ((ULONG) 1)));
+            if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(timer_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+            {
+
+                /* Wrap from the beginning of the list.  */
+                timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end));
+            }
+            while (((*timer_list) == TX_NULL) && (search != latest))
+            {
+
+                /* Move to the next entry.  */
+                search++;
+                timer_list =  TX_TIMER_POINTER_ADD(timer_list, 1);
+                if (timer_list == _tx_timer_list_end)
+                {
+
+                    /* Wrap from the beginning of the list.  */
+                    timer_list =  _tx_timer_list_start;
+                }
+            }
+
+            /* Determine if an entry that holds a timer was found.  */
+            if ((*timer_list) != TX_NULL)
+            {
+
+                /* Yes, expire the timer with the timers on this entry.  */
+                ticks =  search;
+            }
+        }
+
+        /* Determine if the expiration is moved to an entry that holds a
+           timer, which saves a timer wakeup.  */
+        if (((*timer_list) != TX_NULL) && (ticks != earliest))
+        {
+
+            /* Increment the coalesced expirations counter.  */
+            _tx_timer_slack_coalesce_count++;
+        }
+    }
+
+    /* Determine if the expiration is moved.  */
+    if (ticks != earliest)
+    {
+
+        /* Increment the deferred expirations counter.  */
+        _tx_timer_slack_deferral_count++;
+
+        /* Store the remaining ticks of the new expiration.  */
+        timer_ptr -> tx_timer_internal_remaining_ticks =  ticks;
+    }
+}
+#endif
+#endif
+
@@ -47,6 +47,9 @@
 /*    This function allows the application to exclude one or more cores   */
 /*    from executing the specified timer.                                 */
 /*                                                                        */
+/*    With per-core timer lists the timer is pinned to one core. If       */
+/*    that core is excluded, the timer moves to the lowest allowed core.  */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    timer_ptr                             Pointer to the timer          */
@@ -80,6 +83,10 @@ UINT  _tx_timer_smp_core_exclude(TX_TIMER *timer_ptr, ULONG exclusion_map)
 TX_INTERRUPT_SAVE_AREA
 
 UINT    status;
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+ULONG   available_cores;
+UINT    new_core;
+#endif
 
 
     /* First, make sure the timer pointer is valid.  */
@@ -107,6 +114,21 @@ UINT    status;
         timer_ptr -> tx_timer_internal.tx_timer_internal_smp_cores_excluded =  (timer_ptr -> tx_timer_internal.tx_timer_internal_smp_cores_excluded & ~(((ULONG) TX_THREAD_SMP_CORE_MASK))) |
                                                                                    (exclusion_map & ((ULONG) TX_THREAD_SMP_CORE_MASK));
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+        /* Determine if the core the timer is pinned to is now excluded.  */
+        available_cores =  (~exclusion_map) & ((ULONG) TX_THREAD_SMP_CORE_MASK);
+        if ((available_cores != ((ULONG) 0)) &&
+            ((available_cores & (((ULONG) 1) << timer_ptr -> tx_timer_internal.tx_timer_internal_smp_core)) == ((ULONG) 0)))
+        {
+
+            /* Yes, pin the timer to the lowest allowed core instead.  This takes
+               effect the next time the timer is placed on a timer list.  */
+            TX_LOWEST_SET_BIT_CALCULATE(available_cores, new_core)
+            timer_ptr -> tx_timer_internal.tx_timer_internal_smp_core =  new_core;
+        }
+#endif
+
         /* Restore interrupts.  */
         TX_RESTORE
 
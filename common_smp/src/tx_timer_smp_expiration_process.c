@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_smp_expiration_process                    PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes a timer tick with per-core timer lists.     */
+/*    The timers that expire on the current timer list entry of each      */
+/*    core are moved to the expired timer list of that core, the current  */
+/*    timer pointer is advanced, and the timer thread of each core with   */
+/*    new expirations is resumed.  It is called from the timer interrupt  */
+/*    on every tick.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_resume          Resume the timer thread           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_interrupt               Timer interrupt handler           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_smp_expiration_process(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *expired_timers;
+TX_TIMER_INTERNAL           *head_timer;
+TX_TIMER_INTERNAL           *last_timer;
+TX_THREAD                   *thread_ptr;
+ULONG                       resume_map;
+UINT                        core_index;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Clear the map of timer threads to resume.  */
+    resume_map =  ((ULONG) 0);
+
+    /* Look at the current timer list entry of each core.  */
+    for (core_index =  ((UINT) 0); core_index < ((UINT) TX_THREAD_SMP_MAX_CORES); core_index++)
+    {
+
+        /* Pickup the current timer list entry of this core.  */
+        timer_list =      TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, TX_TIMER_SMP_LIST_OFFSET(core_index));
+        expired_timers =  *timer_list;
+
+        /* Determine if any timers expire on this core.  */
+        if (expired_timers != TX_NULL)
+        {
+
+            /* Yes, remove them from the timer list.  */
+            *timer_list =  TX_NULL;
+
+            /* Pickup the expired timer list of this core.  */
+            head_timer =  _tx_timer_smp_expired_list[core_index];
+
+            /* Determine if the timer thread is still processing earlier expirations.  */
+            if (head_timer == TX_NULL)
+            {
+
+                /* No, the expired timers become the expired timer list.  */
+                expired_timers -> tx_timer_internal_list_head =  &_tx_timer_smp_expired_list[core_index];
+                _tx_timer_smp_expired_list[core_index] =          expired_timers;
+            }
+            else
+            {
+
+                /* Yes, add the expired timers to the end of the expired timer list.  */
+                last_timer =                                                head_timer -> tx_timer_internal_active_previous;
+                last_timer -> tx_timer_internal_active_next =               expired_timers;
+                head_timer -> tx_timer_internal_active_previous =           expired_timers -> tx_timer_internal_active_previous;
+                (expired_timers -> tx_timer_internal_active_previous) -> tx_timer_internal_active_next =  head_timer;
+                expired_timers -> tx_timer_internal_active_previous =       last_timer;
+            }
+
+            /* Remember to resume the timer thread of this core.  */
+            resume_map =  resume_map | (((ULONG) 1) << core_index);
+        }
+    }
+
+    /* Move the current pointer up one timer entry wrap if we get to
+       the end of the list.  */
+    _tx_timer_current_ptr =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, 1);
+    if (_tx_timer_current_ptr == _tx_timer_list_end)
+    {
+
+        _tx_timer_current_ptr =  _tx_timer_list_start;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Resume the timer threads of the cores with expired timers.  This is done after the
+       current timer pointer is advanced, since a timer thread running on another core
+       reactivates timers relative to it.  */
+    core_index =  ((UINT) 0);
+    while (resume_map != ((ULONG) 0))
+    {
+
+        /* Determine if the timer thread of this core needs to be resumed.  */
+        if ((resume_map & ((ULONG) 1)) != ((ULONG) 0))
+        {
+
+            /* Build pointer to the timer thread of this core.  */
+            thread_ptr =  TX_TIMER_SMP_THREAD(core_index);
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Determine if the timer thread is waiting for an expiration.  */
+            if (thread_ptr -> tx_thread_state == TX_SUSPENDED)
+            {
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Increment the preempt disable flag.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Call the system resume function to activate the timer thread.  */
+                _tx_thread_system_resume(thread_ptr);
+#endif
+            }
+            else
+            {
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+        }
+
+        /* Move to the next core.  */
+        resume_map =  resume_map >> 1;
+        core_index++;
+    }
+}
+#endif
+
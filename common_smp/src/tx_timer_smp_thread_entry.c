@@ -0,0 +1,380 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_smp_thread_entry                          PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry of the timer thread of each core with    */
+/*    per-core timer lists.  It processes the expired timer list of its   */
+/*    core, which is filled by the timer interrupt, calls the expiration  */
+/*    functions and reactivates periodic timers on the timer list of the  */
+/*    core.  When all expirations are processed, the thread suspends      */
+/*    until the next expiration on its core.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_thread_input                Core index of the timer thread    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_thread_system_suspend         Thread suspension routine         */
+/*    _tx_timer_system_activate         Timer reactivate processing       */
+/*    Timer Expiration Function                                           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX Scheduler                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_smp_thread_entry(ULONG timer_thread_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **expired_list;
+TX_TIMER_INTERNAL           *reactivate_timer;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *previous_timer;
+TX_TIMER_INTERNAL           *current_timer;
+VOID                        (*timeout_function)(ULONG id);
+ULONG                       timeout_param =  ((ULONG) 0);
+TX_THREAD                   *thread_ptr;
+UINT                        core_index;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+UCHAR                       *working_ptr;
+TX_TIMER                    *timer_ptr;
+#endif
+
+
+    /* Make sure the timer input is correct.  This also gets rid of the
+       silly compiler warnings.  */
+    if (timer_thread_input < ((ULONG) TX_THREAD_SMP_MAX_CORES))
+    {
+
+        /* Yes, valid thread entry, proceed...  */
+
+        /* Pickup the core of this timer thread, its expired timer list and
+           its thread control block.  */
+        core_index =    (UINT) timer_thread_input;
+        expired_list =  &_tx_timer_smp_expired_list[core_index];
+        thread_ptr =    TX_TIMER_SMP_THREAD(core_index);
+
+        /* Now go into an infinite loop to process timer expirations.  */
+        while (TX_LOOP_FOREVER)
+        {
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Process the expired timers of this core.  */
+            while ((*expired_list) != TX_NULL)
+            {
+
+                /* Something is on the list.  Remove it and process the expiration.  */
+                current_timer =  *expired_list;
+
+                /* Pickup the next timer.  */
+                next_timer =  current_timer -> tx_timer_internal_active_next;
+
+                /* Set the reactivate_timer to NULL.  */
+                reactivate_timer =  TX_NULL;
+
+                /* Determine if this is the only timer.  */
+                if (current_timer == next_timer)
+                {
+
+                    /* Yes, this is the only timer in the list.  */
+
+                    /* Set the head pointer to NULL.  */
+                    *expired_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* No, not the only expired timer.  */
+
+                    /* Remove this timer from the expired list.  */
+                    previous_timer =                                   current_timer -> tx_timer_internal_active_previous;
+                    next_timer -> tx_timer_internal_active_previous =  previous_timer;
+                    previous_timer -> tx_timer_internal_active_next =  next_timer;
+
+                    /* Modify the next timer's list head to point at the current list head.  */
+                    next_timer -> tx_timer_internal_list_head =  expired_list;
+
+                    /* Set the list head pointer.  */
+                    *expired_list =  next_timer;
+                }
+
+                /* In any case, the timer is now off of the expired list.  */
+
+                /* Determine if the timer has expired or if it is just a really
+                   big timer that needs to be placed in the list again.  */
+                if (current_timer -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
+                {
+
+                    /* Timer is bigger than the timer entries and must be
+                       rescheduled.  */
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the total expiration adjustments counter.  */
+                    _tx_timer_performance__expiration_adjust_count++;
+
+                    /* Determine if this is an application timer.  */
+                    if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+                    {
+
+                        /* Derive the application timer pointer.  */
+
+                        /* Pickup the application timer pointer.  */
+                        TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                        /* Increment the number of expiration adjustments on this timer.  */
+                        if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                        {
+
+                            timer_ptr -> tx_timer_performance__expiration_adjust_count++;
+                        }
+                    }
+#endif
+
+                    /* Decrement the remaining ticks of the timer.  */
+                    current_timer -> tx_timer_internal_remaining_ticks =
+                            current_timer -> tx_timer_internal_remaining_ticks - TX_TIMER_ENTRIES;
+
+                    /* Set the timeout function to NULL in order to bypass the
+                       expiration.  */
+                    timeout_function =  TX_NULL;
+
+                    /* Make the timer appear that it is still active while interrupts
+                       are enabled.  This will permit proper processing of a timer
+                       deactivate from an ISR.  */
+                    current_timer -> tx_timer_internal_list_head =    &reactivate_timer;
+                    current_timer -> tx_timer_internal_active_next =  current_timer;
+
+                    /* Setup the temporary timer list head pointer.  */
+                    reactivate_timer =  current_timer;
+                }
+                else
+                {
+
+                    /* Timer did expire.  */
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the total expirations counter.  */
+                    _tx_timer_performance_expiration_count++;
+
+                    /* Determine if this is an application timer.  */
+                    if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+                    {
+
+                        /* Derive the application timer pointer.  */
+
+                        /* Pickup the application timer pointer.  */
+                        TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                        /* Increment the number of expirations on this timer.  */
+                        if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                        {
+
+                            timer_ptr -> tx_timer_performance_expiration_count++;
+                        }
+                    }
+#endif
+
+                    /* Copy the calling function and ID into local variables before interrupts
+                       are re-enabled.  */
+                    timeout_function =  current_timer -> tx_timer_internal_timeout_function;
+                    timeout_param =     current_timer -> tx_timer_internal_timeout_param;
+
+                    /* Copy the reinitialize ticks into the remaining ticks.  */
+                    current_timer -> tx_timer_internal_remaining_ticks =  current_timer -> tx_timer_internal_re_initialize_ticks;
+
+                    /* Determine if the timer should be reactivated.  */
+                    if (current_timer -> tx_timer_internal_remaining_ticks != ((ULONG) 0))
+                    {
+
+                        /* Make the timer appear that it is still active while processing
+                           the expiration routine and with interrupts enabled.  This will
+                           permit proper processing of a timer deactivate from both the
+                           expiration routine and an ISR.  */
+                        current_timer -> tx_timer_internal_list_head =    &reactivate_timer;
+                        current_timer -> tx_timer_internal_active_next =  current_timer;
+
+                        /* Setup the temporary timer list head pointer.  */
+                        reactivate_timer =  current_timer;
+                    }
+                    else
+                    {
+
+                        /* Set the list pointer of this timer to NULL.  This is used to indicate
+                           the timer is no longer active.  */
+                        current_timer -> tx_timer_internal_list_head =  TX_NULL;
+                    }
+                }
+
+                /* Set pointer to indicate the expired timer that is currently being processed
+                   on this core.  */
+                _tx_timer_smp_expired_timer_ptr[core_index] =  current_timer;
+
+#ifndef TX_PROCESS_TIMER_WITH_PROTECTION
+
+                /* Restore interrupts for timer expiration call.  */
+                TX_RESTORE
+#endif
+
+                /* Call the timer-expiration function, if non-NULL.  */
+                if (timeout_function != TX_NULL)
+                {
+
+                    (timeout_function) (timeout_param);
+                }
+
+#ifndef TX_PROCESS_TIMER_WITH_PROTECTION
+
+                /* Lockout interrupts again.  */
+                TX_DISABLE
+#endif
+
+                /* Clear expired timer pointer.  */
+                _tx_timer_smp_expired_timer_ptr[core_index] =  TX_NULL;
+
+                /* Determine if the timer needs to be reactivated.  */
+                if (reactivate_timer == current_timer)
+                {
+
+                    /* Reactivate the timer.  */
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+                    /* Determine if this timer expired.  */
+                    if (timeout_function != TX_NULL)
+                    {
+
+                        /* Increment the total reactivations counter.  */
+                        _tx_timer_performance_reactivate_count++;
+
+                        /* Determine if this is an application timer.  */
+                        if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+                        {
+
+                            /* Derive the application timer pointer.  */
+
+                            /* Pickup the application timer pointer.  */
+                            TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                            /* Increment the number of reactivations on this timer.  */
+                            if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                            {
+
+                                timer_ptr -> tx_timer_performance_reactivate_count++;
+                            }
+                        }
+                    }
+#endif
+
+                    /* Clear the list head for the timer activate call.  */
+                    current_timer -> tx_timer_internal_list_head = TX_NULL;
+
+                    /* Activate the current timer.  It is placed on the timer list of
+                       the core it is pinned to.  */
+                    _tx_timer_system_activate(current_timer);
+                }
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Lockout interrupts again.  */
+                TX_DISABLE
+            }
+
+            /* Finally, suspend this thread and wait for the next expiration on
+               this core.  */
+
+            /* Set the status to suspending, in order to indicate the
+               suspension is in progress.  */
+            thread_ptr -> tx_thread_state =  TX_SUSPENDED;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, ((ULONG) 0));
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag. */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Increment the preempt disable count prior to suspending.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+        }
+    }
+
+#ifdef TX_SAFETY_CRITICAL
+
+    /* If we ever get here, raise safety critical exception.  */
+    TX_SAFETY_CRITICAL_EXCEPTION(__FILE__, __LINE__, 0);
+#endif
+}
+#endif
+
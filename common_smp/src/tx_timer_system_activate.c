@@ -43,7 +43,8 @@
 /*                                                                        */
 /*    This function places the specified internal timer in the proper     */
 /*    place in the timer expiration list.  If the timer is already active */
-/*    this function does nothing.                                         */
+/*    this function does nothing.  Timers that expire beyond the timer    */
+/*    list are placed on the cascade lists, if enabled.                   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -55,7 +56,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_cascade_list_get        Get cascade list for timer        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -63,6 +64,7 @@
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*    _tx_timer_thread_entry            Timer thread processing           */
 /*    _tx_timer_activate                Application timer activate        */
+/*    _tx_timer_cascade_process         Cascade timer processing          */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -130,6 +132,23 @@ ULONG                       expiration_time;
                     timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
                 }
 
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+                /* Move to the timer list of the core the timer is pinned to.  */
+                timer_list =  TX_TIMER_POINTER_ADD(timer_list, TX_TIMER_SMP_LIST_OFFSET(timer_ptr -> tx_timer_internal_smp_core));
+#endif
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+                /* Determine if the timer expires beyond the timer list.  */
+                if (remaining_ticks > TX_TIMER_ENTRIES)
+                {
+
+                    /* Use the cascade list that covers the expiration instead.  */
+                    timer_list =  _tx_timer_cascade_list_get(timer_ptr);
+                }
+#endif
+
                 /* Now put the timer on this list.  */
                 if ((*timer_list) == TX_NULL)
                 {
@@ -142,6 +161,9 @@ ULONG                       expiration_time;
 
                     /* Setup the list head pointer.  */
                     *timer_list =  timer_ptr;
+
+                    /* Mark the list entry as in use.  */
+                    TX_TIMER_LIST_MAP_SET(timer_list)
                 }
                 else
                 {
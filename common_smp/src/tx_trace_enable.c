@@ -33,6 +33,8 @@
 #include "tx_queue.h"
 #include "tx_semaphore.h"
 #include "tx_mutex.h"
+#include "tx_rwlock.h"
+#include "tx_barrier.h"
 #include "tx_block_pool.h"
 #include "tx_byte_pool.h"
 #endif
@@ -96,6 +98,8 @@ TX_EVENT_FLAGS_GROUP            *event_flags_ptr;
 TX_QUEUE                        *queue_ptr;
 TX_SEMAPHORE                    *semaphore_ptr;
 TX_MUTEX                        *mutex_ptr;
+TX_RWLOCK                       *rwlock_ptr;
+TX_BARRIER                      *barrier_ptr;
 TX_BLOCK_POOL                   *block_pool_ptr;
 TX_BYTE_POOL                    *byte_pool_ptr;
 UCHAR                           *work_ptr;
@@ -341,6 +345,44 @@ UINT                            status;
             mutex_ptr =  mutex_ptr -> tx_mutex_created_next;
         }
 
+        /* Pickup the first reader-writer lock and the number of created reader-writer locks.  */
+        rwlock_ptr =  _tx_rwlock_created_ptr;
+        i =           _tx_rwlock_created_count;
+
+        /* Loop to register all reader-writer locks.  */
+        while (i != ((ULONG) 0))
+        {
+
+            /* Decrement the counter.  */
+            i--;
+
+            /* Register this reader-writer lock.  */
+            _tx_trace_object_register(TX_TRACE_OBJECT_TYPE_RWLOCK, rwlock_ptr, rwlock_ptr -> tx_rwlock_name,
+                                                                        (ULONG) rwlock_ptr -> tx_rwlock_inherit, ((ULONG) 0));
+
+            /* Move to the next reader-writer lock.  */
+            rwlock_ptr =  rwlock_ptr -> tx_rwlock_created_next;
+        }
+
+        /* Pickup the first barrier and the number of created barriers.  */
+        barrier_ptr =  _tx_barrier_created_ptr;
+        i =            _tx_barrier_created_count;
+
+        /* Loop to register all barriers.  */
+        while (i != ((ULONG) 0))
+        {
+
+            /* Decrement the counter.  */
+            i--;
+
+            /* Register this barrier.  */
+            _tx_trace_object_register(TX_TRACE_OBJECT_TYPE_BARRIER, barrier_ptr, barrier_ptr -> tx_barrier_name,
+                                                                        (ULONG) barrier_ptr -> tx_barrier_thread_count, ((ULONG) 0));
+
+            /* Move to the next barrier.  */
+            barrier_ptr =  barrier_ptr -> tx_barrier_created_next;
+        }
+
         /* Pickup the first block pool and the number of created block pools.  */
         block_pool_ptr =  _tx_block_pool_created_ptr;
         i =               _tx_block_pool_created_count;
@@ -141,7 +141,7 @@ TX_THREAD       *current_thread;
                 TX_THREAD_GET_CURRENT(current_thread)
 
                 /* Is the current thread the timer thread?  */
-                if (current_thread == &_tx_timer_thread)
+                if (TX_TIMER_THREAD_CHECK(current_thread))
                 {
 
                     /* A non-thread is trying to suspend, return appropriate error code.  */
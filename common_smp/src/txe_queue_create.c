@@ -203,7 +203,7 @@ TX_THREAD       *thread_ptr;
             TX_THREAD_GET_CURRENT(thread_ptr)
 
             /* Check for invalid caller of this function.  First check for a calling thread.  */
-            if (thread_ptr == &_tx_timer_thread)
+            if (TX_TIMER_THREAD_CHECK(thread_ptr))
             {
 
                 /* Invalid caller of this function, return appropriate error code.  */
@@ -274,7 +274,7 @@ TX_THREAD       *current_thread;
             TX_THREAD_GET_CURRENT(current_thread)
 
             /* Check for invalid caller of this function.  First check for a calling thread.  */
-            if (current_thread == &_tx_timer_thread)
+            if (TX_TIMER_THREAD_CHECK(current_thread))
             {
 
                 /* Invalid caller of this function, return appropriate error code.  */
@@ -1,5 +1,6 @@
 LINUX_SRCS = \
 tx_initialize_low_level.c \
+tx_linux_io.c \
 tx_thread_context_restore.c \
 tx_thread_context_save.c \
 tx_thread_interrupt_control.c \
@@ -12,6 +13,14 @@ LINUX_OBJS = $(LINUX_SRCS:%.c=.tmp/%.o)
 
 
 GENERIC_SRCS = \
+tx_barrier_cleanup.c \
+tx_barrier_create.c \
+tx_barrier_delete.c \
+tx_barrier_info_get.c \
+tx_barrier_initialize.c \
+tx_barrier_performance_info_get.c \
+tx_barrier_performance_system_info_get.c \
+tx_barrier_wait.c \
 tx_block_allocate.c \
 tx_block_pool_cleanup.c \
 tx_block_pool_create.c \
@@ -33,6 +42,10 @@ tx_byte_pool_performance_system_info_get.c \
 tx_byte_pool_prioritize.c \
 tx_byte_pool_search.c \
 tx_byte_release.c \
+txe_barrier_create.c \
+txe_barrier_delete.c \
+txe_barrier_info_get.c \
+txe_barrier_wait.c \
 txe_block_allocate.c \
 txe_block_pool_create.c \
 txe_block_pool_delete.c \
@@ -66,6 +79,12 @@ txe_queue_prioritize.c \
 txe_queue_receive.c \
 txe_queue_send.c \
 txe_queue_send_notify.c \
+txe_rwlock_create.c \
+txe_rwlock_delete.c \
+txe_rwlock_info_get.c \
+txe_rwlock_put.c \
+txe_rwlock_read_get.c \
+txe_rwlock_write_get.c \
 txe_semaphore_ceiling_put.c \
 txe_semaphore_create.c \
 txe_semaphore_delete.c \
@@ -74,8 +93,12 @@ txe_semaphore_info_get.c \
 txe_semaphore_prioritize.c \
 txe_semaphore_put.c \
 txe_semaphore_put_notify.c \
+txe_thread_budget_info_get.c \
+txe_thread_budget_set.c \
 txe_thread_create.c \
 txe_thread_delete.c \
+txe_thread_edf_info_get.c \
+txe_thread_edf_set.c \
 txe_thread_entry_exit_notify.c \
 txe_thread_info_get.c \
 txe_thread_preemption_change.c \
@@ -92,7 +115,12 @@ txe_timer_change.c \
 txe_timer_create.c \
 txe_timer_deactivate.c \
 txe_timer_delete.c \
+txe_timer_high_resolution_activate.c \
 txe_timer_info_get.c \
+txe_timer_service_bind.c \
+txe_timer_service_create.c \
+txe_timer_service_info_get.c \
+txe_timer_slack_set.c \
 tx_event_flags_cleanup.c \
 tx_event_flags_create.c \
 tx_event_flags_delete.c \
@@ -110,6 +138,8 @@ tx_misra.c \
 tx_mutex_cleanup.c \
 tx_mutex_create.c \
 tx_mutex_delete.c \
+tx_mutex_fast_get.c \
+tx_mutex_fast_put.c \
 tx_mutex_get.c \
 tx_mutex_info_get.c \
 tx_mutex_initialize.c \
@@ -131,6 +161,17 @@ tx_queue_prioritize.c \
 tx_queue_receive.c \
 tx_queue_send.c \
 tx_queue_send_notify.c \
+tx_rwlock_cleanup.c \
+tx_rwlock_create.c \
+tx_rwlock_delete.c \
+tx_rwlock_info_get.c \
+tx_rwlock_initialize.c \
+tx_rwlock_performance_info_get.c \
+tx_rwlock_performance_system_info_get.c \
+tx_rwlock_put.c \
+tx_rwlock_read_get.c \
+tx_rwlock_waiters_grant.c \
+tx_rwlock_write_get.c \
 tx_semaphore_ceiling_put.c \
 tx_semaphore_cleanup.c \
 tx_semaphore_create.c \
@@ -143,8 +184,18 @@ tx_semaphore_performance_system_info_get.c \
 tx_semaphore_prioritize.c \
 tx_semaphore_put.c \
 tx_semaphore_put_notify.c \
+tx_thread_budget_charge.c \
+tx_thread_budget_info_get.c \
+tx_thread_budget_remove.c \
+tx_thread_budget_set.c \
+tx_thread_budget_thread_entry.c \
 tx_thread_create.c \
 tx_thread_delete.c \
+tx_thread_edf_info_get.c \
+tx_thread_edf_period_wait.c \
+tx_thread_edf_ready_insert.c \
+tx_thread_edf_set.c \
+tx_thread_edf_system_info_get.c \
 tx_thread_entry_exit_notify.c \
 tx_thread_identify.c \
 tx_thread_info_get.c \
@@ -158,6 +209,8 @@ tx_thread_reset.c \
 tx_thread_resume.c \
 tx_thread_shell_entry.c \
 tx_thread_sleep.c \
+tx_thread_sleep_ns.c \
+tx_thread_sleep_until.c \
 tx_thread_stack_analyze.c \
 tx_thread_stack_error_handler.c \
 tx_thread_stack_error_notify.c \
@@ -170,17 +223,34 @@ tx_thread_timeout.c \
 tx_thread_time_slice.c \
 tx_thread_time_slice_change.c \
 tx_thread_wait_abort.c \
+tx_time_get64.c \
 tx_time_get.c \
 tx_timer_activate.c \
+tx_timer_cascade_list_get.c \
+tx_timer_cascade_process.c \
+tx_timer_cascade_remaining_get.c \
 tx_timer_change.c \
 tx_timer_create.c \
 tx_timer_deactivate.c \
 tx_timer_delete.c \
 tx_timer_expiration_process.c \
+tx_timer_high_resolution_activate.c \
+tx_timer_high_resolution_expiration_process.c \
+tx_timer_high_resolution_system_activate.c \
 tx_timer_info_get.c \
 tx_timer_initialize.c \
+tx_timer_list_map_search.c \
 tx_timer_performance_info_get.c \
 tx_timer_performance_system_info_get.c \
+tx_timer_service_bind.c \
+tx_timer_service_cancel.c \
+tx_timer_service_create.c \
+tx_timer_service_dispatch.c \
+tx_timer_service_info_get.c \
+tx_timer_service_thread_entry.c \
+tx_timer_slack_apply.c \
+tx_timer_slack_set.c \
+tx_timer_slack_system_info_get.c \
 tx_timer_system_activate.c \
 tx_timer_system_deactivate.c \
 tx_timer_thread_entry.c \
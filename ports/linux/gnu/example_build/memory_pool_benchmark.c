@@ -0,0 +1,195 @@
+/* This is a memory pool benchmark for ThreadX on Linux.  Four threads of the same
+   priority allocate, fill, check and release 1 KB blocks of a block pool that spans
+   the memory region passed to tx_application_define.  Each thread keeps a few
+   thousand blocks allocated and touches them in random order, so the benchmark
+   measures how well the memory region performs when the working set of the
+   application is larger than the TLB reach of normal pages.
+
+   Usage: memory_pool_benchmark [region size in MB] [memory options]
+
+   The memory options are TX_LINUX_MEMORY_HUGE_PAGES (1) and TX_LINUX_MEMORY_LOCK
+   (2), the default is TX_LINUX_MEMORY_OPTIONS.  The options that were applied to
+   the memory region are printed at start.  */
+
+#include   "tx_api.h"
+#include   <stdio.h>
+#include   <stdlib.h>
+
+#define     BENCHMARK_THREADS           4
+#define     BENCHMARK_STACK_SIZE        16384
+#define     BENCHMARK_BLOCK_SIZE        1024
+#define     BENCHMARK_SLOTS             32768
+#define     BENCHMARK_RELINQUISH        1024
+#define     BENCHMARK_PERIOD            5
+#define     BENCHMARK_PERIODS           3
+#define     BENCHMARK_DEFAULT_SIZE_MB   256
+
+
+/* Define the ThreadX object control blocks...  */
+
+TX_THREAD               benchmark_thread[BENCHMARK_THREADS];
+TX_THREAD               benchmark_reporter;
+TX_BLOCK_POOL           benchmark_pool;
+
+
+/* Define the blocks that are held by each thread and the counters.  */
+
+ULONG                  *benchmark_slot[BENCHMARK_THREADS][BENCHMARK_SLOTS];
+ULONG                   benchmark_counter[BENCHMARK_THREADS];
+ULONG                   benchmark_errors;
+
+
+/* Define thread prototypes.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_reporter_entry(ULONG thread_input);
+
+
+/* Define main entry point.  */
+
+int main(int argc, char **argv)
+{
+
+    /* Pickup the size and the options of the memory region.  */
+    _tx_linux_memory_size =  BENCHMARK_DEFAULT_SIZE_MB * 1024 * 1024;
+    if (argc > 1)
+    {
+        _tx_linux_memory_size =  strtoul(argv[1], NULL, 0) * 1024 * 1024;
+    }
+    if (argc > 2)
+    {
+        _tx_linux_memory_options =  strtoul(argv[2], NULL, 0);
+    }
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+CHAR    *pointer =  (CHAR *) first_unused_memory;
+UINT    i;
+
+    printf("**** ThreadX Linux Memory Pool Benchmark **** Region: %lu MB, options: 0x%lx, ",
+           (unsigned long) (_tx_linux_memory_size / (1024 * 1024)), (unsigned long) _tx_linux_memory_options);
+
+    /* The stacks are placed at the start of the memory region.  */
+    for (i = 0; i < BENCHMARK_THREADS; i++)
+    {
+        tx_thread_create(&benchmark_thread[i], "benchmark thread", benchmark_thread_entry, i,
+                         pointer, BENCHMARK_STACK_SIZE, 10, 10, TX_NO_TIME_SLICE, TX_AUTO_START);
+        pointer =  pointer + BENCHMARK_STACK_SIZE;
+    }
+    tx_thread_create(&benchmark_reporter, "benchmark reporter", benchmark_reporter_entry, 0,
+                     pointer, BENCHMARK_STACK_SIZE, 1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + BENCHMARK_STACK_SIZE;
+
+    /* The rest of the memory region is the block pool.  */
+    tx_block_pool_create(&benchmark_pool, "benchmark pool", BENCHMARK_BLOCK_SIZE, pointer,
+                         _tx_linux_memory_size - ((ULONG) (pointer - (CHAR *) first_unused_memory)));
+    printf("blocks: %lu\n", (unsigned long) benchmark_pool.tx_block_pool_total);
+}
+
+
+/* Define the benchmark threads.  Each iteration checks and releases the block of a
+   random slot, allocates and fills a new block for it, and checks the block of a
+   second random slot.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   random =  (thread_input + 1) * 2654435761UL;
+ULONG   **slot =  benchmark_slot[thread_input];
+ULONG   *block;
+ULONG   index;
+ULONG   sum;
+UINT    i;
+
+    while(1)
+    {
+
+        for (i = 0; i < BENCHMARK_RELINQUISH; i++)
+        {
+
+            /* Pickup a random slot.  */
+            random =  random * 1103515245UL + 12345UL;
+            index =  (random >> 8) % BENCHMARK_SLOTS;
+
+            /* Check and release the block in the slot.  */
+            block =  slot[index];
+            if (block != TX_NULL)
+            {
+                if (block[0] != (ULONG) index)
+                {
+                    benchmark_errors++;
+                }
+                tx_block_release(block);
+            }
+
+            /* Allocate and fill a new block.  */
+            if (tx_block_allocate(&benchmark_pool, (VOID **) &block, TX_NO_WAIT) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+                block =  TX_NULL;
+            }
+            else
+            {
+                block[0] =  (ULONG) index;
+                block[BENCHMARK_BLOCK_SIZE / (2 * sizeof(ULONG))] =  (ULONG) index;
+            }
+            slot[index] =  block;
+
+            /* Check the block of another random slot.  */
+            random =  random * 1103515245UL + 12345UL;
+            index =  (random >> 8) % BENCHMARK_SLOTS;
+            block =  slot[index];
+            if (block != TX_NULL)
+            {
+                sum =  block[0] + block[BENCHMARK_BLOCK_SIZE / (2 * sizeof(ULONG))];
+                if (sum != 2 * index)
+                {
+                    benchmark_errors++;
+                }
+            }
+        }
+
+        benchmark_counter[thread_input] =  benchmark_counter[thread_input] + BENCHMARK_RELINQUISH;
+
+        /* Let the other benchmark threads run.  */
+        tx_thread_relinquish();
+    }
+}
+
+
+/* Define the reporter thread, which prints the number of iterations of each period.  */
+
+void    benchmark_reporter_entry(ULONG thread_input)
+{
+
+ULONG   last_total =  0;
+ULONG   total;
+ULONG   period;
+UINT    i;
+
+    for (period = 1; period <= BENCHMARK_PERIODS; period++)
+    {
+
+        tx_thread_sleep(BENCHMARK_PERIOD * TX_TIMER_TICKS_PER_SECOND);
+
+        total =  0;
+        for (i = 0; i < BENCHMARK_THREADS; i++)
+        {
+            total =  total + benchmark_counter[i];
+        }
+
+        printf("Time Period %lu Total: %lu, errors: %lu\n", (unsigned long) period,
+               (unsigned long) (total - last_total), (unsigned long) benchmark_errors);
+        last_total =  total;
+    }
+
+    exit(0);
+}
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Linux Asynchronous File I/O                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_linux_io.h                                       Linux/GNU       */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the asynchronous file I/O service of the Linux    */
+/*    port.  File operations are submitted to io_uring, or to a pool of   */
+/*    helper threads if io_uring is not available, and their completion   */
+/*    is delivered as a simulated interrupt, so only the ThreadX thread   */
+/*    that waits for an operation is suspended.                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026      William E. Lamie        Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef  TX_LINUX_IO_H
+#define  TX_LINUX_IO_H
+
+#include "tx_api.h"
+
+
+/* Define the number of operations that may be in progress at a time, the number
+   of helper threads used when io_uring is not available, and the ISR ID of the
+   completion interrupt in the trace.  */
+
+#ifndef TX_LINUX_IO_QUEUE_DEPTH
+#define TX_LINUX_IO_QUEUE_DEPTH                 64
+#endif
+
+#ifndef TX_LINUX_IO_THREADS
+#define TX_LINUX_IO_THREADS                     4
+#endif
+
+#ifndef TX_LINUX_IO_ISR_ID
+#define TX_LINUX_IO_ISR_ID                      16
+#endif
+
+
+/* Define the file operations.  */
+
+#define TX_LINUX_IO_READ                        0
+#define TX_LINUX_IO_WRITE                       1
+#define TX_LINUX_IO_FSYNC                       2
+
+
+/* Define the file offset that selects the current file position, which is then
+   advanced like by read and write, e.g. for pipes and sockets.  */
+
+#define TX_LINUX_IO_OFFSET_CURRENT              ((ULONG64) -1)
+
+
+/* Define the file I/O request.  The application fills in the file descriptor,
+   the operation, the buffer, the size, the file offset and the optional notify
+   function before the request is submitted.  The notify function is called from
+   the completion ISR.  The result is the number of bytes transferred, or the
+   negative errno value if the operation failed.  */
+
+typedef struct TX_LINUX_IO_REQUEST_STRUCT
+{
+    int                 tx_linux_io_request_fd;
+    UINT                tx_linux_io_request_operation;
+    VOID                *tx_linux_io_request_buffer;
+    ULONG               tx_linux_io_request_size;
+    ULONG64             tx_linux_io_request_offset;
+    VOID                (*tx_linux_io_request_notify)(struct TX_LINUX_IO_REQUEST_STRUCT *request_ptr);
+    long                tx_linux_io_request_result;
+    TX_SEMAPHORE        tx_linux_io_request_semaphore;
+    struct TX_LINUX_IO_REQUEST_STRUCT
+                        *tx_linux_io_request_next;
+} TX_LINUX_IO_REQUEST;
+
+
+/* Declare the asynchronous file I/O services.  */
+
+UINT    _tx_linux_io_initialize(VOID);
+UINT    _tx_linux_io_submit(TX_LINUX_IO_REQUEST *request_ptr);
+UINT    _tx_linux_io_wait(TX_LINUX_IO_REQUEST *request_ptr, ULONG wait_option);
+long    _tx_linux_io_read(int fd, VOID *buffer, ULONG size, ULONG64 offset);
+long    _tx_linux_io_write(int fd, VOID *buffer, ULONG size, ULONG64 offset);
+UINT    _tx_linux_io_uring_active(VOID);
+
+#endif
@@ -142,6 +142,17 @@ typedef unsigned short                          USHORT;
 typedef uint64_t                                ULONG64;
 #define ULONG64_DEFINED
 
+
+/* Define that the timer interrupt of this port maintains the upper 32 bits of the
+   64-bit system clock.  */
+
+#define TX_PORT_TIMER_64BIT_CLOCK
+
+/* Define that the timer interrupt of this port charges each tick to the CPU budget of the
+   interrupted thread.  */
+
+#define TX_PORT_THREAD_BUDGET
+
 /* Override the alignment type to use 64-bit alignment and storage for pointers.  */
 
 #if __x86_64__
@@ -257,6 +268,7 @@ extern TEST_FLAG        test_forced_mutex_timeout;
 /* Add Linux debug insert prototype.  */
 
 void    _tx_linux_debug_entry_insert(char *action, char *file, unsigned long line);
+UINT    _tx_linux_debug_dump(const char *file_name);
 
 #ifndef TX_LINUX_DEBUG_ENABLE
 
@@ -331,7 +343,7 @@ void    _tx_linux_debug_entry_insert(char *action, char *file, unsigned long lin
 
 #ifndef TX_MISRA_ENABLE
 #ifndef TX_TRACE_TIME_SOURCE
-#define TX_TRACE_TIME_SOURCE                    ((ULONG) (_tx_linux_time_stamp.tv_nsec));
+#define TX_TRACE_TIME_SOURCE                    ((ULONG) _tx_linux_time_stamp_get())
 #endif
 #else
 ULONG   _tx_misra_time_stamp_get(VOID);
@@ -343,9 +355,11 @@ ULONG   _tx_misra_time_stamp_get(VOID);
 #endif
 
 
-/* Define the port-specific trace extension to pickup the Windows timer.  */
+/* Define the port-specific trace extension.  The time stamp is read by the trace
+   time source itself, which is a 64-bit CLOCK_MONOTONIC nanosecond count truncated
+   to the 32-bit trace entry.  */
 
-#define TX_TRACE_PORT_EXTENSION                 clock_gettime(CLOCK_REALTIME, &_tx_linux_time_stamp);
+#define TX_TRACE_PORT_EXTENSION
 
 
 /* Define the port specific options for the _tx_build_options variable. This variable indicates
@@ -390,7 +404,7 @@ void    _tx_initialize_start_interrupts(void);
    existing ThreadX kernel awareness modules.  */
 
 #define TX_THREAD_EXTENSION_0                                               pthread_t   tx_thread_linux_thread_id; \
-                                                                            sem_t       tx_thread_linux_thread_run_semaphore; \
+                                                                            int         tx_thread_linux_thread_run_futex; \
                                                                             UINT        tx_thread_linux_suspension_type; \
                                                                             UINT        tx_thread_linux_int_disabled_flag;
 
@@ -531,6 +545,28 @@ VOID   _tx_thread_interrupt_restore(UINT previous_posture);
 #define tx_linux_sem_wait(p)                sem_wait(p)
 
 
+/* Define the futex word states used for the thread handoff.  A futex word is a
+   binary semaphore: post sets it to posted and wakes the waiter if there is one,
+   wait consumes the post or sleeps in the kernel until it arrives.  */
+
+#define TX_LINUX_FUTEX_EMPTY                0
+#define TX_LINUX_FUTEX_POSTED               1
+#define TX_LINUX_FUTEX_WAITING              2
+
+
+/* Define the high-resolution timer services of the Linux port.  The high-resolution
+   time is CLOCK_MONOTONIC in nanoseconds, and the one-shot timer is a timerfd that is
+   serviced by a simulated interrupt thread.  */
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+ULONG64 _tx_linux_high_resolution_time_get(VOID);
+VOID    _tx_linux_high_resolution_timer_set(ULONG64 expiration_time);
+
+#define TX_TIMER_HIGH_RESOLUTION_TIME_GET()         _tx_linux_high_resolution_time_get()
+#define TX_TIMER_HIGH_RESOLUTION_SET(t)             _tx_linux_high_resolution_timer_set(t)
+#endif
+
+
 /* Define the interrupt lockout macros for each ThreadX object.  */
 
 #define TX_BLOCK_POOL_DISABLE               TX_DISABLE
@@ -551,29 +587,122 @@ extern  CHAR                    _tx_version_id[];
 #endif
 
 
+/* Reject the former no-idle option.  While no thread is ready, the scheduler now sleeps
+   on the idle futex, which _tx_thread_context_restore posts when a simulated interrupt
+   makes a thread ready.  This replaces the per-tick semaphore of that option.  */
+
+#ifdef TX_LINUX_NO_IDLE_ENABLE
+#error "TX_LINUX_NO_IDLE_ENABLE is no longer supported, the scheduler sleeps on the idle futex while no thread is ready."
+#endif
+
+
 /* Define externals for the Linux port of ThreadX.  */
 
 extern pthread_mutex_t                          _tx_linux_mutex;
-extern sem_t                                    _tx_linux_semaphore;
-extern sem_t                                    _tx_linux_semaphore_no_idle;
+extern int                                      _tx_linux_scheduler_futex;
 extern ULONG                                    _tx_linux_global_int_disabled_flag;
 extern struct timespec                          _tx_linux_time_stamp;
+extern ULONG                                    _tx_linux_timer_overrun_count;
 extern __thread int                             _tx_linux_threadx_thread;
+extern __thread int                            *_tx_linux_thread_run_futex;
+
+/* Define the maximum number of missed ticks that the simulated timer interrupt
+   keeps pending for delivery when it was delayed beyond the following tick, and
+   the polling interval while a missed tick waits for the system timer thread to
+   process the expiration of the previous tick.  Further missed ticks are still
+   counted in _tx_linux_timer_overrun_count, but are dropped.  */
+
+#ifndef TX_LINUX_TIMER_CATCH_UP_MAX
+#define TX_LINUX_TIMER_CATCH_UP_MAX             100
+#endif
+
+#ifndef TX_LINUX_TIMER_CATCH_UP_WAIT_NSEC
+#define TX_LINUX_TIMER_CATCH_UP_WAIT_NSEC       10000
+#endif
 
 /* Define functions for linux thread. */
 void    _tx_linux_thread_suspend(pthread_t thread_id);
-void    _tx_linux_thread_resume(pthread_t thread_id);
+void    _tx_linux_thread_resume(struct TX_THREAD_STRUCT *thread_ptr);
+void    _tx_linux_futex_post(int *futex_ptr);
+void    _tx_linux_futex_wait(int *futex_ptr);
 void    _tx_linux_thread_init();
+ULONG64 _tx_linux_time_stamp_get(VOID);
+#ifdef TX_LINUX_VIRTUAL_TIME_ENABLE
+UINT    _tx_linux_virtual_time_advance(VOID);
+#endif
+
+/* Define the simulated interrupts driven by file descriptors.  Sockets, pipes,
+   eventfds, timerfds and other file descriptors that epoll can wait on may be
+   registered as interrupt sources.  */
+
+#ifndef TX_LINUX_INTERRUPT_FD_MAX
+#define TX_LINUX_INTERRUPT_FD_MAX               16
+#endif
+
+UINT    _tx_linux_interrupt_fd_register(int fd, ULONG events, ULONG isr_id, VOID (*isr)(int fd, ULONG events));
+UINT    _tx_linux_interrupt_fd_unregister(int fd);
+
+/* Define the memory region that is passed to tx_application_define.  The size
+   and the options are the defaults of _tx_linux_memory_size and
+   _tx_linux_memory_options, which may be changed before tx_kernel_enter.  */
 
 #ifndef TX_LINUX_MEMORY_SIZE
 #define TX_LINUX_MEMORY_SIZE                    64000
 #endif
 
+#define TX_LINUX_MEMORY_HUGE_PAGES              0x01
+#define TX_LINUX_MEMORY_LOCK                    0x02
+
+#ifndef TX_LINUX_MEMORY_OPTIONS
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+#define TX_LINUX_MEMORY_OPTIONS                 (TX_LINUX_MEMORY_HUGE_PAGES | TX_LINUX_MEMORY_LOCK)
+#else
+#define TX_LINUX_MEMORY_OPTIONS                 TX_LINUX_MEMORY_HUGE_PAGES
+#endif
+#endif
+
+extern ULONG                                    _tx_linux_memory_size;
+extern ULONG                                    _tx_linux_memory_options;
+
+/* Define the real-time host configuration.  The scheduler and the ThreadX
+   threads run on _tx_linux_real_time_cpu, the simulated interrupt threads run on
+   _tx_linux_real_time_isr_cpu.  Both may be changed before tx_kernel_enter; -1
+   selects the first isolated CPU, or the last available CPU if no CPU is
+   isolated.  The latency of the timer interrupt is recorded and printed with
+   _tx_linux_real_time_report.  */
+
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+
+#ifndef TX_LINUX_REAL_TIME_CPU
+#define TX_LINUX_REAL_TIME_CPU                  (-1)
+#endif
+
+#ifndef TX_LINUX_REAL_TIME_ISR_CPU
+#define TX_LINUX_REAL_TIME_ISR_CPU              TX_LINUX_REAL_TIME_CPU
+#endif
+
+#ifndef TX_LINUX_REAL_TIME_PRIORITY
+#define TX_LINUX_REAL_TIME_PRIORITY             (80)
+#endif
+
+extern int                                      _tx_linux_real_time_cpu;
+extern int                                      _tx_linux_real_time_isr_cpu;
+
+VOID    _tx_linux_real_time_affinity_set(pthread_t thread_id, int cpu);
+UINT    _tx_linux_real_time_report(const char *file_name);
+#endif
+
 /* Define priorities of pthreads. */
 
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+#define TX_LINUX_PRIORITY_SCHEDULE              (TX_LINUX_REAL_TIME_PRIORITY + 2)
+#define TX_LINUX_PRIORITY_ISR                   (TX_LINUX_REAL_TIME_PRIORITY + 1)
+#define TX_LINUX_PRIORITY_USER_THREAD           (TX_LINUX_REAL_TIME_PRIORITY)
+#else
 #define TX_LINUX_PRIORITY_SCHEDULE              (3)
 #define TX_LINUX_PRIORITY_ISR                   (2)
 #define TX_LINUX_PRIORITY_USER_THREAD           (1)
+#endif
 
 #endif
 
@@ -27,31 +27,88 @@
 /* Include necessary system files.  */
 
 #include "tx_api.h"
+#include "tx_timer.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <signal.h>
 #include <unistd.h>
 #include <errno.h>
 #include <sys/sysinfo.h>
+#include <sys/syscall.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <linux/futex.h>
+#include <limits.h>
+#ifdef TX_LINUX_DEBUG_ENABLE
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+#include <sys/timerfd.h>
+#endif
 
 
 /* Define various Linux objects used by the ThreadX port.  */
 
 pthread_mutex_t     _tx_linux_mutex;
-sem_t               _tx_linux_semaphore;
-sem_t               _tx_linux_semaphore_no_idle;
+int                 _tx_linux_scheduler_futex;
+int                 _tx_linux_idle_futex;
 ULONG               _tx_linux_global_int_disabled_flag;
 struct timespec     _tx_linux_time_stamp;
+ULONG               _tx_linux_timer_overrun_count;
 __thread int        _tx_linux_threadx_thread = 0;
+__thread int       *_tx_linux_thread_run_futex;
+
+/* Define the size and the options of the memory region that is passed to
+   tx_application_define.  The application may change them before calling
+   tx_kernel_enter.  Options that could not be applied are cleared when the
+   region is mapped.  */
+
+ULONG               _tx_linux_memory_size =  TX_LINUX_MEMORY_SIZE;
+ULONG               _tx_linux_memory_options =  TX_LINUX_MEMORY_OPTIONS;
+
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+
+#if defined(TX_LINUX_TICKLESS_ENABLE) || defined(TX_LINUX_VIRTUAL_TIME_ENABLE)
+#error "TX_LINUX_REAL_TIME_ENABLE can not be used together with TX_LINUX_TICKLESS_ENABLE or TX_LINUX_VIRTUAL_TIME_ENABLE."
+#endif
+
+/* Define the CPUs of the real-time host configuration.  */
+
+int                 _tx_linux_real_time_cpu =  TX_LINUX_REAL_TIME_CPU;
+int                 _tx_linux_real_time_isr_cpu =  TX_LINUX_REAL_TIME_ISR_CPU;
+
+/* Define the statistics of the timer interrupt.  The wake-up latency is the time
+   from the deadline of a tick until the timer interrupt thread runs, the jitter
+   is the deviation of the time between two wake-ups from the tick period.  Both
+   are counted in histograms of 1 microsecond buckets, the last bucket counts all
+   larger values.  */
+
+#ifndef TX_LINUX_REAL_TIME_HISTOGRAM_SIZE
+#define TX_LINUX_REAL_TIME_HISTOGRAM_SIZE       1000
+#endif
+
+typedef struct TX_LINUX_REAL_TIME_STATISTICS_STRUCT
+{
+    ULONG64             tx_linux_real_time_statistics_count;
+    ULONG64             tx_linux_real_time_statistics_min;
+    ULONG64             tx_linux_real_time_statistics_max;
+    ULONG64             tx_linux_real_time_statistics_histogram[TX_LINUX_REAL_TIME_HISTOGRAM_SIZE + 1];
+} TX_LINUX_REAL_TIME_STATISTICS;
+
+static TX_LINUX_REAL_TIME_STATISTICS    _tx_linux_real_time_latency;
+static TX_LINUX_REAL_TIME_STATISTICS    _tx_linux_real_time_jitter;
+static unsigned long long               _tx_linux_real_time_wake_time;
+#endif
  
-/* Define signals for linux thread. */
+/* Define the signal used to suspend a running linux thread.  The suspended
+   thread waits on its run futex inside the signal handler, so no resume
+   signal is needed.  */
 #define SUSPEND_SIG SIGUSR1
-#define RESUME_SIG  SIGUSR2
 
-static sigset_t     _tx_linux_thread_wait_mask;
-static __thread int _tx_linux_thread_suspended; 
-static sem_t        _tx_linux_thread_timer_wait;
-static sem_t        _tx_linux_thread_other_wait;
+static int          _tx_linux_thread_suspend_futex;
 
 /* Define simulated timer interrupt.  This is done inside a thread, which is
    how other interrupts may be defined as well.  See code below for an 
@@ -59,13 +116,90 @@ static sem_t        _tx_linux_thread_other_wait;
 
 pthread_t           _tx_linux_timer_id;
 sem_t               _tx_linux_timer_semaphore;
-sem_t               _tx_linux_isr_semaphore;
+int                 _tx_linux_isr_futex;
 void               *_tx_linux_timer_interrupt(void *p);
 
-void    _tx_linux_thread_resume_handler(int sig);
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define simulated high-resolution timer interrupt.  The one-shot timer is a
+   timerfd on CLOCK_MONOTONIC, which this interrupt thread waits on.  */
+
+pthread_t           _tx_linux_high_resolution_timer_id;
+sem_t               _tx_linux_high_resolution_timer_semaphore;
+int                 _tx_linux_high_resolution_timer_fd;
+void               *_tx_linux_high_resolution_timer_interrupt(void *p);
+#endif
+
+/* Define simulated interrupts driven by file descriptors.  A single interrupt
+   thread waits on an epoll instance and calls the ISR registered for each file
+   descriptor that becomes ready.  The epoll data of a file descriptor holds the
+   index of its entry and the generation of the entry at registration, so an
+   event returned for an entry that was unregistered or registered again since
+   is not dispatched.  */
+
+typedef struct TX_LINUX_INTERRUPT_FD_STRUCT
+{
+    int             tx_linux_interrupt_fd;
+    ULONG           tx_linux_interrupt_fd_isr_id;
+    VOID            (*tx_linux_interrupt_fd_isr)(int fd, ULONG events);
+    UINT            tx_linux_interrupt_fd_generation;
+} TX_LINUX_INTERRUPT_FD;
+
+pthread_t               _tx_linux_interrupt_fd_id;
+sem_t                   _tx_linux_interrupt_fd_semaphore;
+int                     _tx_linux_interrupt_fd_epoll;
+TX_LINUX_INTERRUPT_FD   _tx_linux_interrupt_fd_table[TX_LINUX_INTERRUPT_FD_MAX];
+void                   *_tx_linux_interrupt_fd_thread(void *p);
+
 void    _tx_linux_thread_suspend_handler(int sig);
 void    _tx_linux_thread_suspend(pthread_t thread_id);
 
+/* Define the low power utility service used to catch up on the ticks that
+   were missed by the timer interrupt thread.  */
+
+VOID    tx_time_increment(ULONG time_increment);
+
+static VOID *_tx_linux_memory_allocate(VOID);
+
+#ifndef TX_LINUX_TICKLESS_ENABLE
+static VOID _tx_linux_timer_tick_deliver(VOID);
+#endif
+
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+static VOID _tx_linux_real_time_setup(VOID);
+static VOID _tx_linux_real_time_sample(TX_LINUX_REAL_TIME_STATISTICS *statistics, ULONG64 value);
+#endif
+
+#ifdef TX_LINUX_VIRTUAL_TIME_ENABLE
+
+#if defined(TX_LINUX_TICKLESS_ENABLE) || defined(TX_TIMER_ENABLE_HIGH_RESOLUTION)
+#error "TX_LINUX_VIRTUAL_TIME_ENABLE can not be used together with TX_LINUX_TICKLESS_ENABLE or TX_TIMER_ENABLE_HIGH_RESOLUTION."
+#endif
+
+/* Define the low power utility service used to find the next timer expiration.  */
+
+ULONG   tx_timer_get_next(ULONG *next_timer_tick_ptr);
+
+extern ULONG        _tx_thread_system_state;
+extern TX_THREAD    *_tx_thread_execute_ptr;
+#endif
+
+#ifdef TX_LINUX_TICKLESS_ENABLE
+
+/* Define the flag that is set while the timer interrupt thread sleeps beyond
+   the next tick because the system is idle.  The scheduler posts the timer
+   semaphore when it finds a thread to execute while this flag is set.  */
+
+UINT                _tx_linux_timer_tickless_sleep;
+
+/* Define the low power utility service used to find the next timer expiration.  */
+
+ULONG   tx_timer_get_next(ULONG *next_timer_tick_ptr);
+
+extern TX_THREAD    *_tx_thread_execute_ptr;
+extern ULONG        _tx_timer_time_slice;
+#endif
+
 #ifdef TX_LINUX_DEBUG_ENABLE
 
 extern ULONG        _tx_thread_system_state;
@@ -74,15 +208,19 @@ extern TX_THREAD    *_tx_thread_current_ptr;
 extern TX_THREAD    *_tx_thread_execute_ptr;
 
 
-/* Define debug log in order to debug Linux issues with this port.  */
+/* Define debug log in order to debug Linux issues with this port.  Each Linux
+   thread logs into its own ring, so no lock is needed to insert an entry.  The
+   rings are merged by time stamp when the log is dumped.  */
 
 typedef struct TX_LINUX_DEBUG_ENTRY_STRUCT
 {
     char                *tx_linux_debug_entry_action;
-    struct timespec     tx_linux_debug_entry_timestamp;
+    ULONG64             tx_linux_debug_entry_timestamp;
     char                *tx_linux_debug_entry_file;
     unsigned long       tx_linux_debug_entry_line;
-    pthread_mutex_t     tx_linux_debug_entry_mutex;
+    pid_t               tx_linux_debug_entry_tid;
+    int                 tx_linux_debug_entry_mutex_owner;
+    unsigned int        tx_linux_debug_entry_mutex_count;
     unsigned long       tx_linux_debug_entry_int_disabled_flag;
     ULONG               tx_linux_debug_entry_system_state;
     UINT                tx_linux_debug_entry_preempt_disable;
@@ -91,63 +229,267 @@ typedef struct TX_LINUX_DEBUG_ENTRY_STRUCT
 } TX_LINUX_DEBUG_ENTRY;
 
 
-/* Define the maximum size of the Linux debug array.  */
+/* Define the maximum size of the Linux debug ring of each thread.  */
 
 #ifndef TX_LINUX_DEBUG_EVENT_SIZE
 #define TX_LINUX_DEBUG_EVENT_SIZE       400
 #endif
 
 
-/* Define the circular array of Linux debug entries.  */
+/* Define the debug ring of a Linux thread.  The index counts all entries ever
+   inserted, the entry is at the index modulo the ring size.  A ring that is
+   reused by a new thread still holds the entries of the exited thread, so each
+   entry records the thread it was inserted by.  */
+
+typedef struct TX_LINUX_DEBUG_RING_STRUCT
+{
+    struct TX_LINUX_DEBUG_RING_STRUCT
+                        *tx_linux_debug_ring_next;
+    int                 tx_linux_debug_ring_in_use;
+    pid_t               tx_linux_debug_ring_tid;
+    unsigned long       tx_linux_debug_ring_index;
+    TX_LINUX_DEBUG_ENTRY
+                        tx_linux_debug_ring_entries[TX_LINUX_DEBUG_EVENT_SIZE];
+} TX_LINUX_DEBUG_RING;
+
+
+/* Define the list of all debug rings, the ring of the calling thread and the key
+   used to release the ring when the thread exits.  Released rings are reused by
+   new threads.  */
+
+TX_LINUX_DEBUG_RING             *_tx_linux_debug_ring_list;
+static __thread TX_LINUX_DEBUG_RING
+                                *_tx_linux_debug_ring;
+static pthread_key_t            _tx_linux_debug_ring_key;
+static pthread_once_t           _tx_linux_debug_ring_once =  PTHREAD_ONCE_INIT;
+
+
+/* Define the debug time stamp.  The time stamp counter is used on x86, since it
+   is cheaper than any clock.  Otherwise the time stamp is CLOCK_MONOTONIC, which
+   is read through the vDSO.  The time stamps are converted to nanoseconds with
+   the calibration taken when the first ring is created.  */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TX_LINUX_DEBUG_TIME_STAMP_GET()     ((ULONG64) __rdtsc())
+#else
+#define TX_LINUX_DEBUG_TIME_STAMP_GET()     _tx_linux_time_stamp_get()
+#endif
+
+static ULONG64                  _tx_linux_debug_calibration_stamp;
+static ULONG64                  _tx_linux_debug_calibration_time;
+
+
+static void _tx_linux_debug_ring_release(void *ring)
+{
+
+    /* Make the ring of the exiting thread available to new threads.  */
+    __atomic_store_n(&((TX_LINUX_DEBUG_RING *) ring) -> tx_linux_debug_ring_in_use, 0, __ATOMIC_RELEASE);
+}
+
+
+static void _tx_linux_debug_ring_initialize(void)
+{
+
+    /* Create the key that releases the ring of a thread and take the calibration.  */
+    pthread_key_create(&_tx_linux_debug_ring_key, _tx_linux_debug_ring_release);
+    _tx_linux_debug_calibration_time =   _tx_linux_time_stamp_get();
+    _tx_linux_debug_calibration_stamp =  TX_LINUX_DEBUG_TIME_STAMP_GET();
+}
+
+
+static TX_LINUX_DEBUG_RING *_tx_linux_debug_ring_get(void)
+{
+
+TX_LINUX_DEBUG_RING     *ring;
+int                     in_use;
 
-TX_LINUX_DEBUG_ENTRY    _tx_linux_debug_entry_array[TX_LINUX_DEBUG_EVENT_SIZE];
+    pthread_once(&_tx_linux_debug_ring_once, _tx_linux_debug_ring_initialize);
 
+    /* Reuse the ring of a thread that has exited, if there is one.  */
+    for (ring = __atomic_load_n(&_tx_linux_debug_ring_list, __ATOMIC_ACQUIRE); ring; ring = ring -> tx_linux_debug_ring_next)
+    {
+        in_use =  0;
+        if (__atomic_compare_exchange_n(&ring -> tx_linux_debug_ring_in_use, &in_use, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
 
-/* Define the Linux debug index.  */
+    /* Otherwise, create a new ring and add it to the list.  */
+    if (ring == TX_NULL)
+    {
+        ring =  (TX_LINUX_DEBUG_RING *) malloc(sizeof(TX_LINUX_DEBUG_RING));
+        if (ring == TX_NULL)
+        {
+            return(TX_NULL);
+        }
+        memset(ring, 0, sizeof(TX_LINUX_DEBUG_RING));
+        ring -> tx_linux_debug_ring_in_use =  1;
+        ring -> tx_linux_debug_ring_next =  __atomic_load_n(&_tx_linux_debug_ring_list, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&_tx_linux_debug_ring_list, &ring -> tx_linux_debug_ring_next, ring, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+        }
+    }
 
-unsigned long           _tx_linux_debug_entry_index =  0;
+    /* The ring now belongs to this thread.  */
+    ring -> tx_linux_debug_ring_tid =  (pid_t) syscall(SYS_gettid);
+    pthread_setspecific(_tx_linux_debug_ring_key, ring);
+    _tx_linux_debug_ring =  ring;
+    return(ring);
+}
 
 
 /* Now define the debug entry function.  */
 void    _tx_linux_debug_entry_insert(char *action, char *file, unsigned long line)
 {
 
-pthread_mutex_t        temp_copy;
+TX_LINUX_DEBUG_RING     *ring;
+TX_LINUX_DEBUG_ENTRY    *entry;
+unsigned long           index;
+
+    /* Pickup the ring of this thread.  */
+    ring =  _tx_linux_debug_ring;
+    if (ring == TX_NULL)
+    {
+        ring =  _tx_linux_debug_ring_get();
+        if (ring == TX_NULL)
+        {
+            return;
+        }
+    }
+
+    /* Setup the debug entry.  Only this thread writes to the ring.  */
+    index =  ring -> tx_linux_debug_ring_index;
+    entry =  &ring -> tx_linux_debug_ring_entries[index % TX_LINUX_DEBUG_EVENT_SIZE];
+    entry -> tx_linux_debug_entry_action =             action;
+    entry -> tx_linux_debug_entry_timestamp =          TX_LINUX_DEBUG_TIME_STAMP_GET();
+    entry -> tx_linux_debug_entry_file =               file;
+    entry -> tx_linux_debug_entry_line =               line;
+    entry -> tx_linux_debug_entry_tid =                ring -> tx_linux_debug_ring_tid;
+    entry -> tx_linux_debug_entry_mutex_owner =        _tx_linux_mutex.__data.__owner;
+    entry -> tx_linux_debug_entry_mutex_count =        _tx_linux_mutex.__data.__count;
+    entry -> tx_linux_debug_entry_int_disabled_flag =  _tx_linux_global_int_disabled_flag;
+    entry -> tx_linux_debug_entry_system_state =       _tx_thread_system_state;
+    entry -> tx_linux_debug_entry_preempt_disable =    _tx_thread_preempt_disable;
+    entry -> tx_linux_debug_entry_current_thread =     _tx_thread_current_ptr;
+    entry -> tx_linux_debug_entry_execute_thread =     _tx_thread_execute_ptr;
+
+    /* Now publish the entry by moving to the next one.  */
+    __atomic_store_n(&ring -> tx_linux_debug_ring_index, index + 1, __ATOMIC_RELEASE);
+}
+
+
+/* Define the dump of the debug log.  The entries of all rings are merged by time
+   stamp and written to the file, or to stdout if the file name is NULL.  The dump
+   may be called from the application or from a debugger at any time.  */
+
+static int _tx_linux_debug_dump_compare(const void *a, const void *b)
+{
+
+ULONG64     stamp_a =  ((const TX_LINUX_DEBUG_ENTRY *) a) -> tx_linux_debug_entry_timestamp;
+ULONG64     stamp_b =  ((const TX_LINUX_DEBUG_ENTRY *) b) -> tx_linux_debug_entry_timestamp;
 
-    /* Save the current critical section value.  */
-    temp_copy =  _tx_linux_mutex;
+    return((stamp_a > stamp_b) - (stamp_a < stamp_b));
+}
 
-    /* Lock mutex.  */
-    tx_linux_mutex_lock(_tx_linux_mutex);
 
-    /* Get the time stamp.  */
-    clock_gettime(CLOCK_REALTIME, &_tx_linux_time_stamp);
-
-    /* Setup the debub entry.  */
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_action =             action;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_timestamp =          _tx_linux_time_stamp;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_file =               file;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_line =               line;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_mutex =              temp_copy;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_int_disabled_flag =  _tx_linux_global_int_disabled_flag;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_system_state =       _tx_thread_system_state;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_preempt_disable =    _tx_thread_preempt_disable;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_current_thread =     _tx_thread_current_ptr;
-    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_execute_thread =     _tx_thread_execute_ptr;
-
-    /* Now move to the next entry.  */
-    _tx_linux_debug_entry_index++;
-    
-    /* Determine if we need to wrap the list.  */
-    if (_tx_linux_debug_entry_index >= TX_LINUX_DEBUG_EVENT_SIZE)
+UINT    _tx_linux_debug_dump(const char *file_name)
+{
+
+TX_LINUX_DEBUG_RING         *ring;
+TX_LINUX_DEBUG_ENTRY        *dump;
+unsigned long               count;
+unsigned long               total;
+unsigned long               index;
+unsigned long               first;
+double                      scale;
+ULONG64                     stamp;
+ULONG64                     current_time;
+FILE                        *file;
+char                        *file_base;
+char                        location[64];
+
+    /* Count the entries of all rings.  */
+    total =  0;
+    for (ring = __atomic_load_n(&_tx_linux_debug_ring_list, __ATOMIC_ACQUIRE); ring; ring = ring -> tx_linux_debug_ring_next)
     {
-    
-        /* Yes, wrap the list!  */
-        _tx_linux_debug_entry_index =  0;
+        count =  __atomic_load_n(&ring -> tx_linux_debug_ring_index, __ATOMIC_ACQUIRE);
+        total +=  (count < TX_LINUX_DEBUG_EVENT_SIZE) ? count : TX_LINUX_DEBUG_EVENT_SIZE;
+    }
+    if (total == 0)
+    {
+        return(TX_NOT_AVAILABLE);
     }
 
-    /* Unlock mutex.  */
-    tx_linux_mutex_unlock(_tx_linux_mutex);
+    /* Copy the entries of all rings.  Entries that are overwritten while they are
+       copied may be torn, since the rings are not locked.  */
+    dump =  (TX_LINUX_DEBUG_ENTRY *) malloc(total * sizeof(TX_LINUX_DEBUG_ENTRY));
+    if (dump == TX_NULL)
+    {
+        return(TX_NO_MEMORY);
+    }
+    count =  0;
+    for (ring = __atomic_load_n(&_tx_linux_debug_ring_list, __ATOMIC_ACQUIRE); ring; ring = ring -> tx_linux_debug_ring_next)
+    {
+        index =  __atomic_load_n(&ring -> tx_linux_debug_ring_index, __ATOMIC_ACQUIRE);
+        first =  (index < TX_LINUX_DEBUG_EVENT_SIZE) ? 0 : (index - TX_LINUX_DEBUG_EVENT_SIZE);
+        while ((first < index) && (count < total))
+        {
+            dump[count] =  ring -> tx_linux_debug_ring_entries[first % TX_LINUX_DEBUG_EVENT_SIZE];
+            first++;
+            count++;
+        }
+    }
+
+    /* Merge the rings by sorting all entries by time stamp.  */
+    qsort(dump, count, sizeof(TX_LINUX_DEBUG_ENTRY), _tx_linux_debug_dump_compare);
+
+    /* Calculate the scale from time stamps to nanoseconds.  */
+    current_time =  _tx_linux_time_stamp_get();
+    stamp =  TX_LINUX_DEBUG_TIME_STAMP_GET();
+    scale =  1.0;
+    if (stamp > _tx_linux_debug_calibration_stamp)
+    {
+        scale =  ((double) (current_time - _tx_linux_debug_calibration_time)) / ((double) (stamp - _tx_linux_debug_calibration_stamp));
+    }
+
+    /* Write the entries, with the time in microseconds since the first ring was created.  */
+    file =  (file_name == TX_NULL) ? stdout : fopen(file_name, "w");
+    if (file == TX_NULL)
+    {
+        free(dump);
+        return(TX_NOT_AVAILABLE);
+    }
+    fprintf(file, "%14s %7s %-28s %-40s %7s %4s %10s %4s %18s %18s\n", "time[us]", "tid", "action", "file:line",
+            "owner", "lock", "state", "pdis", "current", "execute");
+    for (index = 0; index < count; index++)
+    {
+        file_base =  strrchr(dump[index].tx_linux_debug_entry_file, '/');
+        file_base =  (file_base == TX_NULL) ? dump[index].tx_linux_debug_entry_file : (file_base + 1);
+        snprintf(location, sizeof(location), "%s:%lu", file_base, dump[index].tx_linux_debug_entry_line);
+        fprintf(file, "%14.3f %7d %-28s %-40s %7d %4u %10lu %4u %18p %18p\n",
+                ((double) (dump[index].tx_linux_debug_entry_timestamp - _tx_linux_debug_calibration_stamp)) * scale / 1000.0,
+                (int) dump[index].tx_linux_debug_entry_tid,
+                dump[index].tx_linux_debug_entry_action,
+                location,
+                dump[index].tx_linux_debug_entry_mutex_owner,
+                dump[index].tx_linux_debug_entry_mutex_count,
+                (unsigned long) dump[index].tx_linux_debug_entry_system_state,
+                dump[index].tx_linux_debug_entry_preempt_disable,
+                (void *) dump[index].tx_linux_debug_entry_current_thread,
+                (void *) dump[index].tx_linux_debug_entry_execute_thread);
+    }
+    if (file != stdout)
+    {
+        fclose(file);
+    }
+    else
+    {
+        fflush(file);
+    }
+    free(dump);
+
+    return(TX_SUCCESS);
 }
 
 #endif
@@ -156,6 +498,9 @@ pthread_mutex_t        temp_copy;
 /* Define the ThreadX timer interrupt handler.  */
 
 void    _tx_timer_interrupt(void);
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+VOID    _tx_timer_high_resolution_expiration_process(VOID);
+#endif
 
 
 /* Define other external function references.  */
@@ -202,6 +547,8 @@ extern VOID     *_tx_initialize_unused_memory;
 /*    getpid                                                              */ 
 /*    _tx_linux_thread_init                                               */ 
 /*    pthread_setschedparam                                               */ 
+/*    _tx_linux_memory_allocate                                           */ 
+/*    _tx_linux_real_time_setup                                           */ 
 /*    pthread_mutexattr_init                                              */ 
 /*    pthread_mutex_init                                                  */ 
 /*    _tx_linux_thread_suspend                                            */ 
@@ -225,7 +572,7 @@ VOID   _tx_initialize_low_level(VOID)
 struct sched_param sp;
 pthread_mutexattr_t attr;
 
-#ifdef TX_LINUX_MULTI_CORE
+#if defined(TX_LINUX_MULTI_CORE) && !defined(TX_LINUX_REAL_TIME_ENABLE)
 cpu_set_t mask;
 
     sched_getaffinity(getpid(), sizeof(mask), &mask);
@@ -252,7 +599,16 @@ cpu_set_t mask;
     /* Pickup the first available memory address.  */
 
     /* Save the first available memory address.  */
-    _tx_initialize_unused_memory =  malloc(TX_LINUX_MEMORY_SIZE);
+    _tx_initialize_unused_memory =  _tx_linux_memory_allocate();
+    if (_tx_initialize_unused_memory == TX_NULL)
+    {
+
+        /* Error mapping the memory region.  */
+        printf("ThreadX Linux error mapping %lu bytes of memory!\n", (unsigned long) _tx_linux_memory_size);
+        while(1)
+        {
+        }
+    }
 
     /* Init Linux thread. */
     _tx_linux_thread_init();
@@ -261,16 +617,21 @@ cpu_set_t mask;
     sp.sched_priority = TX_LINUX_PRIORITY_SCHEDULE;
     pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp);
 
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+
+    /* Pin the scheduler to its CPU and lock all memory.  The threads created
+       from here on inherit the CPU of the scheduler.  */
+    _tx_linux_real_time_setup();
+#endif
+
     /* Create the system critical section.  This is used by the 
        scheduler thread (which is the main thread) to block all
        other stuff out.  */
     pthread_mutexattr_init(&attr);
     pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
     pthread_mutex_init(&_tx_linux_mutex, &attr);
-    sem_init(&_tx_linux_semaphore, 0, 0);
-#ifdef TX_LINUX_NO_IDLE_ENABLE
-    sem_init(&_tx_linux_semaphore_no_idle, 0, 0);
-#endif /* TX_LINUX_NO_IDLE_ENABLE */
+    _tx_linux_scheduler_futex =  TX_LINUX_FUTEX_EMPTY;
+    _tx_linux_idle_futex =  TX_LINUX_FUTEX_EMPTY;
 
     /* Initialize the global interrupt disabled flag.  */
     _tx_linux_global_int_disabled_flag =  TX_FALSE;
@@ -278,8 +639,10 @@ cpu_set_t mask;
     /* Create semaphore for timer thread. */
     sem_init(&_tx_linux_timer_semaphore, 0, 0);
     
-    /* Create semaphore for ISR thread. */
-    sem_init(&_tx_linux_isr_semaphore, 0, 0);
+    /* Clear the futex for ISR thread. */
+    _tx_linux_isr_futex =  TX_LINUX_FUTEX_EMPTY;
+
+#ifndef TX_LINUX_VIRTUAL_TIME_ENABLE
 
     /* Setup periodic timer interrupt.  */
     if(pthread_create(&_tx_linux_timer_id, NULL, _tx_linux_timer_interrupt, NULL))
@@ -297,155 +660,1089 @@ cpu_set_t mask;
        threads.  */
     sp.sched_priority = TX_LINUX_PRIORITY_ISR;
     pthread_setschedparam(_tx_linux_timer_id, SCHED_FIFO, &sp);
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+    _tx_linux_real_time_affinity_set(_tx_linux_timer_id, _tx_linux_real_time_isr_cpu);
+#endif
+#else
 
-    /* Done, return to caller.  */
-}
+    /* There is no periodic timer interrupt in virtual time mode.  The other
+       interrupt threads use the timer interrupt priority.  */
+    sp.sched_priority = TX_LINUX_PRIORITY_ISR;
+#endif
 
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
 
-/* This routine is called after initialization is complete in order to start
-   all interrupt threads.  Interrupt threads in addition to the timer may 
-   be added to this routine as well.  */
+    /* Create the one-shot timer and the semaphore for the high-resolution
+       timer thread.  */
+    _tx_linux_high_resolution_timer_fd =  timerfd_create(CLOCK_MONOTONIC, 0);
+    sem_init(&_tx_linux_high_resolution_timer_semaphore, 0, 0);
 
-void    _tx_initialize_start_interrupts(void)
-{
+    /* Setup high-resolution timer interrupt.  */
+    if ((_tx_linux_high_resolution_timer_fd < 0) ||
+        (pthread_create(&_tx_linux_high_resolution_timer_id, NULL, _tx_linux_high_resolution_timer_interrupt, NULL)))
+    {
 
-    /* Kick the timer thread off to generate the ThreadX periodic interrupt
-       source.  */
-    tx_linux_sem_post(&_tx_linux_timer_semaphore);
+        /* Error creating the high-resolution timer interrupt.  */
+        printf("ThreadX Linux error creating high-resolution timer interrupt thread!\n");
+        while(1)
+        {
+        }
+    }
+
+    /* Set the same priority as the timer interrupt.  */
+    pthread_setschedparam(_tx_linux_high_resolution_timer_id, SCHED_FIFO, &sp);
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+    _tx_linux_real_time_affinity_set(_tx_linux_high_resolution_timer_id, _tx_linux_real_time_isr_cpu);
+#endif
+#endif
+
+    /* Create the epoll instance and the semaphore for the file descriptor
+       interrupt thread.  */
+    _tx_linux_interrupt_fd_epoll =  epoll_create1(EPOLL_CLOEXEC);
+    sem_init(&_tx_linux_interrupt_fd_semaphore, 0, 0);
+
+    /* Setup file descriptor interrupts.  */
+    if ((_tx_linux_interrupt_fd_epoll < 0) ||
+        (pthread_create(&_tx_linux_interrupt_fd_id, NULL, _tx_linux_interrupt_fd_thread, NULL)))
+    {
+
+        /* Error creating the file descriptor interrupt.  */
+        printf("ThreadX Linux error creating file descriptor interrupt thread!\n");
+        while(1)
+        {
+        }
+    }
+
+    /* Set the same priority as the timer interrupt.  */
+    pthread_setschedparam(_tx_linux_interrupt_fd_id, SCHED_FIFO, &sp);
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+    _tx_linux_real_time_affinity_set(_tx_linux_interrupt_fd_id, _tx_linux_real_time_isr_cpu);
+#endif
+
+    /* Done, return to caller.  */
 }
 
 
-/* Define the ThreadX system timer interrupt.  Other interrupts may be simulated
-   in a similar way.  */
+/* Define the time stamp of the Linux port, which is CLOCK_MONOTONIC in nanoseconds.
+   The trace time source is the lower 32 bits of it.  */
 
-void    *_tx_linux_timer_interrupt(void *p)
+ULONG64 _tx_linux_time_stamp_get(VOID)
 {
 struct timespec ts;
-long timer_periodic_nsec;
-int err;
 
-    (VOID)p;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return(((ULONG64) ts.tv_sec) * ((ULONG64) 1000000000) + ((ULONG64) ts.tv_nsec));
+}
 
-    /* Calculate periodic timer. */
-    timer_periodic_nsec = 1000000000 / TX_TIMER_TICKS_PER_SECOND;
-    nice(10);
 
-    /* Wait startup semaphore. */
-    tx_linux_sem_wait(&_tx_linux_timer_semaphore);
+/* Map the memory region that is passed to tx_application_define.  The region
+   is backed by reserved huge pages when they are available, otherwise it is
+   aligned to the huge page size and marked for transparent huge pages, so the
+   pools and stacks of the application need few TLB entries.  It is optionally
+   locked into RAM, so it is never paged out.  */
 
-    while(1)
-    {
+static VOID *_tx_linux_memory_allocate(VOID)
+{
 
-        clock_gettime(CLOCK_REALTIME, &ts);
-        ts.tv_nsec += timer_periodic_nsec;
-        if (ts.tv_nsec > 1000000000)
-        {
-            ts.tv_nsec -= 1000000000;
-            ts.tv_sec++;
-        }
-        do
+FILE        *meminfo;
+char        line[64];
+size_t      huge_page_size;
+size_t      size;
+size_t      head;
+char        *memory;
+
+    /* Pickup the default huge page size, in kB in /proc/meminfo.  */
+    huge_page_size =  0;
+    meminfo =  fopen("/proc/meminfo", "r");
+    if (meminfo != NULL)
+    {
+        while (fgets(line, sizeof(line), meminfo) != NULL)
         {
-            if (sem_timedwait(&_tx_linux_timer_semaphore, &ts) == 0)
+            if (sscanf(line, "Hugepagesize: %zu kB", &huge_page_size) == 1)
             {
+                huge_page_size =  huge_page_size * 1024;
                 break;
             }
-            err = errno;
-        } while (err != ETIMEDOUT);
+        }
+        fclose(meminfo);
+    }
 
-        /* Call ThreadX context save for interrupt preparation.  */
-        _tx_thread_context_save();
+    memory =  MAP_FAILED;
+    size =  (size_t) _tx_linux_memory_size;
+    if ((_tx_linux_memory_options & TX_LINUX_MEMORY_HUGE_PAGES) && (huge_page_size != 0))
+    {
 
-        /* Call trace ISR enter event insert.  */
-        _tx_trace_isr_enter_insert(0);
+        /* Round the region up to whole huge pages.  */
+        size =  (size + huge_page_size - 1) & ~(huge_page_size - 1);
 
-        /* Call the ThreadX system timer interrupt processing.  */
-        _tx_timer_interrupt();
+        /* Try the huge pages reserved in /proc/sys/vm/nr_hugepages first.  */
+        memory =  mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory == MAP_FAILED)
+        {
 
-        /* Call trace ISR exit event insert.  */
-        _tx_trace_isr_exit_insert(0);
+            /* Otherwise map one huge page more than needed and trim the region
+               to a huge page boundary, so transparent huge pages can back it.  */
+            memory =  mmap(NULL, size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory != MAP_FAILED)
+            {
+                head =  (size_t) ((huge_page_size - (((ALIGN_TYPE) memory) & (huge_page_size - 1))) & (huge_page_size - 1));
+                if (head != 0)
+                {
+                    munmap(memory, head);
+                }
+                munmap(memory + head + size, huge_page_size - head);
+                memory =  memory + head;
+
+                if (madvise(memory, size, MADV_HUGEPAGE) != 0)
+                {
+
+                    /* Transparent huge pages are not available.  */
+                    _tx_linux_memory_options &=  ~((ULONG) TX_LINUX_MEMORY_HUGE_PAGES);
+                }
+            }
+        }
+    }
+    else
+    {
 
-        /* Call ThreadX context restore for interrupt completion.  */
-        _tx_thread_context_restore();
+        /* Huge pages are not requested or not supported.  */
+        _tx_linux_memory_options &=  ~((ULONG) TX_LINUX_MEMORY_HUGE_PAGES);
+        memory =  mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
 
-#ifdef TX_LINUX_NO_IDLE_ENABLE
-        tx_linux_mutex_lock(_tx_linux_mutex);
+    if (memory == MAP_FAILED)
+    {
+        return(TX_NULL);
+    }
 
-        /* Make sure semaphore is 0. */
-        while(!sem_trywait(&_tx_linux_semaphore_no_idle));
+    /* Lock the region into RAM if requested.  This needs the CAP_IPC_LOCK
+       capability or a sufficient RLIMIT_MEMLOCK.  */
+    if ((_tx_linux_memory_options & TX_LINUX_MEMORY_LOCK) && (mlock(memory, size) != 0))
+    {
 
-        /* Wakeup the system thread by setting the system semaphore.  */
-        tx_linux_sem_post(&_tx_linux_semaphore_no_idle);
+        /* The region can be paged out.  */
+        _tx_linux_memory_options &=  ~((ULONG) TX_LINUX_MEMORY_LOCK);
+    }
 
-        tx_linux_mutex_unlock(_tx_linux_mutex);
-#endif /* TX_LINUX_NO_IDLE_ENABLE */
-    } 
+    return((VOID *) memory);
 }
 
-/* Define functions for linux thread. */
-void    _tx_linux_thread_resume_handler(int sig)
-{
-    (VOID)sig;
-}
 
-void    _tx_linux_thread_suspend_handler(int sig)
-{
-    (VOID)sig;
+#ifdef TX_LINUX_REAL_TIME_ENABLE
 
-    if(pthread_equal(pthread_self(), _tx_linux_timer_id))
-        tx_linux_sem_post_nolock(&_tx_linux_thread_timer_wait);
-    else
-        tx_linux_sem_post_nolock(&_tx_linux_thread_other_wait);
+/* Select the CPUs of the real-time host configuration, pin the calling thread,
+   which is the scheduler, to its CPU and lock all current and future memory of
+   the process.  Memory that is not used yet, e.g. the unused part of thread
+   stacks, is locked when it is first touched.  */
 
-    if(_tx_linux_thread_suspended) 
-        return;
+static VOID _tx_linux_real_time_setup(VOID)
+{
 
-    _tx_linux_thread_suspended = 1;
-    sigsuspend(&_tx_linux_thread_wait_mask); 
-    _tx_linux_thread_suspended = 0;
-}
+FILE                *isolated;
+cpu_set_t           mask;
+struct sched_param  sp;
+int                 policy;
+int                 cpu;
+int                 i;
+
+    /* Pickup the first isolated CPU, or the last available CPU.  */
+    cpu =  -1;
+    isolated =  fopen("/sys/devices/system/cpu/isolated", "r");
+    if (isolated != NULL)
+    {
+        if (fscanf(isolated, "%d", &cpu) != 1)
+        {
+            cpu =  -1;
+        }
+        fclose(isolated);
+    }
+    if ((cpu < 0) && (sched_getaffinity(0, sizeof(mask), &mask) == 0))
+    {
+        for (i = 0; i < CPU_SETSIZE; i++)
+        {
+            if (CPU_ISSET(i, &mask))
+            {
+                cpu =  i;
+            }
+        }
+    }
 
-void    _tx_linux_thread_suspend(pthread_t thread_id)
-{
+    /* Resolve the CPUs that are selected automatically.  */
+    if (_tx_linux_real_time_cpu < 0)
+    {
+        _tx_linux_real_time_cpu =  cpu;
+    }
+    if (_tx_linux_real_time_isr_cpu < 0)
+    {
+        _tx_linux_real_time_isr_cpu =  _tx_linux_real_time_cpu;
+    }
 
-    /* Send signal. */
-    tx_linux_mutex_lock(_tx_linux_mutex);
-    pthread_kill(thread_id, SUSPEND_SIG);
-    tx_linux_mutex_unlock(_tx_linux_mutex);
+    /* Pin the scheduler.  */
+    _tx_linux_real_time_affinity_set(pthread_self(), _tx_linux_real_time_cpu);
 
-    /* Wait until signal is received. */
-    if(pthread_equal(thread_id, _tx_linux_timer_id))
-        tx_linux_sem_wait(&_tx_linux_thread_timer_wait);
-    else
-        tx_linux_sem_wait(&_tx_linux_thread_other_wait);
+    /* Determine if the scheduler runs with a real-time priority.  */
+    if ((pthread_getschedparam(pthread_self(), &policy, &sp) != 0) || (policy != SCHED_FIFO))
+    {
+        printf("ThreadX Linux warning: SCHED_FIFO is not available, run with privilege for real-time operation!\n");
+    }
+
+    /* Lock the memory of the process.  */
+#ifdef MCL_ONFAULT
+    if (mlockall(MCL_CURRENT | MCL_FUTURE | MCL_ONFAULT) != 0)
+#else
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+#endif
+    {
+        printf("ThreadX Linux warning: locking the memory failed, memory may be paged out!\n");
+    }
 }
 
-void    _tx_linux_thread_resume(pthread_t thread_id)
-{
 
-    /* Send signal. */
-    tx_linux_mutex_lock(_tx_linux_mutex);
-    pthread_kill(thread_id, RESUME_SIG);
-    tx_linux_mutex_unlock(_tx_linux_mutex);
-}
+/* Pin a thread of the real-time host configuration to a CPU.  */
 
-void    _tx_linux_thread_init()
+VOID    _tx_linux_real_time_affinity_set(pthread_t thread_id, int cpu)
 {
-struct sigaction sa;
 
-    /* Create semaphore for linux thread. */
-    sem_init(&_tx_linux_thread_timer_wait, 0, 0);
-    sem_init(&_tx_linux_thread_other_wait, 0, 0);
+cpu_set_t   mask;
 
-    sigfillset(&_tx_linux_thread_wait_mask);
-    sigdelset(&_tx_linux_thread_wait_mask, RESUME_SIG);
-
-    sigfillset(&sa.sa_mask);
-    sa.sa_flags = 0;
-    sa.sa_handler = _tx_linux_thread_resume_handler;
-    sigaction(RESUME_SIG, &sa, NULL);
+    CPU_ZERO(&mask);
+    if ((cpu >= 0) && (cpu < CPU_SETSIZE))
+    {
+        CPU_SET(cpu, &mask);
+    }
+    if ((CPU_COUNT(&mask) == 0) || (pthread_setaffinity_np(thread_id, sizeof(mask), &mask) != 0))
+    {
 
-    sa.sa_handler = _tx_linux_thread_suspend_handler;
-    sigaction(SUSPEND_SIG, &sa, NULL);
+        /* Error pinning the thread to the CPU.  */
+        printf("ThreadX Linux error pinning a thread to CPU %d!\n", cpu);
+        while(1)
+        {
+        }
+    }
+}
+
+
+/* Add a value in nanoseconds to the statistics of the timer interrupt.  */
+
+static VOID _tx_linux_real_time_sample(TX_LINUX_REAL_TIME_STATISTICS *statistics, ULONG64 value)
+{
+
+ULONG64     bucket;
+
+    if ((statistics -> tx_linux_real_time_statistics_count == 0) || (value < statistics -> tx_linux_real_time_statistics_min))
+    {
+        statistics -> tx_linux_real_time_statistics_min =  value;
+    }
+    if (value > statistics -> tx_linux_real_time_statistics_max)
+    {
+        statistics -> tx_linux_real_time_statistics_max =  value;
+    }
+    bucket =  value / 1000;
+    if (bucket > TX_LINUX_REAL_TIME_HISTOGRAM_SIZE)
+    {
+        bucket =  TX_LINUX_REAL_TIME_HISTOGRAM_SIZE;
+    }
+    statistics -> tx_linux_real_time_statistics_histogram[bucket]++;
+    statistics -> tx_linux_real_time_statistics_count++;
+}
+
+
+/* Print one line of the real-time report.  The percentiles are rounded up to the
+   next microsecond.  */
+
+static VOID _tx_linux_real_time_statistics_print(FILE *file, const char *name, TX_LINUX_REAL_TIME_STATISTICS *statistics)
+{
+
+static const ULONG64    percentiles[] = { 5000, 9000, 9900, 9990, 9999 };
+ULONG64                 count;
+ULONG64                 target;
+ULONG64                 sum;
+UINT                    bucket;
+UINT                    i;
+
+    count =  statistics -> tx_linux_real_time_statistics_count;
+    fprintf(file, "%-16s %9.1f", name, ((double) statistics -> tx_linux_real_time_statistics_min) / 1000.0);
+    for (i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+    {
+        target =  (count * percentiles[i] + 9999) / 10000;
+        sum =  0;
+        for (bucket = 0; bucket < TX_LINUX_REAL_TIME_HISTOGRAM_SIZE; bucket++)
+        {
+            sum =  sum + statistics -> tx_linux_real_time_statistics_histogram[bucket];
+            if (sum >= target)
+            {
+                break;
+            }
+        }
+        if (bucket == TX_LINUX_REAL_TIME_HISTOGRAM_SIZE)
+        {
+            fprintf(file, "     >%4u", (UINT) TX_LINUX_REAL_TIME_HISTOGRAM_SIZE);
+        }
+        else
+        {
+            fprintf(file, " %9u", bucket + 1);
+        }
+    }
+    fprintf(file, " %9.1f\n", ((double) statistics -> tx_linux_real_time_statistics_max) / 1000.0);
 }
 
 
+/* Print the wake-up latency and the jitter of the timer interrupt in
+   microseconds, to the file or to stdout if the file name is NULL.  */
+
+UINT    _tx_linux_real_time_report(const char *file_name)
+{
+
+FILE        *file;
+
+    if (_tx_linux_real_time_latency.tx_linux_real_time_statistics_count == 0)
+    {
+        return(TX_NOT_AVAILABLE);
+    }
+
+    if (file_name == TX_NULL)
+    {
+        file =  stdout;
+    }
+    else
+    {
+        file =  fopen(file_name, "w");
+        if (file == NULL)
+        {
+            return(TX_NOT_AVAILABLE);
+        }
+    }
+
+    fprintf(file, "ThreadX Linux real-time report: CPU %d, ISR CPU %d, %llu ticks, %lu overruns\n",
+            _tx_linux_real_time_cpu, _tx_linux_real_time_isr_cpu,
+            (unsigned long long) _tx_linux_real_time_latency.tx_linux_real_time_statistics_count,
+            (unsigned long) _tx_linux_timer_overrun_count);
+    fprintf(file, "%-16s %9s %9s %9s %9s %9s %9s %9s\n", "[us]", "min", "p50", "p90", "p99", "p99.9", "p99.99", "max");
+    _tx_linux_real_time_statistics_print(file, "wake-up latency", &_tx_linux_real_time_latency);
+    if (_tx_linux_real_time_jitter.tx_linux_real_time_statistics_count != 0)
+    {
+        _tx_linux_real_time_statistics_print(file, "tick jitter", &_tx_linux_real_time_jitter);
+    }
+
+    if (file != stdout)
+    {
+        fclose(file);
+    }
+    else
+    {
+        fflush(file);
+    }
+
+    return(TX_SUCCESS);
+}
+#endif
+
+
+/* This routine is called after initialization is complete in order to start
+   all interrupt threads.  Interrupt threads in addition to the timer may 
+   be added to this routine as well.  */
+
+void    _tx_initialize_start_interrupts(void)
+{
+
+#ifndef TX_LINUX_VIRTUAL_TIME_ENABLE
+
+    /* Kick the timer thread off to generate the ThreadX periodic interrupt
+       source.  */
+    tx_linux_sem_post(&_tx_linux_timer_semaphore);
+#endif
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+    /* Kick the high-resolution timer thread off as well.  */
+    tx_linux_sem_post(&_tx_linux_high_resolution_timer_semaphore);
+#endif
+
+    /* Kick the file descriptor interrupt thread off.  */
+    tx_linux_sem_post(&_tx_linux_interrupt_fd_semaphore);
+}
+
+
+#ifndef TX_LINUX_TICKLESS_ENABLE
+
+/* Deliver one tick of the ThreadX system timer interrupt.  */
+
+static VOID _tx_linux_timer_tick_deliver(VOID)
+{
+
+    /* Call ThreadX context save for interrupt preparation.  */
+    _tx_thread_context_save();
+
+    /* Call trace ISR enter event insert.  */
+    _tx_trace_isr_enter_insert(0);
+
+    /* Call the ThreadX system timer interrupt processing.  */
+    _tx_timer_interrupt();
+
+    /* Call trace ISR exit event insert.  */
+    _tx_trace_isr_exit_insert(0);
+
+    /* Call ThreadX context restore for interrupt completion.  */
+    _tx_thread_context_restore();
+}
+#endif
+
+
+/* Define the ThreadX system timer interrupt.  Other interrupts may be simulated
+   in a similar way.  */
+
+void    *_tx_linux_timer_interrupt(void *p)
+{
+struct timespec ts;
+long timer_periodic_nsec;
+unsigned long long tick_time;
+unsigned long long current_time;
+ULONG ticks;
+#ifndef TX_LINUX_TICKLESS_ENABLE
+ULONG catch_up = 0;
+UINT processed;
+#endif
+#ifdef TX_LINUX_TICKLESS_ENABLE
+int err;
+ULONG sleep_ticks;
+ULONG next_ticks;
+UINT idle;
+#endif
+
+    (VOID)p;
+
+    /* Calculate periodic timer. */
+    timer_periodic_nsec = 1000000000 / TX_TIMER_TICKS_PER_SECOND;
+#ifndef TX_LINUX_REAL_TIME_ENABLE
+    nice(10);
+#endif
+
+    /* Wait startup semaphore. */
+    tx_linux_sem_wait(&_tx_linux_timer_semaphore);
+
+#ifndef TX_LINUX_TICKLESS_ENABLE
+
+    /* Ticks are generated on a fixed grid of CLOCK_MONOTONIC deadlines, starting
+       now.  The processing time of a tick and adjustments of the real-time clock
+       therefore do not move the following ticks.  */
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    tick_time = ((unsigned long long) ts.tv_sec) * 1000000000ULL + ((unsigned long long) ts.tv_nsec);
+
+    while(1)
+    {
+
+        /* Sleep until the deadline of the next tick.  */
+        tick_time += (unsigned long long) timer_periodic_nsec;
+        ts.tv_sec =  (time_t) (tick_time / 1000000000ULL);
+        ts.tv_nsec = (long) (tick_time % 1000000000ULL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        {
+        }
+
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+
+        /* Record the wake-up latency and the jitter of this tick.  */
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        current_time = ((unsigned long long) ts.tv_sec) * 1000000000ULL + ((unsigned long long) ts.tv_nsec);
+        _tx_linux_real_time_sample(&_tx_linux_real_time_latency, (current_time > tick_time) ? (current_time - tick_time) : 0);
+        if (_tx_linux_real_time_wake_time != 0)
+        {
+            _tx_linux_real_time_sample(&_tx_linux_real_time_jitter,
+                                       (current_time - _tx_linux_real_time_wake_time > (unsigned long long) timer_periodic_nsec) ?
+                                       (current_time - _tx_linux_real_time_wake_time - (unsigned long long) timer_periodic_nsec) :
+                                       ((unsigned long long) timer_periodic_nsec - (current_time - _tx_linux_real_time_wake_time)));
+        }
+        _tx_linux_real_time_wake_time = current_time;
+#endif
+
+        /* Deliver the tick that is due now.  */
+        _tx_linux_timer_tick_deliver();
+
+        /* Determine if the timer interrupt thread was delayed beyond the deadline of
+           the following tick, before or while delivering the tick.  If so, the
+           missed ticks are counted as overruns and each of them is delivered as a
+           timer interrupt of its own, so time-slices, timeouts and periodic timers
+           see every tick.  More than TX_LINUX_TIMER_CATCH_UP_MAX pending missed
+           ticks are dropped.  */
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        current_time = ((unsigned long long) ts.tv_sec) * 1000000000ULL + ((unsigned long long) ts.tv_nsec);
+        if (current_time > tick_time)
+        {
+            ticks = (ULONG) ((current_time - tick_time) / ((unsigned long long) timer_periodic_nsec));
+            tick_time += ((unsigned long long) ticks) * ((unsigned long long) timer_periodic_nsec);
+            _tx_linux_timer_overrun_count += ticks;
+            catch_up += ticks;
+            if (catch_up > TX_LINUX_TIMER_CATCH_UP_MAX)
+            {
+                catch_up =  TX_LINUX_TIMER_CATCH_UP_MAX;
+            }
+        }
+
+        /* The timer list does not advance while a timer expiration is pending, and
+           timers are reactivated only after their expiration function was called,
+           so a missed tick is delivered only once the system timer thread has
+           completed the expiration processing of the previous tick.  Wait for this
+           no longer than until the deadline of the next tick, the remaining missed
+           ticks are then delivered after the next tick.  */
+        while (catch_up != 0)
+        {
+
+            processed =  TX_FALSE;
+            while(1)
+            {
+                tx_linux_mutex_lock(_tx_linux_mutex);
+#ifndef TX_TIMER_PROCESS_IN_ISR
+                if ((_tx_timer_expired == TX_FALSE) && (_tx_timer_thread.tx_thread_state != TX_READY))
+#else
+                if (_tx_timer_expired == TX_FALSE)
+#endif
+                {
+                    processed =  TX_TRUE;
+                }
+                tx_linux_mutex_unlock(_tx_linux_mutex);
+
+                clock_gettime(CLOCK_MONOTONIC, &ts);
+                current_time = ((unsigned long long) ts.tv_sec) * 1000000000ULL + ((unsigned long long) ts.tv_nsec);
+                if ((processed == TX_TRUE) || (current_time >= tick_time + (unsigned long long) timer_periodic_nsec))
+                {
+                    break;
+                }
+
+                ts.tv_sec =  0;
+                ts.tv_nsec = TX_LINUX_TIMER_CATCH_UP_WAIT_NSEC;
+                nanosleep(&ts, NULL);
+            }
+
+            if (processed == TX_FALSE)
+            {
+                break;
+            }
+
+            /* Deliver the missed tick.  */
+            _tx_linux_timer_tick_deliver();
+            catch_up--;
+        }
+    } 
+#else
+
+    /* Ticks are generated on a fixed grid of CLOCK_MONOTONIC deadlines, starting
+       now.  */
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    tick_time = ((unsigned long long) ts.tv_sec) * 1000000000ULL + ((unsigned long long) ts.tv_nsec);
+    sleep_ticks = 1;
+
+    while(1)
+    {
+
+        /* Determine if there is anything that expires.  */
+        if (sleep_ticks)
+        {
+
+            /* Wait until the tick that has to be processed next, or until the
+               scheduler wakes us up.  */
+            current_time = tick_time + ((unsigned long long) sleep_ticks) * ((unsigned long long) timer_periodic_nsec);
+            ts.tv_sec =  (time_t) (current_time / 1000000000ULL);
+            ts.tv_nsec = (long) (current_time % 1000000000ULL);
+            do
+            {
+                if (sem_clockwait(&_tx_linux_timer_semaphore, CLOCK_MONOTONIC, &ts) == 0)
+                {
+                    break;
+                }
+                err = errno;
+            } while (err != ETIMEDOUT);
+        }
+        else
+        {
+
+            /* Nothing expires, wait until the scheduler wakes us up.  */
+            while (sem_wait(&_tx_linux_timer_semaphore) != 0)
+            {
+            }
+        }
+
+        /* The timer thread is awake again.  */
+        tx_linux_mutex_lock(_tx_linux_mutex);
+        _tx_linux_timer_tickless_sleep = TX_FALSE;
+        tx_linux_mutex_unlock(_tx_linux_mutex);
+
+        /* Calculate the number of ticks that have passed.  */
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        current_time = ((unsigned long long) ts.tv_sec) * 1000000000ULL + ((unsigned long long) ts.tv_nsec);
+        ticks = 0;
+        if (current_time > tick_time)
+        {
+            ticks = (ULONG) ((current_time - tick_time) / ((unsigned long long) timer_periodic_nsec));
+        }
+
+        /* Count the ticks that passed beyond the planned wakeup as overruns.  */
+        if ((sleep_ticks) && (ticks > sleep_ticks))
+        {
+            _tx_linux_timer_overrun_count += ticks - sleep_ticks;
+        }
+
+        /* Go back to one tick at a time, unless the system turns out to be idle.  */
+        sleep_ticks = 1;
+
+        /* Determine if a tick has passed.  If not, the scheduler has woken us
+           up early because a thread is ready.  */
+        if (ticks == 0)
+        {
+            continue;
+        }
+        tick_time += ((unsigned long long) ticks) * ((unsigned long long) timer_periodic_nsec);
+
+        /* Call ThreadX context save for interrupt preparation.  */
+        _tx_thread_context_save();
+
+        /* Call trace ISR enter event insert.  */
+        _tx_trace_isr_enter_insert(0);
+
+        /* Catch up on the ticks skipped while sleeping, all but the last.  */
+        if (ticks > 1)
+        {
+            tx_time_increment(ticks - 1);
+        }
+
+        /* Call the ThreadX system timer interrupt processing.  */
+        _tx_timer_interrupt();
+
+        /* Determine if the system is idle, which means no thread can activate
+           a timer or start a time-slice before we are woken up.  */
+        tx_linux_mutex_lock(_tx_linux_mutex);
+        idle = (_tx_thread_execute_ptr == TX_NULL) ? TX_TRUE : TX_FALSE;
+        tx_linux_mutex_unlock(_tx_linux_mutex);
+        if (idle)
+        {
+
+            /* Sleep until the next timer expiration, which is one tick after
+               the value returned by the low power utility.  */
+            sleep_ticks = 0;
+            if (tx_timer_get_next(&next_ticks))
+            {
+                sleep_ticks = next_ticks + 1;
+            }
+
+            /* Make sure the end of the time-slice is not skipped.  */
+            if ((_tx_timer_time_slice) && ((sleep_ticks == 0) || (_tx_timer_time_slice < sleep_ticks)))
+            {
+                sleep_ticks = _tx_timer_time_slice;
+            }
+
+            /* Check again with the sleep flag set, so the scheduler wakes us
+               up if a thread became ready in the meantime.  */
+            tx_linux_mutex_lock(_tx_linux_mutex);
+            if (_tx_thread_execute_ptr == TX_NULL)
+            {
+                _tx_linux_timer_tickless_sleep = TX_TRUE;
+            }
+            else
+            {
+                sleep_ticks = 1;
+            }
+            tx_linux_mutex_unlock(_tx_linux_mutex);
+        }
+
+        /* Call trace ISR exit event insert.  */
+        _tx_trace_isr_exit_insert(0);
+
+        /* Call ThreadX context restore for interrupt completion.  */
+        _tx_thread_context_restore();
+    }
+#endif /* TX_LINUX_TICKLESS_ENABLE */
+}
+
+
+#ifdef TX_LINUX_VIRTUAL_TIME_ENABLE
+
+/* Define the virtual time advance, which is called by the scheduler when no thread
+   is ready.  Instead of a periodic timer interrupt, the ThreadX time jumps to the
+   next timer expiration, which is processed as a timer interrupt.  TX_TRUE is
+   returned if the time was advanced, TX_FALSE if no timer is active.  */
+
+UINT    _tx_linux_virtual_time_advance(VOID)
+{
+
+ULONG   next_ticks;
+UINT    status;
+
+
+    /* Call ThreadX context save for interrupt preparation.  */
+    _tx_thread_context_save();
+
+    /* Only advance the time if no thread is ready and no other interrupt
+       is in progress.  */
+    status =  TX_FALSE;
+    if ((_tx_thread_execute_ptr == TX_NULL) && (_tx_thread_system_state == 1) &&
+        (tx_timer_get_next(&next_ticks)))
+    {
+
+        /* Call trace ISR enter event insert.  */
+        _tx_trace_isr_enter_insert(0);
+
+        /* Skip the ticks up to the next expiration, all but the last.  */
+        if (next_ticks)
+        {
+            tx_time_increment(next_ticks);
+        }
+
+        /* Call the ThreadX system timer interrupt processing for the expiration.  */
+        _tx_timer_interrupt();
+
+        /* Call trace ISR exit event insert.  */
+        _tx_trace_isr_exit_insert(0);
+
+        status =  TX_TRUE;
+    }
+
+    /* Call ThreadX context restore for interrupt completion.  */
+    _tx_thread_context_restore();
+
+    return(status);
+}
+#endif
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define the high-resolution timer interrupt.  It is triggered by the one-shot
+   timer, which is programmed by ThreadX for the next expiration.  */
+
+void    *_tx_linux_high_resolution_timer_interrupt(void *p)
+{
+uint64_t expirations;
+
+    (VOID)p;
+
+#ifndef TX_LINUX_REAL_TIME_ENABLE
+    nice(10);
+#endif
+
+    /* Wait startup semaphore. */
+    tx_linux_sem_wait(&_tx_linux_high_resolution_timer_semaphore);
+
+    while(1)
+    {
+
+        /* Wait for the one-shot timer to expire.  */
+        if (read(_tx_linux_high_resolution_timer_fd, &expirations, sizeof(expirations)) != sizeof(expirations))
+        {
+            continue;
+        }
+
+        /* Call ThreadX context save for interrupt preparation.  */
+        _tx_thread_context_save();
+
+        /* Call trace ISR enter event insert.  */
+        _tx_trace_isr_enter_insert(1);
+
+        /* Call the ThreadX high-resolution timer processing.  */
+        _tx_timer_high_resolution_expiration_process();
+
+        /* Call trace ISR exit event insert.  */
+        _tx_trace_isr_exit_insert(1);
+
+        /* Call ThreadX context restore for interrupt completion.  */
+        _tx_thread_context_restore();
+    }
+}
+
+
+/* Define the high-resolution time, which is CLOCK_MONOTONIC in nanoseconds.  */
+
+ULONG64 _tx_linux_high_resolution_time_get(VOID)
+{
+struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return(((ULONG64) ts.tv_sec) * ((ULONG64) 1000000000) + ((ULONG64) ts.tv_nsec));
+}
+
+
+/* Program the one-shot timer for an absolute expiration time, or stop it if
+   the expiration time is zero.  */
+
+VOID    _tx_linux_high_resolution_timer_set(ULONG64 expiration_time)
+{
+struct itimerspec its;
+
+    its.it_interval.tv_sec =   0;
+    its.it_interval.tv_nsec =  0;
+    its.it_value.tv_sec =      (time_t) (expiration_time / ((ULONG64) 1000000000));
+    its.it_value.tv_nsec =     (long) (expiration_time % ((ULONG64) 1000000000));
+    timerfd_settime(_tx_linux_high_resolution_timer_fd, TFD_TIMER_ABSTIME, &its, NULL);
+}
+#endif
+
+
+/* Register a file descriptor as a simulated interrupt source.  The ISR is called
+   with the file descriptor and the ready epoll events whenever the descriptor
+   becomes ready for the requested events.  Like a level triggered interrupt, the
+   ISR must clear the condition, e.g. by reading the data, unless EPOLLET is part
+   of the requested events.  */
+
+UINT    _tx_linux_interrupt_fd_register(int fd, ULONG events, ULONG isr_id, VOID (*isr)(int fd, ULONG events))
+{
+
+struct epoll_event  event;
+UINT                i;
+UINT                index;
+UINT                status;
+
+
+    /* Check for an invalid ISR pointer.  */
+    if (isr == TX_NULL)
+    {
+        return(TX_PTR_ERROR);
+    }
+
+    /* Lock Linux mutex.  */
+    tx_linux_mutex_lock(_tx_linux_mutex);
+
+    /* Find a free entry, making sure the file descriptor is not registered yet.  */
+    index =  TX_LINUX_INTERRUPT_FD_MAX;
+    status = TX_SUCCESS;
+    for (i = 0; i < TX_LINUX_INTERRUPT_FD_MAX; i++)
+    {
+        if (_tx_linux_interrupt_fd_table[i].tx_linux_interrupt_fd_isr == TX_NULL)
+        {
+            if (index == TX_LINUX_INTERRUPT_FD_MAX)
+            {
+                index =  i;
+            }
+        }
+        else if (_tx_linux_interrupt_fd_table[i].tx_linux_interrupt_fd == fd)
+        {
+            status =  TX_NOT_AVAILABLE;
+        }
+    }
+
+    /* Determine if the file descriptor can be added.  */
+    if ((status == TX_SUCCESS) && (index != TX_LINUX_INTERRUPT_FD_MAX))
+    {
+
+        /* Setup the entry before the file descriptor can trigger.  */
+        _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd =         fd;
+        _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_isr_id =  isr_id;
+        _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_isr =     isr;
+        _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_generation++;
+
+        /* Add the file descriptor to the epoll instance of the interrupt thread.  */
+        event.events =    (uint32_t) events;
+        event.data.u64 =  (((uint64_t) _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_generation) << 32) |
+                          ((uint64_t) index);
+        if (epoll_ctl(_tx_linux_interrupt_fd_epoll, EPOLL_CTL_ADD, fd, &event))
+        {
+
+            /* The file descriptor can not be waited on, clear the entry again.  */
+            _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_isr =  TX_NULL;
+            status =  TX_NOT_AVAILABLE;
+        }
+    }
+    else
+    {
+
+        /* The file descriptor is already registered or the table is full.  */
+        status =  TX_NOT_AVAILABLE;
+    }
+
+    /* Unlock Linux mutex.  */
+    tx_linux_mutex_unlock(_tx_linux_mutex);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/* Remove a file descriptor from the simulated interrupt sources.  An ISR that is
+   already running for the file descriptor is not waited for.  */
+
+UINT    _tx_linux_interrupt_fd_unregister(int fd)
+{
+
+UINT                i;
+UINT                status;
+
+
+    /* Lock Linux mutex.  */
+    tx_linux_mutex_lock(_tx_linux_mutex);
+
+    /* Find the entry of the file descriptor.  */
+    status =  TX_NOT_AVAILABLE;
+    for (i = 0; i < TX_LINUX_INTERRUPT_FD_MAX; i++)
+    {
+        if ((_tx_linux_interrupt_fd_table[i].tx_linux_interrupt_fd_isr != TX_NULL) &&
+            (_tx_linux_interrupt_fd_table[i].tx_linux_interrupt_fd == fd))
+        {
+
+            /* Remove the file descriptor and clear the entry.  */
+            epoll_ctl(_tx_linux_interrupt_fd_epoll, EPOLL_CTL_DEL, fd, NULL);
+            _tx_linux_interrupt_fd_table[i].tx_linux_interrupt_fd_isr =  TX_NULL;
+            status =  TX_SUCCESS;
+            break;
+        }
+    }
+
+    /* Unlock Linux mutex.  */
+    tx_linux_mutex_unlock(_tx_linux_mutex);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/* Define the file descriptor interrupt thread.  Each ready file descriptor is
+   processed as a separate interrupt.  */
+
+void    *_tx_linux_interrupt_fd_thread(void *p)
+{
+
+struct epoll_event  events[TX_LINUX_INTERRUPT_FD_MAX];
+int                 count;
+int                 i;
+UINT                index;
+UINT                generation;
+int                 fd;
+ULONG               isr_id;
+VOID                (*isr)(int fd, ULONG events);
+
+
+    (VOID)p;
+#ifndef TX_LINUX_REAL_TIME_ENABLE
+    nice(10);
+#endif
+
+    /* Wait startup semaphore. */
+    tx_linux_sem_wait(&_tx_linux_interrupt_fd_semaphore);
+
+    while(1)
+    {
+
+        /* Wait until registered file descriptors become ready.  */
+        count =  epoll_wait(_tx_linux_interrupt_fd_epoll, events, TX_LINUX_INTERRUPT_FD_MAX, -1);
+
+        for (i = 0; i < count; i++)
+        {
+
+            /* Pickup the entry of the file descriptor.  It may have been
+               unregistered, or registered again for another ISR, since the event
+               was returned, which the generation of the entry tells.  */
+            index =       (UINT) (events[i].data.u64 & 0xFFFFFFFFULL);
+            generation =  (UINT) (events[i].data.u64 >> 32);
+            tx_linux_mutex_lock(_tx_linux_mutex);
+            fd =      _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd;
+            isr_id =  _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_isr_id;
+            isr =     _tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_isr;
+            if (_tx_linux_interrupt_fd_table[index].tx_linux_interrupt_fd_generation != generation)
+            {
+                isr =  TX_NULL;
+            }
+            tx_linux_mutex_unlock(_tx_linux_mutex);
+            if (isr == TX_NULL)
+            {
+                continue;
+            }
+
+            /* Call ThreadX context save for interrupt preparation.  */
+            _tx_thread_context_save();
+
+            /* Call trace ISR enter event insert.  */
+            _tx_trace_isr_enter_insert(isr_id);
+
+            /* Call the ISR of the file descriptor.  */
+            (isr)(fd, (ULONG) events[i].events);
+
+            /* Call trace ISR exit event insert.  */
+            _tx_trace_isr_exit_insert(isr_id);
+
+            /* Call ThreadX context restore for interrupt completion.  */
+            _tx_thread_context_restore();
+        }
+    }
+}
+
+
+/* Define functions for linux thread. */
+void    _tx_linux_futex_post(int *futex_ptr)
+{
+
+    /* Mark the futex as posted and wake up the waiter, if there is one.  */
+    if (__atomic_exchange_n(futex_ptr, TX_LINUX_FUTEX_POSTED, __ATOMIC_SEQ_CST) == TX_LINUX_FUTEX_WAITING)
+    {
+        syscall(SYS_futex, futex_ptr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+void    _tx_linux_futex_wait(int *futex_ptr)
+{
+int value;
+
+    while(1)
+    {
+
+        /* Consume the post, if it is already there.  */
+        value =  TX_LINUX_FUTEX_POSTED;
+        if (__atomic_compare_exchange_n(futex_ptr, &value, TX_LINUX_FUTEX_EMPTY, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+
+        /* Otherwise, announce the waiter and sleep until the futex is posted.  */
+        if ((value == TX_LINUX_FUTEX_WAITING) ||
+            (__atomic_compare_exchange_n(futex_ptr, &value, TX_LINUX_FUTEX_WAITING, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)))
+        {
+            syscall(SYS_futex, futex_ptr, FUTEX_WAIT_PRIVATE, TX_LINUX_FUTEX_WAITING, NULL, NULL, 0);
+        }
+    }
+
+    /* The futex system call is not a cancellation point, unlike sem_wait.  Act on
+       a pending cancel from thread delete or reset here.  */
+    pthread_testcancel();
+}
+
+void    _tx_linux_thread_suspend_handler(int sig)
+{
+int saved_errno;
+
+    (VOID)sig;
+    saved_errno =  errno;
+
+    /* Acknowledge the suspension and wait until the scheduler or the interrupt
+       resumes this thread.  */
+    _tx_linux_futex_post(&_tx_linux_thread_suspend_futex);
+    _tx_linux_futex_wait(_tx_linux_thread_run_futex);
+
+    errno =  saved_errno;
+}
+
+void    _tx_linux_thread_suspend(pthread_t thread_id)
+{
+
+    /* Send signal. */
+    tx_linux_mutex_lock(_tx_linux_mutex);
+    pthread_kill(thread_id, SUSPEND_SIG);
+    tx_linux_mutex_unlock(_tx_linux_mutex);
+
+    /* Wait until signal is received. */
+    _tx_linux_futex_wait(&_tx_linux_thread_suspend_futex);
+}
+
+void    _tx_linux_thread_resume(TX_THREAD *thread_ptr)
+{
+
+    /* Post the run futex of the thread.  */
+    _tx_linux_futex_post(&thread_ptr -> tx_thread_linux_thread_run_futex);
+}
+
+void    _tx_linux_thread_init()
+{
+struct sigaction sa;
+
+    /* Clear the suspend acknowledge futex.  */
+    _tx_linux_thread_suspend_futex =  TX_LINUX_FUTEX_EMPTY;
+
+    sigfillset(&sa.sa_mask);
+    sa.sa_flags = 0;
+    sa.sa_handler = _tx_linux_thread_suspend_handler;
+    sigaction(SUSPEND_SIG, &sa, NULL);
+}
@@ -0,0 +1,659 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Linux Asynchronous File I/O                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_semaphore.h"
+#include "tx_linux_io.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+
+/* Determine if io_uring can be used.  The read and write operations and the
+   probe of supported operations need the headers of Linux 5.6 or newer.  */
+
+#if !defined(TX_LINUX_IO_URING_DISABLE) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#define TX_LINUX_IO_URING
+#endif
+#endif
+#endif
+
+
+/* Define the state of the asynchronous file I/O service.  The completion of
+   every operation is signalled on an eventfd, which is registered as a
+   simulated interrupt source.  */
+
+static UINT                 _tx_linux_io_initialized;
+static int                  _tx_linux_io_event_fd;
+static UINT                 _tx_linux_io_pending;
+
+#ifdef TX_LINUX_IO_URING
+
+/* Define the io_uring instance and its mapped rings.  There is a single
+   submitter at a time, which holds the Linux mutex, and a single completion
+   reader, which is the completion ISR.  */
+
+static UINT                 _tx_linux_io_uring_enabled;
+static int                  _tx_linux_io_uring_fd;
+static unsigned            *_tx_linux_io_uring_sq_tail;
+static unsigned            *_tx_linux_io_uring_sq_mask;
+static unsigned            *_tx_linux_io_uring_sq_array;
+static struct io_uring_sqe *_tx_linux_io_uring_sqes;
+static unsigned            *_tx_linux_io_uring_cq_head;
+static unsigned            *_tx_linux_io_uring_cq_tail;
+static unsigned            *_tx_linux_io_uring_cq_mask;
+static struct io_uring_cqe *_tx_linux_io_uring_cqes;
+
+static UINT _tx_linux_io_uring_setup(VOID);
+#endif
+
+/* Define the helper thread pool, which performs the operations with blocking
+   system calls if io_uring is not available.  Submitted requests are queued to
+   the helper threads, completed requests are queued to the completion ISR.  */
+
+static pthread_mutex_t      _tx_linux_io_pool_mutex =  PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t       _tx_linux_io_pool_condition =  PTHREAD_COND_INITIALIZER;
+static TX_LINUX_IO_REQUEST *_tx_linux_io_pool_submit_head;
+static TX_LINUX_IO_REQUEST *_tx_linux_io_pool_submit_tail;
+static TX_LINUX_IO_REQUEST *_tx_linux_io_pool_complete_head;
+static TX_LINUX_IO_REQUEST *_tx_linux_io_pool_complete_tail;
+static pthread_t            _tx_linux_io_pool_thread_id[TX_LINUX_IO_THREADS];
+
+static void *_tx_linux_io_pool_thread(void *p);
+static VOID _tx_linux_io_isr(int fd, ULONG events);
+static VOID _tx_linux_io_complete(TX_LINUX_IO_REQUEST *request_ptr, long result);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_io_initialize                             Linux/GNU       */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the asynchronous file I/O service.  It    */
+/*    sets up an io_uring instance if the host supports it, otherwise it  */
+/*    starts the helper threads, and registers the completion eventfd as  */
+/*    a simulated interrupt.  It is called from tx_application_define or  */
+/*    from a thread before the first request is submitted.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    eventfd                                                             */
+/*    _tx_linux_io_uring_setup                                            */
+/*    pthread_create                                                      */
+/*    pthread_setschedparam                                               */
+/*    _tx_linux_interrupt_fd_register                                     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT    _tx_linux_io_initialize(VOID)
+{
+
+struct sched_param  sp;
+UINT                i;
+
+
+    /* Determine if the service is already initialized.  */
+    if (_tx_linux_io_initialized)
+    {
+        return(TX_SUCCESS);
+    }
+
+    /* Create the completion eventfd.  */
+    _tx_linux_io_event_fd =  eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_tx_linux_io_event_fd < 0)
+    {
+        return(TX_NOT_AVAILABLE);
+    }
+
+#ifdef TX_LINUX_IO_URING
+
+    /* Try io_uring first.  */
+    _tx_linux_io_uring_enabled =  (_tx_linux_io_uring_setup() == TX_SUCCESS) ? TX_TRUE : TX_FALSE;
+    if (_tx_linux_io_uring_enabled == TX_FALSE)
+#endif
+    {
+
+        /* Start the helper threads.  Like a DMA engine, they run at the
+           priority of the simulated interrupts.  */
+        sp.sched_priority =  TX_LINUX_PRIORITY_ISR;
+        for (i = 0; i < TX_LINUX_IO_THREADS; i++)
+        {
+            if (pthread_create(&_tx_linux_io_pool_thread_id[i], NULL, _tx_linux_io_pool_thread, NULL))
+            {
+                return(TX_NOT_AVAILABLE);
+            }
+            pthread_setschedparam(_tx_linux_io_pool_thread_id[i], SCHED_FIFO, &sp);
+#ifdef TX_LINUX_REAL_TIME_ENABLE
+            _tx_linux_real_time_affinity_set(_tx_linux_io_pool_thread_id[i], _tx_linux_real_time_isr_cpu);
+#endif
+        }
+    }
+
+    /* Deliver the completions as simulated interrupts.  */
+    if (_tx_linux_interrupt_fd_register(_tx_linux_io_event_fd, EPOLLIN, TX_LINUX_IO_ISR_ID, _tx_linux_io_isr) != TX_SUCCESS)
+    {
+        return(TX_NOT_AVAILABLE);
+    }
+
+    _tx_linux_io_initialized =  TX_TRUE;
+
+    return(TX_SUCCESS);
+}
+
+
+/* Return TX_TRUE if the operations are performed by io_uring, or TX_FALSE if
+   they are performed by the helper threads.  */
+
+UINT    _tx_linux_io_uring_active(VOID)
+{
+
+#ifdef TX_LINUX_IO_URING
+    return(_tx_linux_io_uring_enabled);
+#else
+    return(TX_FALSE);
+#endif
+}
+
+
+/* Submit a file I/O request.  The request is completed by the completion ISR,
+   which calls the notify function of the request, if any, and wakes up the
+   thread that waits for the request with _tx_linux_io_wait.  Every submitted
+   request must be waited for before it is submitted again.  */
+
+UINT    _tx_linux_io_submit(TX_LINUX_IO_REQUEST *request_ptr)
+{
+
+UINT                    status;
+#ifdef TX_LINUX_IO_URING
+struct io_uring_sqe     *sqe;
+unsigned                tail;
+unsigned                index;
+#endif
+
+
+    /* Check the request.  */
+    if (request_ptr == TX_NULL)
+    {
+        return(TX_PTR_ERROR);
+    }
+    if (request_ptr -> tx_linux_io_request_operation > TX_LINUX_IO_FSYNC)
+    {
+        return(TX_OPTION_ERROR);
+    }
+    if (_tx_linux_io_initialized == TX_FALSE)
+    {
+        return(TX_NOT_AVAILABLE);
+    }
+
+    /* Create the semaphore the completion is signalled on.  */
+    status =  _tx_semaphore_create(&request_ptr -> tx_linux_io_request_semaphore, (CHAR *) "Linux I/O request", 0);
+    if (status != TX_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Lock Linux mutex, so the submitting thread is not preempted.  */
+    tx_linux_mutex_lock(_tx_linux_mutex);
+
+    /* Determine if another operation can be started.  */
+    if (_tx_linux_io_pending >= TX_LINUX_IO_QUEUE_DEPTH)
+    {
+        status =  TX_QUEUE_FULL;
+    }
+#ifdef TX_LINUX_IO_URING
+    else if (_tx_linux_io_uring_enabled)
+    {
+
+        /* Fill in the next submission queue entry.  */
+        tail =   *_tx_linux_io_uring_sq_tail;
+        index =  tail & *_tx_linux_io_uring_sq_mask;
+        sqe =    &_tx_linux_io_uring_sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe -> fd =         request_ptr -> tx_linux_io_request_fd;
+        sqe -> user_data =  (__u64) (ALIGN_TYPE) request_ptr;
+        if (request_ptr -> tx_linux_io_request_operation == TX_LINUX_IO_FSYNC)
+        {
+            sqe -> opcode =  IORING_OP_FSYNC;
+        }
+        else
+        {
+            sqe -> opcode =  (request_ptr -> tx_linux_io_request_operation == TX_LINUX_IO_READ) ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe -> addr =    (__u64) (ALIGN_TYPE) request_ptr -> tx_linux_io_request_buffer;
+            sqe -> len =     (__u32) request_ptr -> tx_linux_io_request_size;
+            sqe -> off =     (__u64) request_ptr -> tx_linux_io_request_offset;
+        }
+        _tx_linux_io_uring_sq_array[index] =  index;
+
+        /* Publish the entry and submit it.  */
+        __atomic_store_n(_tx_linux_io_uring_sq_tail, tail + 1, __ATOMIC_RELEASE);
+        if (syscall(__NR_io_uring_enter, _tx_linux_io_uring_fd, 1, 0, 0, NULL, 0) != 1)
+        {
+
+            /* The entry was not consumed, take it back.  */
+            __atomic_store_n(_tx_linux_io_uring_sq_tail, tail, __ATOMIC_RELEASE);
+            status =  TX_NOT_AVAILABLE;
+        }
+    }
+#endif
+    else
+    {
+
+        /* Queue the request to the helper threads.  */
+        request_ptr -> tx_linux_io_request_next =  TX_NULL;
+        pthread_mutex_lock(&_tx_linux_io_pool_mutex);
+        if (_tx_linux_io_pool_submit_tail == TX_NULL)
+        {
+            _tx_linux_io_pool_submit_head =  request_ptr;
+        }
+        else
+        {
+            _tx_linux_io_pool_submit_tail -> tx_linux_io_request_next =  request_ptr;
+        }
+        _tx_linux_io_pool_submit_tail =  request_ptr;
+        pthread_cond_signal(&_tx_linux_io_pool_condition);
+        pthread_mutex_unlock(&_tx_linux_io_pool_mutex);
+    }
+
+    if (status == TX_SUCCESS)
+    {
+        _tx_linux_io_pending++;
+    }
+
+    /* Unlock Linux mutex.  */
+    tx_linux_mutex_unlock(_tx_linux_mutex);
+
+    /* Delete the semaphore again if the request was not submitted.  */
+    if (status != TX_SUCCESS)
+    {
+        _tx_semaphore_delete(&request_ptr -> tx_linux_io_request_semaphore);
+    }
+
+    return(status);
+}
+
+
+/* Wait for the completion of a submitted request.  When TX_SUCCESS is returned,
+   the result of the request is valid and the request may be reused.  */
+
+UINT    _tx_linux_io_wait(TX_LINUX_IO_REQUEST *request_ptr, ULONG wait_option)
+{
+
+UINT        status;
+
+
+    status =  _tx_semaphore_get(&request_ptr -> tx_linux_io_request_semaphore, wait_option);
+    if (status == TX_SUCCESS)
+    {
+        _tx_semaphore_delete(&request_ptr -> tx_linux_io_request_semaphore);
+    }
+
+    return(status);
+}
+
+
+/* Read from or write to a file at an offset, like pread and pwrite, but only the
+   calling ThreadX thread is suspended until the operation completes.  The
+   number of bytes transferred is returned, or the negative errno value.  */
+
+static long _tx_linux_io_transfer(int fd, UINT operation, VOID *buffer, ULONG size, ULONG64 offset)
+{
+
+TX_LINUX_IO_REQUEST     request;
+UINT                    status;
+
+
+    /* The caller has to be a thread.  */
+    if ((TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0)) || (_tx_thread_identify() == TX_NULL))
+    {
+        return(-EPERM);
+    }
+
+    request.tx_linux_io_request_fd =         fd;
+    request.tx_linux_io_request_operation =  operation;
+    request.tx_linux_io_request_buffer =     buffer;
+    request.tx_linux_io_request_size =       size;
+    request.tx_linux_io_request_offset =     offset;
+    request.tx_linux_io_request_notify =     TX_NULL;
+    status =  _tx_linux_io_submit(&request);
+    if (status != TX_SUCCESS)
+    {
+        return((status == TX_QUEUE_FULL) ? -EAGAIN : -ENXIO);
+    }
+
+    /* The request is on the stack, so it has to be waited for even if the
+       wait is aborted.  */
+    do
+    {
+        status =  _tx_linux_io_wait(&request, TX_WAIT_FOREVER);
+    } while (status != TX_SUCCESS);
+
+    return(request.tx_linux_io_request_result);
+}
+
+
+long    _tx_linux_io_read(int fd, VOID *buffer, ULONG size, ULONG64 offset)
+{
+
+    return(_tx_linux_io_transfer(fd, TX_LINUX_IO_READ, buffer, size, offset));
+}
+
+
+long    _tx_linux_io_write(int fd, VOID *buffer, ULONG size, ULONG64 offset)
+{
+
+    return(_tx_linux_io_transfer(fd, TX_LINUX_IO_WRITE, buffer, size, offset));
+}
+
+
+/* Define the completion ISR, which is called by the file descriptor interrupt
+   thread when the completion eventfd is signalled.  */
+
+static VOID _tx_linux_io_isr(int fd, ULONG events)
+{
+
+uint64_t                value;
+TX_LINUX_IO_REQUEST     *request_ptr;
+TX_LINUX_IO_REQUEST     *next_ptr;
+#ifdef TX_LINUX_IO_URING
+struct io_uring_cqe     *cqe;
+unsigned                head;
+unsigned                tail;
+#endif
+
+    (VOID) events;
+
+    /* Clear the eventfd before the completions are collected, so no completion
+       is missed.  */
+    if (read(fd, &value, sizeof(value)) != sizeof(value))
+    {
+        value =  0;
+    }
+
+#ifdef TX_LINUX_IO_URING
+    if (_tx_linux_io_uring_enabled)
+    {
+
+        /* Collect the entries of the completion queue.  */
+        head =  *_tx_linux_io_uring_cq_head;
+        tail =  __atomic_load_n(_tx_linux_io_uring_cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            cqe =  &_tx_linux_io_uring_cqes[head & *_tx_linux_io_uring_cq_mask];
+            request_ptr =  (TX_LINUX_IO_REQUEST *) (ALIGN_TYPE) cqe -> user_data;
+            _tx_linux_io_complete(request_ptr, (long) cqe -> res);
+            head++;
+        }
+        __atomic_store_n(_tx_linux_io_uring_cq_head, head, __ATOMIC_RELEASE);
+        return;
+    }
+#endif
+
+    /* Collect the requests completed by the helper threads.  */
+    pthread_mutex_lock(&_tx_linux_io_pool_mutex);
+    request_ptr =  _tx_linux_io_pool_complete_head;
+    _tx_linux_io_pool_complete_head =  TX_NULL;
+    _tx_linux_io_pool_complete_tail =  TX_NULL;
+    pthread_mutex_unlock(&_tx_linux_io_pool_mutex);
+
+    while (request_ptr != TX_NULL)
+    {
+        next_ptr =  request_ptr -> tx_linux_io_request_next;
+        _tx_linux_io_complete(request_ptr, request_ptr -> tx_linux_io_request_result);
+        request_ptr =  next_ptr;
+    }
+}
+
+
+/* Complete a request from the completion ISR.  */
+
+static VOID _tx_linux_io_complete(TX_LINUX_IO_REQUEST *request_ptr, long result)
+{
+
+    tx_linux_mutex_lock(_tx_linux_mutex);
+    _tx_linux_io_pending--;
+    tx_linux_mutex_unlock(_tx_linux_mutex);
+
+    request_ptr -> tx_linux_io_request_result =  result;
+    if (request_ptr -> tx_linux_io_request_notify != TX_NULL)
+    {
+        (request_ptr -> tx_linux_io_request_notify)(request_ptr);
+    }
+    _tx_semaphore_put(&request_ptr -> tx_linux_io_request_semaphore);
+}
+
+
+/* Define the helper threads, which perform the queued operations with blocking
+   system calls and signal their completion on the eventfd.  */
+
+static void *_tx_linux_io_pool_thread(void *p)
+{
+
+TX_LINUX_IO_REQUEST     *request_ptr;
+long                    result;
+uint64_t                value =  1;
+
+    (VOID) p;
+
+    while(1)
+    {
+
+        /* Wait for the next request.  */
+        pthread_mutex_lock(&_tx_linux_io_pool_mutex);
+        while (_tx_linux_io_pool_submit_head == TX_NULL)
+        {
+            pthread_cond_wait(&_tx_linux_io_pool_condition, &_tx_linux_io_pool_mutex);
+        }
+        request_ptr =  _tx_linux_io_pool_submit_head;
+        _tx_linux_io_pool_submit_head =  request_ptr -> tx_linux_io_request_next;
+        if (_tx_linux_io_pool_submit_head == TX_NULL)
+        {
+            _tx_linux_io_pool_submit_tail =  TX_NULL;
+        }
+        pthread_mutex_unlock(&_tx_linux_io_pool_mutex);
+
+        /* Perform the operation.  */
+        switch (request_ptr -> tx_linux_io_request_operation)
+        {
+        case TX_LINUX_IO_READ:
+            if (request_ptr -> tx_linux_io_request_offset == TX_LINUX_IO_OFFSET_CURRENT)
+            {
+                result =  (long) read(request_ptr -> tx_linux_io_request_fd, request_ptr -> tx_linux_io_request_buffer,
+                                      (size_t) request_ptr -> tx_linux_io_request_size);
+            }
+            else
+            {
+                result =  (long) pread(request_ptr -> tx_linux_io_request_fd, request_ptr -> tx_linux_io_request_buffer,
+                                       (size_t) request_ptr -> tx_linux_io_request_size, (off_t) request_ptr -> tx_linux_io_request_offset);
+            }
+            break;
+        case TX_LINUX_IO_WRITE:
+            if (request_ptr -> tx_linux_io_request_offset == TX_LINUX_IO_OFFSET_CURRENT)
+            {
+                result =  (long) write(request_ptr -> tx_linux_io_request_fd, request_ptr -> tx_linux_io_request_buffer,
+                                       (size_t) request_ptr -> tx_linux_io_request_size);
+            }
+            else
+            {
+                result =  (long) pwrite(request_ptr -> tx_linux_io_request_fd, request_ptr -> tx_linux_io_request_buffer,
+                                        (size_t) request_ptr -> tx_linux_io_request_size, (off_t) request_ptr -> tx_linux_io_request_offset);
+            }
+            break;
+        default:
+            result =  (long) fsync(request_ptr -> tx_linux_io_request_fd);
+            break;
+        }
+        request_ptr -> tx_linux_io_request_result =  (result < 0) ? -((long) errno) : result;
+
+        /* Queue the request to the completion ISR.  */
+        request_ptr -> tx_linux_io_request_next =  TX_NULL;
+        pthread_mutex_lock(&_tx_linux_io_pool_mutex);
+        if (_tx_linux_io_pool_complete_tail == TX_NULL)
+        {
+            _tx_linux_io_pool_complete_head =  request_ptr;
+        }
+        else
+        {
+            _tx_linux_io_pool_complete_tail -> tx_linux_io_request_next =  request_ptr;
+        }
+        _tx_linux_io_pool_complete_tail =  request_ptr;
+        pthread_mutex_unlock(&_tx_linux_io_pool_mutex);
+
+        /* Trigger the completion interrupt.  */
+        if (write(_tx_linux_io_event_fd, &value, sizeof(value)) != sizeof(value))
+        {
+        }
+    }
+
+    return(NULL);
+}
+
+
+#ifdef TX_LINUX_IO_URING
+
+/* Setup the io_uring instance, map its rings and register the completion
+   eventfd.  TX_NOT_AVAILABLE is returned if the host does not support io_uring
+   or the read and write operations, e.g. if it is blocked in a container.  */
+
+static UINT _tx_linux_io_uring_setup(VOID)
+{
+
+struct io_uring_params  params;
+struct io_uring_probe   *probe;
+size_t                  probe_size;
+size_t                  sq_size;
+size_t                  cq_size;
+char                    *sq_ring;
+char                    *cq_ring;
+UINT                    supported;
+int                     fd;
+
+
+    memset(&params, 0, sizeof(params));
+    fd =  (int) syscall(__NR_io_uring_setup, TX_LINUX_IO_QUEUE_DEPTH, &params);
+    if (fd < 0)
+    {
+        return(TX_NOT_AVAILABLE);
+    }
+
+    /* Determine if the read, write and fsync operations are supported.  */
+    probe_size =  sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    probe =  (struct io_uring_probe *) calloc(1, probe_size);
+    supported =  TX_FALSE;
+    if ((probe != NULL) && (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) == 0) &&
+        (probe -> last_op >= IORING_OP_WRITE) &&
+        (probe -> ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+        (probe -> ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED) &&
+        (probe -> ops[IORING_OP_FSYNC].flags & IO_URING_OP_SUPPORTED))
+    {
+        supported =  TX_TRUE;
+    }
+    free(probe);
+    if ((supported == TX_FALSE) || ((params.features & IORING_FEAT_SINGLE_MMAP) == 0))
+    {
+        close(fd);
+        return(TX_NOT_AVAILABLE);
+    }
+
+    /* Map the submission and completion rings, which share one mapping, and the
+       submission queue entries.  */
+    sq_size =  params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size =  params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (cq_size > sq_size)
+    {
+        sq_size =  cq_size;
+    }
+    sq_ring =  (char *) mmap(NULL, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED)
+    {
+        close(fd);
+        return(TX_NOT_AVAILABLE);
+    }
+    cq_ring =  sq_ring;
+    _tx_linux_io_uring_sqes =  (struct io_uring_sqe *) mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe),
+                                                           PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (_tx_linux_io_uring_sqes == MAP_FAILED)
+    {
+        munmap(sq_ring, sq_size);
+        close(fd);
+        return(TX_NOT_AVAILABLE);
+    }
+
+    _tx_linux_io_uring_sq_tail =   (unsigned *) (sq_ring + params.sq_off.tail);
+    _tx_linux_io_uring_sq_mask =   (unsigned *) (sq_ring + params.sq_off.ring_mask);
+    _tx_linux_io_uring_sq_array =  (unsigned *) (sq_ring + params.sq_off.array);
+    _tx_linux_io_uring_cq_head =   (unsigned *) (cq_ring + params.cq_off.head);
+    _tx_linux_io_uring_cq_tail =   (unsigned *) (cq_ring + params.cq_off.tail);
+    _tx_linux_io_uring_cq_mask =   (unsigned *) (cq_ring + params.cq_off.ring_mask);
+    _tx_linux_io_uring_cqes =      (struct io_uring_cqe *) (cq_ring + params.cq_off.cqes);
+
+    /* Signal every completion on the eventfd.  */
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_EVENTFD, &_tx_linux_io_event_fd, 1) != 0)
+    {
+        munmap(_tx_linux_io_uring_sqes, params.sq_entries * sizeof(struct io_uring_sqe));
+        munmap(sq_ring, sq_size);
+        close(fd);
+        return(TX_NOT_AVAILABLE);
+    }
+
+    _tx_linux_io_uring_fd =  fd;
+
+    return(TX_SUCCESS);
+}
+#endif
@@ -30,7 +30,8 @@
 #include "tx_thread.h"
 #include "tx_timer.h"
 
-extern sem_t _tx_linux_isr_semaphore;
+extern int _tx_linux_isr_futex;
+extern int _tx_linux_idle_futex;
 UINT _tx_linux_timer_waiting = 0;
 /**************************************************************************/ 
 /*                                                                        */ 
@@ -61,9 +62,8 @@ UINT _tx_linux_timer_waiting = 0;
 /*                                                                        */ 
 /*    _tx_linux_debug_entry_insert                                        */ 
 /*    tx_linux_mutex_lock                                                 */ 
-/*    sem_trywait                                                         */
-/*    tx_linux_sem_post                                                   */ 
-/*    tx_linux_sem_wait                                                   */ 
+/*    _tx_linux_futex_post                                                */ 
+/*    _tx_linux_futex_wait                                                */ 
 /*    _tx_linux_thread_resume                                             */ 
 /*    tx_linux_mutex_recursive_unlock                                     */ 
 /*                                                                        */ 
@@ -119,14 +119,11 @@ VOID   _tx_thread_context_restore(VOID)
             /* Clear the current thread pointer.  */
             _tx_thread_current_ptr =  TX_NULL;
 
-            /* Make sure semaphore is 0. */
-            while(!sem_trywait(&_tx_linux_semaphore));
-
             /* Indicate it is in timer ISR. */
             _tx_linux_timer_waiting = 1;
 
-            /* Wakeup the system thread by setting the system semaphore.  */
-            tx_linux_sem_post(&_tx_linux_semaphore);
+            /* Wakeup the system thread by posting the scheduler futex.  */
+            _tx_linux_futex_post(&_tx_linux_scheduler_futex);
 
             if(_tx_thread_execute_ptr)
             {
@@ -137,12 +134,9 @@ VOID   _tx_thread_context_restore(VOID)
                     tx_linux_mutex_recursive_unlock(_tx_linux_mutex);
 
                     /* Wait until TX_THREAD start running. */
-                    tx_linux_sem_wait(&_tx_linux_isr_semaphore);
+                    _tx_linux_futex_wait(&_tx_linux_isr_futex);
 
                     tx_linux_mutex_lock(_tx_linux_mutex);
-
-                    /* Make sure semaphore is 0. */
-                    while(!sem_trywait(&_tx_linux_isr_semaphore));
                 }
             }
 
@@ -153,9 +147,16 @@ VOID   _tx_thread_context_restore(VOID)
         {
 
             /* Since preemption is not required, resume the interrupted thread.  */
-            _tx_linux_thread_resume(_tx_thread_current_ptr -> tx_thread_linux_thread_id);
+            _tx_linux_thread_resume(_tx_thread_current_ptr);
         }
     }
+    else if ((!_tx_thread_system_state) && (_tx_thread_execute_ptr))
+    {
+
+        /* No thread was running and the interrupt made a thread ready.  Wake up
+           the scheduler, which is waiting on the idle futex.  */
+        _tx_linux_futex_post(&_tx_linux_idle_futex);
+    }
 
     /* Unlock linux mutex. */
     tx_linux_mutex_recursive_unlock(_tx_linux_mutex);
@@ -33,9 +33,12 @@
 #include <errno.h>
 
 extern sem_t _tx_linux_timer_semaphore;
-extern sem_t _tx_linux_isr_semaphore;
+extern int _tx_linux_isr_futex;
+extern int _tx_linux_idle_futex;
 extern UINT _tx_linux_timer_waiting;
-extern pthread_t _tx_linux_timer_id;
+#ifdef TX_LINUX_TICKLESS_ENABLE
+extern UINT _tx_linux_timer_tickless_sleep;
+#endif
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -50,7 +53,9 @@ extern pthread_t _tx_linux_timer_id;
 /*                                                                        */
 /*    This function waits for a thread control block pointer to appear in */
 /*    the _tx_thread_execute_ptr variable.  Once a thread pointer appears */
-/*    in the variable, the corresponding thread is resumed.               */
+/*    in the variable, the corresponding thread is resumed.  While no     */
+/*    thread is ready, the scheduler sleeps on the idle futex, which is   */
+/*    posted by the simulated interrupts.                                 */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -66,9 +71,9 @@ extern pthread_t _tx_linux_timer_id;
 /*    tx_linux_mutex_unlock                                               */
 /*    _tx_linux_debug_entry_insert                                        */
 /*    _tx_linux_thread_resume                                             */
-/*    tx_linux_sem_post                                                   */
-/*    sem_trywait                                                         */
-/*    tx_linux_sem_wait                                                   */
+/*    tx_linux_sem_post_nolock                                            */
+/*    _tx_linux_futex_wait                                                */
+/*    _tx_linux_futex_post                                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -83,11 +88,6 @@ extern pthread_t _tx_linux_timer_id;
 /**************************************************************************/
 VOID   _tx_thread_schedule(VOID)
 {
-struct timespec ts;
-
-    /* Set timer. */
-    ts.tv_sec = 0;
-    ts.tv_nsec = 200000;
 
     /* Loop forever.  */
     while(1)
@@ -114,29 +114,41 @@ struct timespec ts;
                 /* Unlock linux mutex. */
                 tx_linux_mutex_unlock(_tx_linux_mutex);
 
-                /* Don't waste all the processor time here in the master thread...  */
-#ifdef TX_LINUX_NO_IDLE_ENABLE
-                while(!sem_trywait(&_tx_linux_timer_semaphore));
-                tx_linux_sem_post(&_tx_linux_timer_semaphore);
-                /*nanosleep(&ts, &ts);*/
+                /* Debug entry.  */
+                _tx_linux_debug_entry_insert("SCHEDULE-idle", __FILE__, __LINE__);
+
+#ifdef TX_LINUX_VIRTUAL_TIME_ENABLE
 
-                clock_gettime(CLOCK_REALTIME, &ts);
-                ts.tv_nsec += 200000;
-                if (ts.tv_nsec > 1000000000)
+                /* Advance the virtual time to the next timer expiration instead of
+                   sleeping, unless no timer is active.  */
+                if (_tx_linux_virtual_time_advance())
                 {
-                    ts.tv_nsec -= 1000000000;
-                    ts.tv_sec++;
+                    continue;
                 }
-                sem_timedwait(&_tx_linux_semaphore_no_idle, &ts);
-#else                
-                nanosleep(&ts, &ts);
-#endif /* TX_LINUX_NO_IDLE_ENABLE */                
+#endif
+
+                /* Sleep until an interrupt makes a thread ready.  The idle futex
+                   is posted by _tx_thread_context_restore, so a post that comes
+                   in after the check above is not lost.  */
+                _tx_linux_futex_wait(&_tx_linux_idle_futex);
             }
         }
 
         /* Yes! We have a thread to execute. Note that the critical section is already
            active from the scheduling loop above.  */
 
+#ifdef TX_LINUX_TICKLESS_ENABLE
+
+        /* Determine if the timer interrupt thread sleeps beyond the next tick.  */
+        if (_tx_linux_timer_tickless_sleep)
+        {
+
+            /* Yes, wake it up so the thread is given its ticks again.  */
+            _tx_linux_timer_tickless_sleep = TX_FALSE;
+            tx_linux_sem_post_nolock(&_tx_linux_timer_semaphore);
+        }
+#endif
+
         /* Setup the current thread pointer.  */
         _tx_thread_current_ptr =  _tx_thread_execute_ptr;
 
@@ -153,53 +165,38 @@ struct timespec ts;
             /* Debug entry.  */
             _tx_linux_debug_entry_insert("SCHEDULE-resume_thread", __FILE__, __LINE__);
 
-            /* Pseudo interrupt suspension.  The thread is not waiting on
-               its run semaphore.  */
-            _tx_linux_thread_resume(_tx_thread_current_ptr -> tx_thread_linux_thread_id);
+            /* Pseudo interrupt suspension.  The thread is waiting on its run
+               futex inside the suspend signal handler.  */
+            _tx_linux_thread_resume(_tx_thread_current_ptr);
         }
         else
         {
 
             /* Debug entry.  */
-            _tx_linux_debug_entry_insert("SCHEDULE-release_sem", __FILE__, __LINE__);
-
-            /* Make sure semaphore is 0. */
-            while(!sem_trywait(&_tx_thread_current_ptr -> tx_thread_linux_thread_run_semaphore));
-
-            /* Let the thread run again by releasing its run semaphore.  */
-            tx_linux_sem_post(&_tx_thread_current_ptr -> tx_thread_linux_thread_run_semaphore);
+            _tx_linux_debug_entry_insert("SCHEDULE-release_futex", __FILE__, __LINE__);
 
-            /* Block timer ISR. */
-            if(_tx_linux_timer_waiting)
-            {
-
-                /* It is woken up by timer ISR. */
-                /* Let ThreadX thread wake up first. */
-                tx_linux_sem_wait(&_tx_linux_semaphore);
-
-                /* Wake up timer ISR. */
-                tx_linux_sem_post_nolock(&_tx_linux_isr_semaphore);
-            }
-            else
-            {
+            /* Let the thread run again by posting its run futex, and wait
+               until it has picked up the handoff.  */
+            _tx_linux_thread_resume(_tx_thread_current_ptr);
+            _tx_linux_futex_wait(&_tx_linux_scheduler_futex);
+        }
 
-                /* It is woken up by TX_THREAD. */
-                /* Suspend timer thread and let ThreadX thread wake up first. */
-                _tx_linux_thread_suspend(_tx_linux_timer_id);
-                tx_linux_sem_wait(&_tx_linux_semaphore);
-                _tx_linux_thread_resume(_tx_linux_timer_id);
+        /* Determine if the timer ISR waits for the thread to start running.  */
+        if (_tx_linux_timer_waiting)
+        {
 
-            }
+            /* Wake up timer ISR. */
+            _tx_linux_futex_post(&_tx_linux_isr_futex);
         }
 
         /* Unlock linux mutex. */
         tx_linux_mutex_unlock(_tx_linux_mutex);
 
         /* Debug entry.  */
-        _tx_linux_debug_entry_insert("SCHEDULE-self_suspend_sem", __FILE__, __LINE__);
+        _tx_linux_debug_entry_insert("SCHEDULE-self_suspend_futex", __FILE__, __LINE__);
 
         /* Now suspend the main thread so the application thread can run.  */
-        tx_linux_sem_wait(&_tx_linux_semaphore);
+        _tx_linux_futex_wait(&_tx_linux_scheduler_futex);
 
         /* Debug entry.  */
         _tx_linux_debug_entry_insert("SCHEDULE-wake_up", __FILE__, __LINE__);
@@ -210,12 +207,10 @@ struct timespec ts;
 void _tx_thread_delete_port_completion(TX_THREAD *thread_ptr, UINT tx_saved_posture)
 {
 INT             linux_status;
-sem_t           *threadrunsemaphore;
 pthread_t       thread_id;
 struct          timespec ts;
 
     thread_id = thread_ptr -> tx_thread_linux_thread_id;
-    threadrunsemaphore = &(thread_ptr -> tx_thread_linux_thread_run_semaphore);
     ts.tv_sec = 0;
     ts.tv_nsec = 1000000;
     TX_RESTORE
@@ -226,24 +221,22 @@ struct          timespec ts;
         {
             break;
         }
-        _tx_linux_thread_resume(thread_id);
-        tx_linux_sem_post(threadrunsemaphore);
         nanosleep(&ts, &ts);
     } while (1);
+
+    /* Wake up the thread so it acts on the cancel request.  */
+    _tx_linux_thread_resume(thread_ptr);
     pthread_join(thread_id, NULL);
-    sem_destroy(threadrunsemaphore);
     TX_DISABLE
 }
 
 void _tx_thread_reset_port_completion(TX_THREAD *thread_ptr, UINT tx_saved_posture)
 {
 INT             linux_status;
-sem_t           *threadrunsemaphore;
 pthread_t       thread_id;
 struct          timespec ts;
 
     thread_id = thread_ptr -> tx_thread_linux_thread_id;
-    threadrunsemaphore = &(thread_ptr -> tx_thread_linux_thread_run_semaphore);
     ts.tv_sec = 0;
     ts.tv_nsec = 1000000;
     TX_RESTORE
@@ -254,11 +247,11 @@ struct          timespec ts;
         {
             break;
         }
-        _tx_linux_thread_resume(thread_id);
-        tx_linux_sem_post(threadrunsemaphore);
         nanosleep(&ts, &ts);
     } while (1);
+
+    /* Wake up the thread so it acts on the cancel request.  */
+    _tx_linux_thread_resume(thread_ptr);
     pthread_join(thread_id, NULL);
-    sem_destroy(threadrunsemaphore);
     TX_DISABLE
 }
@@ -66,10 +66,9 @@ void *_tx_linux_thread_entry(void *ptr);
 /*                                                                        */ 
 /*    pthread_create                                                      */ 
 /*    pthread_setschedparam                                               */ 
-/*    _tx_linux_thread_suspend                                            */ 
-/*    sem_init                                                            */ 
 /*    printf                                                              */ 
-/*    _tx_linux_thread_resume                                             */ 
+/*    _tx_linux_futex_wait                                                */ 
+/*    _tx_linux_futex_post                                                */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -89,17 +88,9 @@ struct sched_param sp;
 
     (VOID)function_ptr;
 
-    /* Create the run semaphore for the thread.  This will allow the scheduler
+    /* Clear the run futex for the thread.  This will allow the scheduler
        control over when the thread actually runs.  */
-    if(sem_init(&thread_ptr -> tx_thread_linux_thread_run_semaphore, 0, 0))
-    {
-
-        /* Display an error message.  */
-        printf("ThreadX Linux error creating thread running semaphore!\n");
-        while(1)
-        {
-        }
-    }
+    thread_ptr -> tx_thread_linux_thread_run_futex =  TX_LINUX_FUTEX_EMPTY;
 
     /* Create a Linux thread for the application thread.  */
     if(pthread_create(&thread_ptr -> tx_thread_linux_thread_id, NULL, _tx_linux_thread_entry, thread_ptr))
@@ -140,12 +131,13 @@ TX_THREAD  *thread_ptr;
     /* Pickup the current thread pointer.  */
     thread_ptr =  (TX_THREAD *) ptr;
     _tx_linux_threadx_thread = 1;
+    _tx_linux_thread_run_futex = &thread_ptr -> tx_thread_linux_thread_run_futex;
     nice(20);
 
     /* Now suspend the thread initially.  If the thread has already
        been scheduled, this will return immediately.  */
-    tx_linux_sem_wait(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
-    tx_linux_sem_post_nolock(&_tx_linux_semaphore);
+    _tx_linux_futex_wait(_tx_linux_thread_run_futex);
+    _tx_linux_futex_post(&_tx_linux_scheduler_futex);
 
     /* Call ThreadX thread entry point.  */
     _tx_thread_shell_entry();
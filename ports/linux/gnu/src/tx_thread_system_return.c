@@ -66,9 +66,8 @@
 /*    tx_linux_mutex_recursive_unlock                                     */ 
 /*    tx_linux_mutex_unlock                                               */ 
 /*    pthread_exit                                                        */ 
-/*    tx_linux_sem_post                                                   */ 
-/*    sem_trywait                                                         */
-/*    tx_linux_sem_wait                                                   */ 
+/*    _tx_linux_futex_post                                                */ 
+/*    _tx_linux_futex_wait                                                */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -85,7 +84,7 @@ VOID   _tx_thread_system_return(VOID)
 {
 
 TX_THREAD   *temp_thread_ptr;
-sem_t       *temp_run_semaphore;
+int         *temp_run_futex;
 UINT        temp_thread_state;
 pthread_t   thread_id;
 int         exit_code = 0;
@@ -127,8 +126,8 @@ int         exit_code = 0;
         _tx_timer_time_slice =  0;
     }
 
-    /* Save the run semaphore into a temporary variable as well.  */
-    temp_run_semaphore =  &temp_thread_ptr -> tx_thread_linux_thread_run_semaphore;
+    /* Save the run futex into a temporary variable as well.  */
+    temp_run_futex =  &temp_thread_ptr -> tx_thread_linux_thread_run_futex;
 
     /* Pickup the current thread state.  */
     temp_thread_state =  temp_thread_ptr -> tx_thread_state;
@@ -143,28 +142,26 @@ int         exit_code = 0;
     tx_linux_mutex_recursive_unlock(_tx_linux_mutex);
 
     /* Debug entry.  */
-    _tx_linux_debug_entry_insert("SYSTEM_RETURN-release_sem", __FILE__, __LINE__);
+    _tx_linux_debug_entry_insert("SYSTEM_RETURN-release_futex", __FILE__, __LINE__);
 
-    /* Make sure semaphore is 0. */
-    while(!sem_trywait(&_tx_linux_semaphore));
-
-    /* Release the semaphore that the main scheduling thread is waiting
+    /* Post the futex that the main scheduling thread is waiting
        on.  Note that the main scheduling algorithm will take care of
        setting the current thread pointer to NULL.  */
-    tx_linux_sem_post(&_tx_linux_semaphore);
+    _tx_linux_futex_post(&_tx_linux_scheduler_futex);
 
     /* Determine if the thread was self-terminating.  */
     if (temp_thread_state ==  TX_TERMINATED)
     {
 
-        /* Exit the thread instead of waiting on the semaphore!  */
+        /* Exit the thread instead of waiting on the futex!  */
         pthread_exit((void *)&exit_code);
     }
 
-    /* Wait on the run semaphore for this thread.  This won't get set again
-       until the thread is scheduled.  */
-    tx_linux_sem_wait(temp_run_semaphore);
-    tx_linux_sem_post_nolock(&_tx_linux_semaphore);
+    /* Wait on the run futex for this thread.  This won't get set again
+       until the thread is scheduled.  Then acknowledge the handoff to the
+       scheduler.  */
+    _tx_linux_futex_wait(temp_run_futex);
+    _tx_linux_futex_post(&_tx_linux_scheduler_futex);
 
     /* Lock Linux mutex.  */
     tx_linux_mutex_lock(_tx_linux_mutex);
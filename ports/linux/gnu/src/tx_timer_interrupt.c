@@ -64,6 +64,7 @@ VOID   _tx_timer_interrupt(VOID);
 /*    tx_linux_mutex_unlock                                               */ 
 /*    _tx_timer_expiration_process                                        */ 
 /*    _tx_thread_time_slice                                               */ 
+/*    _tx_thread_budget_charge                                            */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -89,6 +90,15 @@ VOID   _tx_timer_interrupt(VOID)
     /* Increment the system clock.  */
     _tx_timer_system_clock++;
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+    /* Carry into the upper 32 bits of the 64-bit system clock.  */
+    if (_tx_timer_system_clock == ((ULONG) 0))
+    {
+        _tx_timer_system_clock_upper++;
+    }
+#endif
+
     /* Test for time-slice expiration.  */
     if (_tx_timer_time_slice)
     {
@@ -105,6 +115,12 @@ VOID   _tx_timer_interrupt(VOID)
         }
     }
 
+#ifdef TX_THREAD_ENABLE_BUDGET
+
+    /* Charge the tick to the CPU budget of the interrupted thread.  */
+    _tx_thread_budget_charge();
+#endif
+
     /* Test for timer expiration.  */
     if (*_tx_timer_current_ptr)
     {
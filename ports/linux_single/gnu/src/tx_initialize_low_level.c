@@ -0,0 +1,359 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** ThreadX Component                                                     */ 
+/**                                                                       */
+/**   Initialize                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <errno.h>
+
+
+/* Define various Linux objects used by the ThreadX port.  */
+
+volatile UINT       _tx_linux_interrupt_posture;
+volatile ULONG      _tx_linux_interrupt_pending;
+struct timespec     _tx_linux_time_stamp;
+
+
+/* Define the flag that is set while the signal handler processes the simulated
+   interrupts.  The interrupt signal is blocked while its handler runs, so the
+   signal must be unblocked before the interrupted thread is switched out.  */
+
+static UINT         _tx_linux_interrupt_signal_active;
+static sigset_t     _tx_linux_interrupt_signal_mask;
+
+
+/* Define simulated timer interrupt.  This is a POSIX timer that delivers the
+   interrupt signal, which is how other interrupts may be defined as well.  See
+   code below for an example.  */
+
+static timer_t      _tx_linux_timer_id;
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define simulated high-resolution timer interrupt.  The one-shot timer is a
+   POSIX timer on CLOCK_MONOTONIC.  */
+
+static timer_t      _tx_linux_high_resolution_timer_id;
+#endif
+
+void    _tx_linux_interrupt_signal_handler(int sig, siginfo_t *info, void *context);
+
+
+/* Define the ThreadX timer interrupt handler.  */
+
+void    _tx_timer_interrupt(void);
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+VOID    _tx_timer_high_resolution_expiration_process(VOID);
+#endif
+
+
+/* Define other external function references.  */
+
+VOID    _tx_initialize_low_level(VOID);
+VOID    _tx_thread_context_save(VOID);
+VOID    _tx_thread_context_restore(VOID);
+
+
+/* Define other external variable references.  */
+
+extern VOID     *_tx_initialize_unused_memory;
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_initialize_low_level                           Linux Single/GNU */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is responsible for any low-level processor            */
+/*    initialization, including setting up interrupt vectors, setting up  */
+/*    a periodic timer interrupt source, saving the system stack pointer  */
+/*    for use in ISR processing later, and finding the first available    */
+/*    RAM memory address for tx_application_define.  The simulated        */
+/*    interrupts are delivered by a signal to the single host thread      */
+/*    that runs all ThreadX threads.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    malloc                                                              */
+/*    sigaction                                                           */
+/*    timer_create                                                        */
+/*    printf                                                              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter       ThreadX entry function            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_initialize_low_level(VOID)
+{
+struct sigaction sa;
+struct sigevent  sev;
+
+    /* Pickup the first available memory address.  */
+
+    /* Save the first available memory address.  */
+    _tx_initialize_unused_memory =  malloc(TX_LINUX_MEMORY_SIZE);
+
+    /* Interrupts are disabled until the scheduler runs the first thread.  */
+    _tx_linux_interrupt_posture =        TX_INT_DISABLE;
+    _tx_linux_interrupt_pending =        ((ULONG) 0);
+    _tx_linux_interrupt_signal_active =  TX_FALSE;
+
+    /* Install the handler of the interrupt signal.  */
+    sigemptyset(&_tx_linux_interrupt_signal_mask);
+    sigaddset(&_tx_linux_interrupt_signal_mask, TX_LINUX_INTERRUPT_SIGNAL);
+    memset(&sa, 0, sizeof(sa));
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags =      SA_SIGINFO | SA_RESTART;
+    sa.sa_sigaction =  _tx_linux_interrupt_signal_handler;
+    if (sigaction(TX_LINUX_INTERRUPT_SIGNAL, &sa, NULL))
+    {
+
+        /* Error installing the interrupt signal handler.  */
+        printf("ThreadX Linux error installing interrupt signal handler!\n");
+        while(1)
+        {
+        }
+    }
+
+    /* Setup periodic timer interrupt, which is started after initialization.  */
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify =           SIGEV_SIGNAL;
+    sev.sigev_signo =            TX_LINUX_INTERRUPT_SIGNAL;
+    sev.sigev_value.sival_int =  (int) TX_LINUX_INTERRUPT_TIMER;
+    if (timer_create(CLOCK_MONOTONIC, &sev, &_tx_linux_timer_id))
+    {
+
+        /* Error creating the timer interrupt.  */
+        printf("ThreadX Linux error creating timer interrupt!\n");
+        while(1)
+        {
+        }
+    }
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+    /* Setup high-resolution timer interrupt.  */
+    sev.sigev_value.sival_int =  (int) TX_LINUX_INTERRUPT_HIGH_RESOLUTION;
+    if (timer_create(CLOCK_MONOTONIC, &sev, &_tx_linux_high_resolution_timer_id))
+    {
+
+        /* Error creating the high-resolution timer interrupt.  */
+        printf("ThreadX Linux error creating high-resolution timer interrupt!\n");
+        while(1)
+        {
+        }
+    }
+#endif
+
+    /* Done, return to caller.  */
+}
+
+
+/* This routine is called after initialization is complete in order to start
+   all interrupt sources.  Interrupt sources in addition to the timer may
+   be added to this routine as well.  */
+
+void    _tx_initialize_start_interrupts(void)
+{
+struct itimerspec   its;
+unsigned long long  timer_periodic_nsec;
+
+    /* Calculate periodic timer. */
+    timer_periodic_nsec =  1000000000ULL / ((unsigned long long) TX_TIMER_TICKS_PER_SECOND);
+
+    /* Start the timer to generate the ThreadX periodic interrupt source.  */
+    its.it_interval.tv_sec =   (time_t) (timer_periodic_nsec / 1000000000ULL);
+    its.it_interval.tv_nsec =  (long) (timer_periodic_nsec % 1000000000ULL);
+    its.it_value =             its.it_interval;
+    timer_settime(_tx_linux_timer_id, 0, &its, NULL);
+}
+
+
+/* Define the handler of the interrupt signal.  The simulated interrupt is made
+   pending, and is processed right away unless interrupts are disabled or an
+   interrupt is already being processed.  In that case, it is processed as soon
+   as interrupts are enabled again.  */
+
+void    _tx_linux_interrupt_signal_handler(int sig, siginfo_t *info, void *context)
+{
+int saved_errno;
+
+    (VOID)sig;
+    (VOID)context;
+
+    /* Only the POSIX timers raise simulated interrupts.  */
+    if (info -> si_code != SI_TIMER)
+    {
+        return;
+    }
+
+    /* Make the simulated interrupt pending.  */
+    __atomic_fetch_or(&_tx_linux_interrupt_pending, (ULONG) info -> si_value.sival_int, __ATOMIC_SEQ_CST);
+
+    /* Determine if the interrupted code has interrupts enabled.  */
+    if ((_tx_linux_interrupt_posture == TX_INT_ENABLE) && (_tx_thread_system_state == ((ULONG) 0)))
+    {
+
+        /* Preserve errno of the interrupted code.  */
+        saved_errno =  errno;
+
+        /* Process the pending interrupts.  */
+        _tx_linux_interrupt_signal_active =  TX_TRUE;
+        _tx_linux_interrupt_dispatch();
+        _tx_linux_interrupt_signal_active =  TX_FALSE;
+
+        errno =  saved_errno;
+    }
+}
+
+
+/* Define the processing of the pending simulated interrupts.  This is called with
+   interrupts enabled, from the signal handler or when interrupts are enabled again.
+   Each interrupt service routine is called between context save and context restore,
+   and other simulated interrupts may be added here as well.  */
+
+VOID    _tx_linux_interrupt_dispatch(VOID)
+{
+ULONG   pending;
+
+    /* Process interrupts until none is pending.  */
+    while (_tx_linux_interrupt_pending != ((ULONG) 0))
+    {
+
+        /* Call ThreadX context save for interrupt preparation.  */
+        _tx_thread_context_save();
+
+        /* Pickup and clear the pending interrupts.  */
+        pending =  __atomic_exchange_n(&_tx_linux_interrupt_pending, ((ULONG) 0), __ATOMIC_SEQ_CST);
+
+        /* Determine if the timer interrupt is pending.  */
+        if (pending & TX_LINUX_INTERRUPT_TIMER)
+        {
+
+            /* Call trace ISR enter event insert.  */
+            _tx_trace_isr_enter_insert(0);
+
+            /* Call the ThreadX system timer interrupt processing.  */
+            _tx_timer_interrupt();
+
+            /* Call trace ISR exit event insert.  */
+            _tx_trace_isr_exit_insert(0);
+        }
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+        /* Determine if the high-resolution timer interrupt is pending.  */
+        if (pending & TX_LINUX_INTERRUPT_HIGH_RESOLUTION)
+        {
+
+            /* Call trace ISR enter event insert.  */
+            _tx_trace_isr_enter_insert(1);
+
+            /* Call the ThreadX high-resolution timer processing.  */
+            _tx_timer_high_resolution_expiration_process();
+
+            /* Call trace ISR exit event insert.  */
+            _tx_trace_isr_exit_insert(1);
+        }
+#endif
+
+        /* Call ThreadX context restore for interrupt completion.  */
+        _tx_thread_context_restore();
+    }
+}
+
+
+/* Unblock the interrupt signal before the interrupted thread is switched out from
+   within the signal handler.  The signal mask of the thread is restored when it
+   returns from the handler.  */
+
+VOID    _tx_linux_interrupt_signal_release(VOID)
+{
+
+    if (_tx_linux_interrupt_signal_active)
+    {
+
+        _tx_linux_interrupt_signal_active =  TX_FALSE;
+        sigprocmask(SIG_UNBLOCK, &_tx_linux_interrupt_signal_mask, NULL);
+    }
+}
+
+
+#ifdef TX_TIMER_ENABLE_HIGH_RESOLUTION
+
+/* Define the high-resolution time, which is CLOCK_MONOTONIC in nanoseconds.  */
+
+ULONG64 _tx_linux_high_resolution_time_get(VOID)
+{
+struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return(((ULONG64) ts.tv_sec) * ((ULONG64) 1000000000) + ((ULONG64) ts.tv_nsec));
+}
+
+
+/* Program the one-shot timer for an absolute expiration time, or stop it if
+   the expiration time is zero.  */
+
+VOID    _tx_linux_high_resolution_timer_set(ULONG64 expiration_time)
+{
+struct itimerspec its;
+
+    its.it_interval.tv_sec =   0;
+    its.it_interval.tv_nsec =  0;
+    its.it_value.tv_sec =      (time_t) (expiration_time / ((ULONG64) 1000000000));
+    its.it_value.tv_nsec =     (long) (expiration_time % ((ULONG64) 1000000000));
+    timer_settime(_tx_linux_high_resolution_timer_id, TIMER_ABSTIME, &its, NULL);
+}
+#endif
+
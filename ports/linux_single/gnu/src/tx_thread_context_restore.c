@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** ThreadX Component                                                     */ 
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_context_restore                         Linux Single/GNU */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function restores the interrupt context if it is processing a  */
+/*    nested interrupt.  If not, it returns to the interrupted thread if  */
+/*    no preemption is necessary.  Otherwise, the remaining time-slice    */
+/*    of the interrupted thread is saved and the thread is switched back  */
+/*    to the scheduler.  When the preempted thread is scheduled again,    */
+/*    it returns from this function and finishes its interrupt            */
+/*    processing.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_interrupt_signal_release                                  */
+/*                                        Unblock the interrupt signal    */
+/*    _tx_linux_thread_switch_out       Switch to scheduler               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ISRs                              Interrupt Service Routines        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_context_restore(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD   *thread_ptr;
+
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Decrement the nested interrupt count.  */
+    _tx_thread_system_state--;
+
+    /* Pickup the interrupted thread.  */
+    thread_ptr =  _tx_thread_current_ptr;
+
+    /* Determine if this is the first nested interrupt, if a ThreadX application
+       thread was running at the time, and if preemption is required.  */
+    if ((_tx_thread_system_state == ((ULONG) 0)) && (thread_ptr != TX_NULL) &&
+        (_tx_thread_preempt_disable == ((UINT) 0)) && (thread_ptr != _tx_thread_execute_ptr))
+    {
+
+        /* Save the remaining time-slice and disable it.  */
+        if (_tx_timer_time_slice)
+        {
+
+            thread_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+            _tx_timer_time_slice =  0;
+        }
+
+        /* Clear the current thread pointer.  */
+        _tx_thread_current_ptr =  TX_NULL;
+
+        /* Preempt the running application thread by switching back to the scheduler.  */
+        _tx_linux_interrupt_signal_release();
+        _tx_linux_thread_switch_out(thread_ptr);
+    }
+
+    /* Restore the interrupt posture.  Interrupts that became pending in the meantime
+       are processed by the caller.  */
+    TX_LINUX_COMPILER_BARRIER
+    _tx_linux_interrupt_posture =  tx_saved_posture;
+}
+
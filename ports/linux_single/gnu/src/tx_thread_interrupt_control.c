@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** ThreadX Component                                                     */ 
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/* Define small routines used for the TX_DISABLE/TX_RESTORE macros.  Interrupts
+   are simulated, so only the interrupt posture flag is changed.  Interrupts that
+   became pending while they were disabled are processed when they are enabled
+   again outside of interrupt processing.  */
+
+UINT   _tx_thread_interrupt_disable(void)
+{
+
+UINT    previous_value;
+
+
+    previous_value =  _tx_linux_interrupt_posture;
+    _tx_linux_interrupt_posture =  TX_INT_DISABLE;
+    TX_LINUX_COMPILER_BARRIER
+    return(previous_value);
+}
+
+
+VOID   _tx_thread_interrupt_restore(UINT previous_posture)
+{
+
+    TX_LINUX_COMPILER_BARRIER
+    _tx_linux_interrupt_posture =  previous_posture;
+
+    /* Determine if interrupts are pending that can be processed now.  */
+    if ((previous_posture == TX_INT_ENABLE) && (_tx_linux_interrupt_pending != ((ULONG) 0)) &&
+        (_tx_thread_system_state == ((ULONG) 0)))
+    {
+
+        /* Process the pending interrupts.  */
+        _tx_linux_interrupt_dispatch();
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_interrupt_control                       Linux Single/GNU */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is responsible for changing the interrupt lockout     */
+/*    posture of the system.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    new_posture                       New interrupt lockout posture     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    old_posture                       Old interrupt lockout posture     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_interrupt_disable      Disable interrupts                */
+/*    _tx_thread_interrupt_restore      Restore interrupts                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+UINT   _tx_thread_interrupt_control(UINT new_posture)
+{
+
+UINT        old_posture;
+
+
+    /* Pickup the previous posture and lockout interrupts.  */
+    old_posture =  _tx_thread_interrupt_disable();
+
+    /* Apply the new posture.  */
+    _tx_thread_interrupt_restore(new_posture);
+
+    /* Return the previous interrupt disable posture.  */
+    return(old_posture);
+}
+
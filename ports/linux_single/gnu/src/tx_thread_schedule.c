@@ -0,0 +1,241 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_LINUX_UCONTEXT_ENABLE
+
+/* Define the context of the scheduler, which runs on the stack of the host thread.  */
+
+static ucontext_t   _tx_linux_schedule_context;
+
+#else
+
+/* Define the saved stack pointer of the scheduler, which runs on the stack of
+   the host thread.  */
+
+static VOID         *_tx_linux_schedule_stack_ptr;
+
+
+/* Define the stack switch.  The callee-saved registers are pushed on the current
+   stack and the stack pointer is saved.  Then the stack pointer is loaded and the
+   registers are popped from the other stack, which returns to where that stack
+   was switched out, or to the thread entry built by _tx_thread_stack_build.  */
+
+VOID    _tx_linux_context_switch(VOID **save_stack_ptr, VOID *stack_ptr);
+
+#ifdef __x86_64__
+__asm__ (
+"    .text\n"
+"    .globl  _tx_linux_context_switch\n"
+"    .type   _tx_linux_context_switch, @function\n"
+"_tx_linux_context_switch:\n"
+"    pushq   %rbp\n"
+"    pushq   %rbx\n"
+"    pushq   %r12\n"
+"    pushq   %r13\n"
+"    pushq   %r14\n"
+"    pushq   %r15\n"
+"    subq    $8, %rsp\n"
+"    stmxcsr (%rsp)\n"
+"    fnstcw  4(%rsp)\n"
+"    movq    %rsp, (%rdi)\n"
+"    movq    %rsi, %rsp\n"
+"    ldmxcsr (%rsp)\n"
+"    fldcw   4(%rsp)\n"
+"    addq    $8, %rsp\n"
+"    popq    %r15\n"
+"    popq    %r14\n"
+"    popq    %r13\n"
+"    popq    %r12\n"
+"    popq    %rbx\n"
+"    popq    %rbp\n"
+"    ret\n"
+"    .size   _tx_linux_context_switch, .-_tx_linux_context_switch\n"
+);
+#else
+__asm__ (
+"    .text\n"
+"    .globl  _tx_linux_context_switch\n"
+"    .type   _tx_linux_context_switch, @function\n"
+"_tx_linux_context_switch:\n"
+"    movl    4(%esp), %eax\n"
+"    movl    8(%esp), %edx\n"
+"    pushl   %ebp\n"
+"    pushl   %ebx\n"
+"    pushl   %esi\n"
+"    pushl   %edi\n"
+"    movl    %esp, (%eax)\n"
+"    movl    %edx, %esp\n"
+"    popl    %edi\n"
+"    popl    %esi\n"
+"    popl    %ebx\n"
+"    popl    %ebp\n"
+"    ret\n"
+"    .size   _tx_linux_context_switch, .-_tx_linux_context_switch\n"
+);
+#endif
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_schedule                                Linux Single/GNU */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits for a thread control block pointer to appear    */
+/*    in the _tx_thread_execute_ptr variable.  Once a thread pointer      */
+/*    appears in the variable, the corresponding thread is resumed by     */
+/*    switching to its stack.  The scheduler runs on the stack of the     */
+/*    host thread, and is switched back to when the thread is suspended   */
+/*    or preempted.  While no thread is ready, the host thread waits for  */
+/*    the interrupt signal.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sigprocmask                                                         */
+/*    sigsuspend                                                          */
+/*    _tx_linux_interrupt_dispatch      Process pending interrupts        */
+/*    _tx_linux_thread_switch_in        Switch to thread                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter       ThreadX entry function            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_schedule(VOID)
+{
+sigset_t    signal_mask;
+sigset_t    previous_mask;
+
+    /* Setup the mask of the interrupt signal.  */
+    sigemptyset(&signal_mask);
+    sigaddset(&signal_mask, TX_LINUX_INTERRUPT_SIGNAL);
+
+    /* Loop forever.  */
+    while(1)
+    {
+
+        /* Lockout interrupts while the next thread is selected.  */
+        _tx_linux_interrupt_posture =  TX_INT_DISABLE;
+        TX_LINUX_COMPILER_BARRIER
+
+        /* Determine if there is a thread ready to execute.  */
+        if (_tx_thread_execute_ptr == TX_NULL)
+        {
+
+            /* No, wait for an interrupt.  Block the interrupt signal first, so it
+               can not arrive between the enabling of interrupts and the wait.  */
+            sigprocmask(SIG_BLOCK, &signal_mask, &previous_mask);
+            _tx_linux_interrupt_posture =  TX_INT_ENABLE;
+            TX_LINUX_COMPILER_BARRIER
+
+            /* Wait unless an interrupt became pending while interrupts were disabled.  */
+            if (_tx_linux_interrupt_pending == ((ULONG) 0))
+            {
+
+                /* The interrupt is processed by the signal handler.  */
+                sigsuspend(&previous_mask);
+            }
+            sigprocmask(SIG_SETMASK, &previous_mask, NULL);
+
+            /* Process the interrupts that are still pending.  */
+            _tx_linux_interrupt_dispatch();
+        }
+        else
+        {
+
+            /* Yes! We have a thread to execute.  */
+
+            /* Setup the current thread pointer.  */
+            _tx_thread_current_ptr =  _tx_thread_execute_ptr;
+
+            /* Increment the run count for this thread.  */
+            _tx_thread_current_ptr -> tx_thread_run_count++;
+
+            /* Setup time-slice, if present.  */
+            _tx_timer_time_slice =  _tx_thread_current_ptr -> tx_thread_time_slice;
+
+            /* Switch to the thread, which restores its own interrupt posture.  This
+               returns when the thread is suspended or preempted.  */
+            _tx_linux_thread_switch_in(_tx_thread_current_ptr);
+        }
+    }
+}
+
+
+/* Switch from the scheduler to the thread.  */
+
+VOID    _tx_linux_thread_switch_in(TX_THREAD *thread_ptr)
+{
+
+#ifdef TX_LINUX_UCONTEXT_ENABLE
+    swapcontext(&_tx_linux_schedule_context, &thread_ptr -> tx_thread_linux_context);
+#else
+    _tx_linux_context_switch(&_tx_linux_schedule_stack_ptr, thread_ptr -> tx_thread_stack_ptr);
+#endif
+}
+
+
+/* Switch from the thread back to the scheduler.  The stack pointer of the thread
+   is saved in its control block.  */
+
+VOID    _tx_linux_thread_switch_out(TX_THREAD *thread_ptr)
+{
+
+#ifdef TX_LINUX_UCONTEXT_ENABLE
+    swapcontext(&thread_ptr -> tx_thread_linux_context, &_tx_linux_schedule_context);
+#else
+    _tx_linux_context_switch(&thread_ptr -> tx_thread_stack_ptr, _tx_linux_schedule_stack_ptr);
+#endif
+}
+
@@ -0,0 +1,164 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** ThreadX Component                                                     */ 
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/* Prototype for new thread entry function.  */
+
+static VOID _tx_linux_thread_entry(VOID);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_build                             Linux Single/GNU */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds a stack frame on the supplied thread's stack.  */
+/*    The stack frame results in a fake interrupt return to the supplied  */
+/*    function pointer.  On x86 hosts the frame holds the callee-saved    */
+/*    registers popped by the stack switch, which then returns to the     */
+/*    thread entry.  Otherwise, the ucontext of the thread is setup to    */
+/*    start the thread entry on the thread stack.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread control blk     */
+/*    function_ptr                      Pointer to return function        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    getcontext                                                          */
+/*    makecontext                                                         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_create                 Create thread service             */
+/*    _tx_thread_reset                  Reset thread service              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_stack_build(TX_THREAD *thread_ptr, VOID (*function_ptr)(VOID))
+{
+#ifdef TX_LINUX_UCONTEXT_ENABLE
+
+    (VOID)function_ptr;
+
+    /* Setup the context to start the thread entry on the thread stack.  */
+    getcontext(&thread_ptr -> tx_thread_linux_context);
+    thread_ptr -> tx_thread_linux_context.uc_stack.ss_sp =    thread_ptr -> tx_thread_stack_start;
+    thread_ptr -> tx_thread_linux_context.uc_stack.ss_size =  (size_t) thread_ptr -> tx_thread_stack_size;
+    thread_ptr -> tx_thread_linux_context.uc_link =           NULL;
+    sigemptyset(&thread_ptr -> tx_thread_linux_context.uc_sigmask);
+    makecontext(&thread_ptr -> tx_thread_linux_context, _tx_linux_thread_entry, 0);
+
+    /* Setup a fake thread stack pointer.   */
+    thread_ptr -> tx_thread_stack_ptr =  (VOID *) (((CHAR *) thread_ptr -> tx_thread_stack_end) - 8);
+
+    /* Clear the first word of the stack.  */
+    *(((ULONG *) thread_ptr -> tx_thread_stack_ptr) - 1) =  0;
+#else
+
+CHAR    *stack_top;
+VOID    **frame_ptr;
+
+    (VOID)function_ptr;
+
+    /* Align the top of the stack to 16 bytes.  */
+    stack_top =  (CHAR *) ((((ALIGN_TYPE) thread_ptr -> tx_thread_stack_end) + ((ALIGN_TYPE) 1)) & ~((ALIGN_TYPE) 15));
+
+#ifdef __x86_64__
+
+    /* Build the frame popped by the stack switch, which is the control words of the
+       floating point unit, the registers r15, r14, r13, r12, rbx and rbp, and the
+       return address.  The stack is aligned as for a function call when the thread
+       entry is reached.  */
+    frame_ptr =  (VOID **) (stack_top - 16);
+    frame_ptr[1] =   TX_NULL;                                   /* Initial frame end    */
+    frame_ptr[0] =   (VOID *) _tx_linux_thread_entry;           /* Return address       */
+    frame_ptr[-1] =  TX_NULL;                                   /* Initial rbp          */
+    frame_ptr[-2] =  TX_NULL;                                   /* Initial rbx          */
+    frame_ptr[-3] =  TX_NULL;                                   /* Initial r12          */
+    frame_ptr[-4] =  TX_NULL;                                   /* Initial r13          */
+    frame_ptr[-5] =  TX_NULL;                                   /* Initial r14          */
+    frame_ptr[-6] =  TX_NULL;                                   /* Initial r15          */
+    frame_ptr[-7] =  (VOID *) 0x0000037F00001F80ULL;            /* Initial FPU CW/MXCSR */
+
+    /* Setup the stack pointer of the thread.  */
+    thread_ptr -> tx_thread_stack_ptr =  (VOID *) &frame_ptr[-7];
+#else
+
+    /* Build the frame popped by the stack switch, which is the registers edi, esi,
+       ebx and ebp, and the return address.  The stack is aligned as for a function
+       call when the thread entry is reached.  */
+    frame_ptr =  (VOID **) (stack_top - 8);
+    frame_ptr[1] =   TX_NULL;                                   /* Initial frame end    */
+    frame_ptr[0] =   (VOID *) _tx_linux_thread_entry;           /* Return address       */
+    frame_ptr[-1] =  TX_NULL;                                   /* Initial ebp          */
+    frame_ptr[-2] =  TX_NULL;                                   /* Initial ebx          */
+    frame_ptr[-3] =  TX_NULL;                                   /* Initial esi          */
+    frame_ptr[-4] =  TX_NULL;                                   /* Initial edi          */
+
+    /* Setup the stack pointer of the thread.  */
+    thread_ptr -> tx_thread_stack_ptr =  (VOID *) &frame_ptr[-4];
+#endif
+#endif
+}
+
+
+/* Define the entry of a new thread, which is reached by the first switch to the
+   thread.  Interrupts are enabled and the ThreadX thread shell is called.  */
+
+static VOID _tx_linux_thread_entry(VOID)
+{
+
+    /* Enable interrupts, which processes the interrupts that became pending while
+       the thread was switched in.  */
+    _tx_thread_interrupt_restore(TX_INT_ENABLE);
+
+    /* Call ThreadX thread entry point.  */
+    _tx_thread_shell_entry();
+}
+
@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** ThreadX Component                                                     */ 
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_system_return                           Linux Single/GNU */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is target processor specific.  It is used to          */
+/*    transfer control from a thread back to the system.  The remaining   */
+/*    time-slice is saved, and the stack of the thread is switched back   */
+/*    to the scheduler.  When the thread is scheduled again, the switch   */
+/*    returns and the interrupt posture of the thread is restored.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_thread_switch_out       Switch to scheduler               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX components                                                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_system_return(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD   *thread_ptr;
+
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the current thread pointer.  */
+    thread_ptr =  _tx_thread_current_ptr;
+
+    /* Determine if the time-slice is active.  */
+    if (_tx_timer_time_slice)
+    {
+
+        /* Preserve current remaining time-slice for the thread and clear the current time-slice.  */
+        thread_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+        _tx_timer_time_slice =  0;
+    }
+
+    /* Set the current thread pointer to NULL.  */
+    _tx_thread_current_ptr =  TX_NULL;
+
+    /* Switch back to the scheduler.  A thread that terminated itself is never
+       switched back to.  */
+    _tx_linux_thread_switch_out(thread_ptr);
+
+    /* The thread is scheduled again, restore its interrupt posture.  */
+    TX_RESTORE
+}
+
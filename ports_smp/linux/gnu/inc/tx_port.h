@@ -174,6 +174,17 @@ typedef uint64_t                                ULONG64;
 #define ULONG64_DEFINED
 
 
+/* Define that the timer interrupt of this port maintains the upper 32 bits of the
+   64-bit system clock.  */
+
+#define TX_PORT_TIMER_64BIT_CLOCK
+
+
+/* Define that the timer interrupt of this port supports per-core timer lists.  */
+
+#define TX_PORT_TIMER_SMP_PER_CORE
+
+
 /* Define automated coverage test extensions...  These are required for the 
    ThreadX regression test.  */
 
@@ -669,6 +680,13 @@ void    _tx_linux_thread_sleep(long ns);
 #define TX_LINUX_THREAD_STACK_SIZE              65536
 #endif
 
+/* Define the adaptive mutex spin delay. The simulated cores are host threads that may share a
+   host CPU, so give the mutex owner a chance to run while spinning.  */
+
+#ifndef TX_MUTEX_SPIN_PAUSE
+#define TX_MUTEX_SPIN_PAUSE                     sched_yield();
+#endif
+
 /* Define priorities of pthreads. */
 #define TX_LINUX_PRIORITY_SCHEDULE              (3)
 #define TX_LINUX_PRIORITY_ISR                   (2)
@@ -61,6 +61,7 @@
 /*                                                                        */
 /*    _tx_linux_debug_entry_insert                                        */
 /*    _tx_timer_expiration_process                                        */
+/*    _tx_timer_smp_expiration_process                                    */
 /*    _tx_thread_time_slice                                               */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -92,6 +93,21 @@ UINT    saved_posture;
     /* Increment the system clock.  */
     _tx_timer_system_clock++;
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+    /* Carry into the upper 32 bits of the 64-bit system clock.  */
+    if (_tx_timer_system_clock == ((ULONG) 0))
+    {
+        _tx_timer_system_clock_upper++;
+    }
+#endif
+
+#ifdef TX_TIMER_ENABLE_SMP_PER_CORE
+
+    /* Process the current timer list entry of each core.  */
+    _tx_timer_smp_expiration_process();
+#else
+
     /* Test for timer expiration.  */
     if (*_tx_timer_current_ptr)
     {
@@ -126,6 +142,7 @@ UINT    saved_posture;
             _tx_timer_expiration_process();
         }
     }
+#endif
 
     /* Call time-slice processing to process time-slice for all threads on each core.  */
     _tx_thread_time_slice();
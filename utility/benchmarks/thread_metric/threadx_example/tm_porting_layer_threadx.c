@@ -58,12 +58,16 @@
 #define TM_THREADX_MAX_THREADS          10
 #define TM_THREADX_MAX_QUEUES           1
 #define TM_THREADX_MAX_SEMAPHORES       1
+#define TM_THREADX_MAX_MUTEXES          1
+#define TM_THREADX_MAX_TIMERS           (TM_TIMER_COUNT + 1)
 #define TM_THREADX_MAX_MEMORY_POOLS     1
 
 
 /* Define the default ThreadX stack size.  */
 
+#ifndef TM_THREADX_THREAD_STACK_SIZE
 #define TM_THREADX_THREAD_STACK_SIZE    2096
+#endif
 
 
 /* Define the default ThreadX queue size.  */
@@ -86,6 +90,8 @@
 TX_THREAD       tm_thread_array[TM_THREADX_MAX_THREADS];
 TX_QUEUE        tm_queue_array[TM_THREADX_MAX_QUEUES];
 TX_SEMAPHORE    tm_semaphore_array[TM_THREADX_MAX_SEMAPHORES];
+TX_MUTEX        tm_mutex_array[TM_THREADX_MAX_MUTEXES];
+TX_TIMER        tm_timer_array[TM_THREADX_MAX_TIMERS];
 TX_BLOCK_POOL   tm_block_pool_array[TM_THREADX_MAX_MEMORY_POOLS];
 
 
@@ -101,6 +107,12 @@ unsigned char   tm_pool_memory_area[TM_THREADX_MAX_MEMORY_POOLS*TM_THREADX_MEMOR
 void           *tm_thread_entry_functions[TM_THREADX_MAX_THREADS];
 
 
+/* Define array to remember the test timer expiration function and period.  */
+
+void           *tm_timer_expiration_functions[TM_THREADX_MAX_TIMERS];
+ULONG           tm_timer_periods[TM_THREADX_MAX_TIMERS];
+
+
 /* Remember the test initialization function.  */
 
 void            (*tm_initialization_function)(void);
@@ -111,6 +123,11 @@ void            (*tm_initialization_function)(void);
 VOID  tm_thread_entry(ULONG thread_input);
 
 
+/* Define our shell expiration function to match ThreadX.  */
+
+VOID  tm_timer_entry(ULONG timer_input);
+
+
 /* This function called from main performs basic RTOS initialization, 
    calls the test initialization function, and then starts the RTOS function.  */
 void  tm_initialize(void (*test_initialization_function)(void))
@@ -323,6 +340,117 @@ UINT    status;
 }
 
 
+/* This function creates the specified mutex.  If successful, the function should
+   return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_mutex_create(int mutex_id)
+{
+
+UINT    status;
+
+
+    /*  Create mutex without priority inheritance.  */
+    status =  tx_mutex_create(&tm_mutex_array[mutex_id], "Thread-Metric test", TX_NO_INHERIT);
+
+    /* Determine if the mutex create was successful.  */
+    if (status == TX_SUCCESS)
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
+/* This function gets the specified mutex.  If successful, the function should
+   return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_mutex_get(int mutex_id)
+{
+
+UINT    status;
+
+
+    /*  Get the mutex.  */
+    status =  tx_mutex_get(&tm_mutex_array[mutex_id], TX_NO_WAIT);
+
+    /* Determine if the mutex get was successful.  */
+    if (status == TX_SUCCESS)
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
+/* This function puts the specified mutex.  If successful, the function should
+   return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_mutex_put(int mutex_id)
+{
+
+UINT    status;
+
+
+    /*  Put the mutex.  */
+    status =  tx_mutex_put(&tm_mutex_array[mutex_id]);
+
+    /* Determine if the mutex put was successful.  */
+    if (status == TX_SUCCESS)
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
+/* This function creates and starts the specified timer.  The timer first expires
+   after initial_ticks and then every period_ticks, calling the expiration function
+   with the timer ID each time.  If successful, the function should return
+   TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_timer_create(int timer_id, int initial_ticks, int period_ticks, void (*expiration_function)(int timer_id))
+{
+
+UINT    status;
+
+
+    /* Remember the actual expiration function and period.  */
+    tm_timer_expiration_functions[timer_id] =  (void *) expiration_function;
+    tm_timer_periods[timer_id] =               (ULONG) period_ticks;
+
+    /* Create and activate the timer under ThreadX.  */
+    status =  tx_timer_create(&tm_timer_array[timer_id], "Thread-Metric test", tm_timer_entry, (ULONG) timer_id,
+                    (ULONG) initial_ticks, (ULONG) period_ticks, TX_AUTO_ACTIVATE);
+
+    /* Determine if the timer create was successful.  */
+    if (status == TX_SUCCESS)
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
+/* This function restarts the specified timer, such that it expires after the
+   specified number of ticks and then every period_ticks.  If successful, the
+   function should return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_timer_restart(int timer_id, int ticks)
+{
+
+UINT    status;
+
+
+    /* Stop the timer.  */
+    status =  tx_timer_deactivate(&tm_timer_array[timer_id]);
+
+    /* Setup the new expiration.  */
+    if (status == TX_SUCCESS)
+        status =  tx_timer_change(&tm_timer_array[timer_id], (ULONG) ticks, tm_timer_periods[timer_id]);
+
+    /* Start the timer again.  */
+    if (status == TX_SUCCESS)
+        status =  tx_timer_activate(&tm_timer_array[timer_id]);
+
+    /* Determine if the timer restart was successful.  */
+    if (status == TX_SUCCESS)
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
 /* This function creates the specified memory pool that can support one or more
    allocations of 128 bytes.  If successful, the function should
    return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
@@ -399,3 +527,19 @@ void (*entry_function)(void);
 }
 
 
+/* This is the ThreadX timer expiration.  It is going to call the Thread-Metric
+   expiration function saved earlier.  */
+VOID  tm_timer_entry(ULONG timer_input)
+{
+
+void (*expiration_function)(int timer_id);
+
+
+    /* Pickup the expiration function from the saved array.  */
+    expiration_function =  (void (*)(int)) tm_timer_expiration_functions[timer_input];
+
+    /* Call the expiration function.   */
+    (expiration_function)((int) timer_input);
+}
+
+
@@ -73,6 +73,18 @@ extern   "C" {
 #endif
 
 
+/* Define the number of timers and the timer period in ticks used by the timer processing
+   test. These can be changed with -D compiler options.  */
+
+#ifndef TM_TIMER_COUNT
+#define TM_TIMER_COUNT      1000
+#endif
+
+#ifndef TM_TIMER_DURATION
+#define TM_TIMER_DURATION   1000
+#endif
+
+
 /* Define RTOS Neutral APIs. RTOS vendors should fill in the guts of the following
    API. Once this is done the Thread-Metric tests can be successfully run.  */
 
@@ -88,6 +100,11 @@ int    tm_queue_receive(int queue_id, unsigned long *message_ptr);
 int    tm_semaphore_create(int semaphore_id);
 int    tm_semaphore_get(int semaphore_id);
 int    tm_semaphore_put(int semaphore_id);
+int    tm_mutex_create(int mutex_id);
+int    tm_mutex_get(int mutex_id);
+int    tm_mutex_put(int mutex_id);
+int    tm_timer_create(int timer_id, int initial_ticks, int period_ticks, void (*expiration_function)(int timer_id));
+int    tm_timer_restart(int timer_id, int ticks);
 int    tm_memory_pool_create(int pool_id);
 int    tm_memory_pool_allocate(int pool_id, unsigned char **memory_ptr);
 int    tm_memory_pool_deallocate(int pool_id, unsigned char *memory_ptr);
@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** Thread-Metric Component                                               */
+/**                                                                       */
+/**   Mutex Processing Test                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    tm_mutex_processing_test                            PORTABLE C      */ 
+/*                                                           6.1.12       */ 
+/*  AUTHOR                                                                */ 
+/*                                                                        */ 
+/*    William E. Lamie, Microsoft Corporation                             */ 
+/*                                                                        */ 
+/*  DESCRIPTION                                                           */ 
+/*                                                                        */ 
+/*    This file defines the uncontended Mutex get/put processing test.    */
+/*    Building ThreadX with and without TX_MUTEX_ENABLE_FAST_PATH and     */
+/*    comparing the results shows the cost of the regular mutex path.     */
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */ 
+/**************************************************************************/ 
+#include "tm_api.h"
+
+
+/* Define the counters used in the demo application...  */
+
+unsigned long   tm_mutex_processing_counter;
+
+
+/* Define the test thread prototypes.  */
+
+void            tm_mutex_processing_thread_0_entry(void);
+
+
+/* Define the reporting thread prototype.  */
+
+void            tm_mutex_processing_thread_report(void);
+
+
+/* Define the initialization prototype.  */
+
+void            tm_mutex_processing_initialize(void);
+
+
+/* Define main entry point.  */
+
+void tm_main()
+{
+
+    /* Initialize the test.  */
+    tm_initialize(tm_mutex_processing_initialize);
+}
+
+
+/* Define the mutex processing test initialization.  */
+
+void  tm_mutex_processing_initialize(void)
+{
+
+    /* Create thread 0 at priority 10.  */
+    tm_thread_create(0, 10, tm_mutex_processing_thread_0_entry);
+
+    /* Resume thread 0.  */
+    tm_thread_resume(0);
+
+    /* Create a mutex for the test.  */
+    tm_mutex_create(0);
+
+    /* Create the reporting thread. It will preempt the other 
+       threads and print out the test results.  */
+    tm_thread_create(5, 2, tm_mutex_processing_thread_report);
+    tm_thread_resume(5);
+}
+
+
+/* Define the mutex processing thread.  */
+void  tm_mutex_processing_thread_0_entry(void)
+{
+
+int status;
+
+    while(1)
+    {
+
+        /* Get the mutex.  */
+        tm_mutex_get(0);
+
+        /* Release the mutex.  */
+        status = tm_mutex_put(0);
+
+        /* Check for mutex put error.  */
+        if (status != TM_SUCCESS)
+            break;
+
+        /* Increment the number of mutex get/puts.  */
+        tm_mutex_processing_counter++;
+    }
+}
+
+
+/* Define the mutex test reporting thread.  */
+void  tm_mutex_processing_thread_report(void)
+{
+
+unsigned long   last_counter;
+unsigned long   relative_time;
+
+
+    /* Initialize the last counter.  */
+    last_counter =  0;
+
+    /* Initialize the relative time.  */
+    relative_time =  0;
+
+    while(1)
+    {
+
+        /* Sleep to allow the test to run.  */
+        tm_thread_sleep(TM_TEST_DURATION);
+
+        /* Increment the relative time.  */
+        relative_time =  relative_time + TM_TEST_DURATION;
+
+        /* Print results to the stdio window.  */
+        printf("**** Thread-Metric Mutex Processing Test **** Relative Time: %lu\n", relative_time);
+
+        /* See if there are any errors.  */
+        if (tm_mutex_processing_counter == last_counter)
+        {
+
+            printf("ERROR: Invalid counter value(s). Error getting/putting mutex!\n");
+        }
+
+        /* Show the time period total.  */
+        printf("Time Period Total:  %lu\n\n", tm_mutex_processing_counter - last_counter);
+
+        /* Save the last counter.  */
+        last_counter =  tm_mutex_processing_counter;
+    }
+}
@@ -124,6 +124,49 @@ int  tm_semaphore_put(int semaphore_id)
 }
 
 
+/* This function creates the specified mutex.  If successful, the function should
+   return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_mutex_create(int mutex_id)
+{
+
+}
+
+
+/* This function gets the specified mutex.  If successful, the function should
+   return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_mutex_get(int mutex_id)
+{
+
+}
+
+
+/* This function puts the specified mutex.  If successful, the function should
+   return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_mutex_put(int mutex_id)
+{
+
+}
+
+
+/* This function creates and starts the specified timer.  The timer first expires
+   after initial_ticks and then every period_ticks, calling the expiration function
+   with the timer ID each time.  If successful, the function should return
+   TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_timer_create(int timer_id, int initial_ticks, int period_ticks, void (*expiration_function)(int timer_id))
+{
+
+}
+
+
+/* This function restarts the specified timer, such that it expires after the
+   specified number of ticks and then every period_ticks.  If successful, the
+   function should return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_timer_restart(int timer_id, int ticks)
+{
+
+}
+
+
 /* This function creates the specified memory pool that can support one or more
    allocations of 128 bytes.  If successful, the function should
    return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** Thread-Metric Component                                               */
+/**                                                                       */
+/**   Timer Processing Test                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    tm_timer_processing_test                            PORTABLE C      */ 
+/*                                                           6.1.12       */ 
+/*  AUTHOR                                                                */ 
+/*                                                                        */ 
+/*    William E. Lamie, Microsoft Corporation                             */ 
+/*                                                                        */ 
+/*  DESCRIPTION                                                           */ 
+/*                                                                        */ 
+/*    This file defines the Timer processing test.  A large number of     */
+/*    long periodic timers expire in the background while a thread        */
+/*    continuously restarts another long timer.  Building ThreadX with    */
+/*    and without TX_TIMER_ENABLE_CASCADE and comparing the results       */
+/*    shows the cost of re-queuing long timers on every wheel wrap.       */
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */ 
+/**************************************************************************/ 
+#include "tm_api.h"
+
+
+/* Define the counters used in the demo application...  */
+
+unsigned long   tm_timer_processing_counter;
+unsigned long   tm_timer_expiration_counter;
+
+
+/* Define the test thread prototypes.  */
+
+void            tm_timer_processing_thread_0_entry(void);
+
+
+/* Define the timer expiration prototype.  */
+
+void            tm_timer_processing_expiration(int timer_id);
+
+
+/* Define the reporting thread prototype.  */
+
+void            tm_timer_processing_thread_report(void);
+
+
+/* Define the initialization prototype.  */
+
+void            tm_timer_processing_initialize(void);
+
+
+/* Define main entry point.  */
+
+void tm_main()
+{
+
+    /* Initialize the test.  */
+    tm_initialize(tm_timer_processing_initialize);
+}
+
+
+/* Define the timer processing test initialization.  */
+
+void  tm_timer_processing_initialize(void)
+{
+
+int i;
+
+
+    /* Create the background timers.  Their first expirations are spread
+       evenly over one period.  */
+    for (i = 0; i < TM_TIMER_COUNT; i++)
+    {
+
+        /* Create and start a periodic timer.  */
+        tm_timer_create(i, 1 + (i % TM_TIMER_DURATION), TM_TIMER_DURATION, tm_timer_processing_expiration);
+    }
+
+    /* Create the timer that is restarted by thread 0.  */
+    tm_timer_create(TM_TIMER_COUNT, TM_TIMER_DURATION, TM_TIMER_DURATION, tm_timer_processing_expiration);
+
+    /* Create thread 0 at priority 10.  */
+    tm_thread_create(0, 10, tm_timer_processing_thread_0_entry);
+
+    /* Resume thread 0.  */
+    tm_thread_resume(0);
+
+    /* Create the reporting thread. It will preempt the other 
+       threads and print out the test results.  */
+    tm_thread_create(5, 2, tm_timer_processing_thread_report);
+    tm_thread_resume(5);
+}
+
+
+/* Define the timer processing thread.  */
+void  tm_timer_processing_thread_0_entry(void)
+{
+
+int status;
+
+    while(1)
+    {
+
+        /* Restart the timer, which moves its expiration further out.  */
+        status = tm_timer_restart(TM_TIMER_COUNT, TM_TIMER_DURATION);
+
+        /* Check for timer restart error.  */
+        if (status != TM_SUCCESS)
+            break;
+
+        /* Increment the number of timer restarts.  */
+        tm_timer_processing_counter++;
+    }
+}
+
+
+/* Define the timer expiration function.  */
+void  tm_timer_processing_expiration(int timer_id)
+{
+
+    /* Increment the number of timer expirations.  */
+    tm_timer_expiration_counter++;
+}
+
+
+/* Define the timer test reporting thread.  */
+void  tm_timer_processing_thread_report(void)
+{
+
+unsigned long   last_counter;
+unsigned long   last_expirations;
+unsigned long   relative_time;
+
+
+    /* Initialize the last counters.  */
+    last_counter =      0;
+    last_expirations =  0;
+
+    /* Initialize the relative time.  */
+    relative_time =  0;
+
+    while(1)
+    {
+
+        /* Sleep to allow the test to run.  */
+        tm_thread_sleep(TM_TEST_DURATION);
+
+        /* Increment the relative time.  */
+        relative_time =  relative_time + TM_TEST_DURATION;
+
+        /* Print results to the stdio window.  */
+        printf("**** Thread-Metric Timer Processing Test **** Relative Time: %lu\n", relative_time);
+
+        /* See if there are any errors.  */
+        if (tm_timer_processing_counter == last_counter)
+        {
+
+            printf("ERROR: Invalid counter value(s). Error restarting timer!\n");
+        }
+
+        /* Show the time period total.  */
+        printf("Time Period Total:  %lu\n", tm_timer_processing_counter - last_counter);
+
+        /* Show the number of background timer expirations.  */
+        printf("Timer Expirations:  %lu\n\n", tm_timer_expiration_counter - last_expirations);
+
+        /* Save the last counters.  */
+        last_counter =      tm_timer_processing_counter;
+        last_expirations =  tm_timer_expiration_counter;
+    }
+}
@@ -259,6 +259,13 @@ ULONG   tx_low_power_adjust_ticks;
 /*    routine will return a value of TX_FALSE and the next ticks value    */
 /*    will be set to zero.                                                */
 /*                                                                        */
+/*    If TX_TIMER_ENABLE_LIST_MAP is defined, only the timer list entries */
+/*    in use are examined, closest first, and the search stops at the     */
+/*    first entry that cannot hold an earlier expiration.  With cascading */
+/*    timer lists, the cascade timer itself is ignored and the cascade    */
+/*    lists are examined in the same way, so the expiration returned is   */
+/*    not limited to the next pass through the timer list.                */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    next_timer_tick_ptr               Pointer to destination for next   */
@@ -271,7 +278,8 @@ ULONG   tx_low_power_adjust_ticks;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_cascade_remaining_get   Get ticks left of cascaded timer  */
+/*    _tx_timer_list_map_search         Find timer list entry in use      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -291,14 +299,136 @@ TX_INTERRUPT_SAVE_AREA
 
 TX_TIMER_INTERNAL           **timer_list_head;
 TX_TIMER_INTERNAL           *next_timer;
-UINT                        i;
 ULONG                       calculated_time;
 ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+ULONG                       base;
+ULONG                       offset;
+#ifdef TX_TIMER_ENABLE_CASCADE
+UINT                        level;
+UINT                        shift;
+#endif
+#else
+UINT                        i;
+#endif
 
 
     /* Disable interrupts.  */
     TX_DISABLE
 
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Pickup the index of the current timer list entry.  */
+    base =  TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+
+    /* Find the closest timer list entry in use.  */
+    offset =  _tx_timer_list_map_search(&_tx_timer_list_map, _tx_timer_list_start, base, (ULONG) 0);
+
+    /* Loop through the timer list entries in use, until no entry can hold an
+       earlier expiration time.  */
+    while ((offset < TX_TIMER_ENTRIES) && (offset < expiration_time))
+    {
+        /* Setup the pointer to this timer list entry.  */
+        timer_list_head =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, ((base + offset) & (TX_TIMER_ENTRIES - ((ULONG) 1))));
+
+        /* Setup the pointer to the expiration list.  */
+        next_timer =  *timer_list_head;
+
+        /* Loop through the timers active for this relative time slot (determined by offset).  */
+        do
+        {
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+            /* Skip the cascade timer, the cascaded timers are examined below.  */
+            if (next_timer != &(_tx_timer_cascade_timer.tx_timer_internal))
+#endif
+            {
+                /* Determine if the remaining time is larger than the list.  */
+                if (next_timer -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
+                {
+                    /* Calculate the expiration time.  */
+                    calculated_time =  next_timer -> tx_timer_internal_remaining_ticks - (TX_TIMER_ENTRIES - offset);
+                }
+                else
+                {
+                    /* Calculate the expiration time, which is simply the number of entries in this case.  */
+                    calculated_time =  offset;
+                }
+
+                /* Determine if a new minimum expiration time is present.  */
+                if (expiration_time > calculated_time)
+                {
+                    /* Yes, a new minimum expiration time is present - remember it!  */
+                    expiration_time =  calculated_time;
+                }
+            }
+
+            /* Move to the next entry in the timer list.  */
+            next_timer =  next_timer -> tx_timer_internal_active_next;
+
+        } while (next_timer != *timer_list_head);
+
+        /* Find the next timer list entry in use.  */
+        offset =  _tx_timer_list_map_search(&_tx_timer_list_map, _tx_timer_list_start, base, (offset + ((ULONG) 1)));
+    }
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+    /* Determine if any timers are on the cascade lists.  */
+    if (_tx_timer_cascade_active == TX_TRUE)
+    {
+        /* Examine the entries in use of each cascade level, closest first.  Entries
+           of a level are cascaded in order, starting with the entry that covers
+           the cascade time.  */
+        shift =  TX_TIMER_CASCADE_SHIFT;
+        for (level = ((UINT) 0); level < ((UINT) TX_TIMER_CASCADE_LEVELS); level++)
+        {
+            /* Calculate the index of the entry of this level that is cascaded next.  */
+            base =  ((_tx_timer_cascade_time + ((((ULONG) 1) << shift) - ((ULONG) 1))) >> shift) & (TX_TIMER_ENTRIES - ((ULONG) 1));
+
+            /* Find the closest entry in use.  */
+            offset =  _tx_timer_list_map_search(&_tx_timer_cascade_map[level], &_tx_timer_cascade_list[level][0], base, (ULONG) 0);
+
+            /* Loop through the entries in use, until no entry can hold an earlier
+               expiration time.  The closest entry normally holds the earliest
+               expiration of the level, except for timers beyond the last level.  */
+            while ((offset < TX_TIMER_ENTRIES) && ((offset << shift) < expiration_time))
+            {
+                /* Setup the pointer to this cascade list entry.  */
+                timer_list_head =  &_tx_timer_cascade_list[level][((base + offset) & (TX_TIMER_ENTRIES - ((ULONG) 1)))];
+
+                /* Setup the pointer to the expiration list.  */
+                next_timer =  *timer_list_head;
+
+                /* Loop through the timers on this cascade list entry.  */
+                do
+                {
+                    /* Calculate the expiration time from the expiration time on the cascade clock.  */
+                    calculated_time =  _tx_timer_cascade_remaining_get(next_timer) - ((ULONG) 1);
+
+                    /* Determine if a new minimum expiration time is present.  */
+                    if (expiration_time > calculated_time)
+                    {
+                        /* Yes, a new minimum expiration time is present - remember it!  */
+                        expiration_time =  calculated_time;
+                    }
+
+                    /* Move to the next entry in the cascade list.  */
+                    next_timer =  next_timer -> tx_timer_internal_active_next;
+
+                } while (next_timer != *timer_list_head);
+
+                /* Find the next entry in use.  */
+                offset =  _tx_timer_list_map_search(&_tx_timer_cascade_map[level], &_tx_timer_cascade_list[level][0], base, (offset + ((ULONG) 1)));
+            }
+
+            /* Move to the next level.  */
+            shift =  shift + TX_TIMER_CASCADE_SHIFT;
+        }
+    }
+#endif
+#else
+
     /* Look at the next timer entry.  */
     timer_list_head =  _tx_timer_current_ptr;
 
@@ -350,6 +480,7 @@ ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
             timer_list_head =  _tx_timer_list_start;
         }
     }
+#endif
 
     /* Restore interrupts.  */
     TX_RESTORE
@@ -387,6 +518,13 @@ ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
 /*    tx_timer_get_next function prior to this call, which was right      */
 /*    before the processor was put in sleep mode.                         */
 /*                                                                        */
+/*    If TX_TIMER_ENABLE_LIST_MAP is defined and no timer list entry in   */
+/*    use is passed by the increment, the current timer list entry is     */
+/*    simply moved forward.  Otherwise all timers in the timer list are   */
+/*    placed again according to their updated remaining time.  With       */
+/*    cascading timer lists, the skipped passes through the timer list    */
+/*    are then processed right away.                                      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    time_increment                    The amount of time to catch up on */
@@ -397,6 +535,8 @@ ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_timer_cascade_process         Cascade timer processing          */
+/*    _tx_timer_list_map_search         Find timer list entry in use      */
 /*    _tx_timer_system_activate         Timer activate service            */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -418,6 +558,10 @@ UINT                        i;
 TX_TIMER_INTERNAL           **timer_list_head;
 TX_TIMER_INTERNAL           *next_timer;
 TX_TIMER_INTERNAL           *temp_list_head;
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+ULONG                       base;
+ULONG                       offset;
+#endif
 
 
     /* Determine if there is any time increment.  */
@@ -433,6 +577,15 @@ TX_TIMER_INTERNAL           *temp_list_head;
     /* Adjust the system clock.  */
     _tx_timer_system_clock =  _tx_timer_system_clock + time_increment;
 
+#ifdef TX_TIMER_ENABLE_64BIT_CLOCK
+
+    /* Carry into the upper 32 bits of the 64-bit system clock.  */
+    if (_tx_timer_system_clock < time_increment)
+    {
+        _tx_timer_system_clock_upper++;
+    }
+#endif
+
     /* Adjust the time slice variable.  */
     if (_tx_timer_time_slice)
     {
@@ -447,6 +600,29 @@ TX_TIMER_INTERNAL           *temp_list_head;
         }
     }
 
+#ifdef TX_TIMER_ENABLE_LIST_MAP
+
+    /* Pickup the index of the current timer list entry.  */
+    base =  TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+
+    /* Find the closest timer list entry in use.  */
+    offset =  _tx_timer_list_map_search(&_tx_timer_list_map, _tx_timer_list_start, base, (ULONG) 0);
+
+    /* Determine if the time increment passes any timer list entry in use.  */
+    if ((offset == TX_TIMER_ENTRIES) || (offset >= time_increment))
+    {
+        /* No, just move the current timer list entry forward.  All timers keep
+           their expiration time relative to the new current entry.  */
+        _tx_timer_current_ptr =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, ((base + time_increment) & (TX_TIMER_ENTRIES - ((ULONG) 1))));
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Nothing else to do, just return.  */
+        return;
+    }
+#endif
+
     /* Calculate the proper place to position the timer.  */
     timer_list_head =  _tx_timer_current_ptr;
 
@@ -546,9 +722,28 @@ TX_TIMER_INTERNAL           *temp_list_head;
         /* Now clear the timer list head pointer for the timer activate function to work properly.  */
         next_timer -> tx_timer_internal_list_head =  TX_NULL;
 
-        /* Now re-insert the timer into the list.  */
-        _tx_timer_system_activate(next_timer);
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+        /* Determine if this is the cascade timer, it is restarted below.  */
+        if (next_timer != &(_tx_timer_cascade_timer.tx_timer_internal))
+#endif
+        {
+            /* Now re-insert the timer into the list.  */
+            _tx_timer_system_activate(next_timer);
+        }
+    }
+
+#ifdef TX_TIMER_ENABLE_CASCADE
+
+    /* Determine if the cascade timer was removed above.  */
+    if ((_tx_timer_cascade_active == TX_TRUE) && (_tx_timer_cascade_timer.tx_timer_internal.tx_timer_internal_list_head == TX_NULL))
+    {
+        /* Process the passes through the timer list that were skipped right away,
+           such that timers that are now due are not delayed by the cascade timer.
+           This also restarts the cascade timer.  */
+        _tx_timer_cascade_process((ULONG) 0);
     }
+#endif
 
     /* Restore interrupts.  */
     TX_RESTORE
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** POSIX wrapper for THREADX                                             */ 
+/**                                                                       */
+/**                                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"     /* Threadx API */
+#include "pthread.h"    /* Posix API */
+#include "px_int.h"     /* Posix helper functions */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*  pthread_barrier_destroy                               PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function shall destroy the barrier referenced by barrier.  It  */
+/*    fails with EBUSY while threads are blocked on the barrier.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*     barrier                            barrier object                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*     OK                                 if successful                   */
+/*     EBUSY                              if threads are waiting          */
+/*     EINVAL                             if error                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_barrier_info_get                 get the number of waiters       */
+/*    tx_barrier_delete                   delete the barrier internal to  */
+/*                                        the pthread barrier             */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+INT pthread_barrier_destroy(pthread_barrier_t *barrier)
+{
+
+ULONG           suspended_count;
+UINT            status;
+
+    if (barrier->in_use == TX_FALSE)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+
+    /* A barrier with blocked threads may not be destroyed.  */
+    status = tx_barrier_info_get(&(barrier->barrier), NULL, NULL, NULL, &suspended_count, NULL);
+    if (status != TX_SUCCESS)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+    if (suspended_count != 0)
+    {
+        posix_errno = EBUSY;
+        posix_set_pthread_errno(EBUSY);
+        return(EBUSY);
+    }
+
+    barrier->in_use = TX_FALSE;
+    status = tx_barrier_delete(&(barrier->barrier));
+    if (status != TX_SUCCESS)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+    return(OK);
+}
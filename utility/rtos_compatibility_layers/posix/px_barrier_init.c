@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** POSIX wrapper for THREADX                                             */ 
+/**                                                                       */
+/**                                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"     /* Threadx API */
+#include "pthread.h"    /* Posix API */
+#include "px_int.h"     /* Posix helper functions */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*  pthread_barrier_init                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function shall initialize the barrier referenced by barrier    */
+/*    for the number of threads given by count.  The barrier is a ThreadX */
+/*    barrier object, so the last thread to arrive releases all waiting   */
+/*    threads at once.  Barrier attributes are not supported and attr is  */
+/*    ignored.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*     barrier                            barrier object                  */
+/*     attr                               attributes                      */
+/*     count                              number of threads that must     */
+/*                                        call pthread_barrier_wait       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*     OK                                 if successful                   */
+/*     EINVAL                             if error                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_barrier_create                   create the barrier internal to  */
+/*                                        the pthread barrier             */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+INT pthread_barrier_init(pthread_barrier_t *barrier, pthread_barrierattr_t *attr, UINT count)
+{
+
+UINT            status;
+
+    /* A barrier must be released by at least one thread.  */
+    if (count == 0)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+
+    /* Now create the internal ThreadX barrier.  */
+    status = tx_barrier_create(&(barrier->barrier), "PBAR", count);
+    if (status != TX_SUCCESS)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+
+    barrier->in_use = TX_TRUE;
+    return(OK);
+}
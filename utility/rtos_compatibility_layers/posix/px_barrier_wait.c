@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** POSIX wrapper for THREADX                                             */ 
+/**                                                                       */
+/**                                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"     /* Threadx API */
+#include "pthread.h"    /* Posix API */
+#include "px_int.h"     /* Posix helper functions */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*  pthread_barrier_wait                                  PORTABLE C      */
+/*                                                           6.1.12       */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    William E. Lamie, Microsoft Corporation                             */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function shall block the calling thread until the required     */
+/*    number of threads have called pthread_barrier_wait on the barrier.  */
+/*    The thread whose arrival released the barrier gets                  */
+/*    PTHREAD_BARRIER_SERIAL_THREAD, all other threads get zero.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*     barrier                            barrier object                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*     PTHREAD_BARRIER_SERIAL_THREAD      for the releasing thread        */
+/*     OK                                 for the other threads           */
+/*     EINVAL                             if error                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_barrier_wait                     wait at the barrier internal to */
+/*                                        the pthread barrier             */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     William E. Lamie         Initial Version 6.1.12        */
+/*                                                                        */
+/**************************************************************************/
+INT pthread_barrier_wait(pthread_barrier_t *barrier)
+{
+
+UINT            last_arrival;
+UINT            status;
+
+    if (barrier->in_use == TX_FALSE)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+
+    status = tx_barrier_wait(&(barrier->barrier), &last_arrival, TX_WAIT_FOREVER);
+    if (status != TX_SUCCESS)
+    {
+        posix_errno = EINVAL;
+        posix_set_pthread_errno(EINVAL);
+        return(EINVAL);
+    }
+
+    if (last_arrival == TX_TRUE)
+        return(PTHREAD_BARRIER_SERIAL_THREAD);
+    else
+        return(OK);
+}
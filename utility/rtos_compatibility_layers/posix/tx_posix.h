@@ -206,6 +206,8 @@
 
 #define   PTHREAD_EXPLICIT_SCHED        0
 
+#define   PTHREAD_BARRIER_SERIAL_THREAD (-1)
+
 #define   PTHREAD_ONCE_INIT             {0, 0, {0,NULL,0,0,NULL,0,NULL,NULL}}
 
 enum pth_once_state {
@@ -449,6 +451,21 @@ typedef struct pthread_condattr_obj
      
 } pthread_condattr_t;
 
+typedef struct pthread_barrier_obj
+{
+    /* This pthread barrier's internal ThreadX barrier  */
+    TX_BARRIER          barrier;
+
+    INT                 in_use;
+
+} pthread_barrier_t;
+
+typedef struct pthread_barrierattr_obj
+{
+     INT                 in_use;
+
+} pthread_barrierattr_t;
+
 
 
 typedef struct  pthread_once_obj
@@ -544,6 +561,10 @@ INT                   pthread_cond_timedwait(pthread_cond_t *cond,pthread_mutex_
                                                  struct timespec *abstime);
 INT                   pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex);
 
+INT                   pthread_barrier_destroy(pthread_barrier_t *barrier);
+INT                   pthread_barrier_init(pthread_barrier_t *barrier, pthread_barrierattr_t *attr, UINT count);
+INT                   pthread_barrier_wait(pthread_barrier_t *barrier);
+
 
 
 